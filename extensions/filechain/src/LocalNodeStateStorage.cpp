@@ -25,9 +25,13 @@
 #include "catapult/cache/SupplementalDataStorage.h"
 #include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/FileLock.h"
+#include "catapult/thread/FutureUtils.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/asio/io_service.hpp>
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
+#include <thread>
 
 namespace catapult { namespace filechain {
 
@@ -46,10 +50,14 @@ namespace catapult { namespace filechain {
 			return path.generic_string();
 		}
 
-		void LoadCache(const std::string& baseDirectory, const std::string& filename, cache::CacheStorage& cacheStorage) {
+		void LoadCache(
+				const std::string& baseDirectory,
+				const std::string& filename,
+				cache::CacheStorage& cacheStorage,
+				thread::IoServiceThreadPool& pool) {
 			auto path = GetStatePath(baseDirectory, filename);
 			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only));
-			cacheStorage.loadAll(file, Default_Loader_Batch_Size);
+			cacheStorage.loadAll(file, Default_Loader_Batch_Size, pool);
 		}
 
 		void SaveCache(const std::string& baseDirectory, const std::string& filename, const cache::CacheStorage& cacheStorage) {
@@ -66,6 +74,36 @@ namespace catapult { namespace filechain {
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
 			return storage.name() + ".dat";
 		}
+
+		template<typename TStorages, typename TAction>
+		void ProcessStoragesInParallel(const std::string& operationName, const TStorages& storages, TAction action) {
+			// each storage is backed by an independent subcache and file, so all storages can be processed concurrently
+			auto numThreads = std::max<size_t>(1, std::min<size_t>(storages.size(), std::thread::hardware_concurrency()));
+			auto pPool = thread::CreateIoServiceThreadPool(numThreads, "state storage");
+			pPool->start();
+
+			std::vector<thread::future<bool>> futures;
+			for (const auto& pStorage : storages) {
+				auto pPromise = std::make_shared<thread::promise<bool>>();
+				futures.push_back(pPromise->get_future());
+
+				auto& storage = *pStorage;
+				pPool->service().post([operationName, action, pPromise, &storage]() {
+					try {
+						auto message = operationName + " " + storage.name();
+						utils::StackLogger stopwatch(message.c_str(), utils::LogLevel::Info);
+						action(storage);
+						pPromise->set_value(true);
+					} catch (...) {
+						pPromise->set_exception(std::current_exception());
+					}
+				});
+			}
+
+			// wait for all storages to be processed before rethrowing the first failure (if any)
+			for (auto& future : thread::when_all(std::move(futures)).get())
+				future.get();
+		}
 	}
 
 	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData) {
@@ -81,8 +119,13 @@ namespace catapult { namespace filechain {
 
 		utils::StackLogger stopwatch("load state", utils::LogLevel::Warning);
 
-		for (const auto& pStorage : cache.storages())
-			LoadCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		// storages are loaded by a separate pool because loading a storage can block waiting for chunks posted to this pool
+		auto pChunkPool = thread::CreateIoServiceThreadPool(std::max<size_t>(1, std::thread::hardware_concurrency()), "state chunk");
+		pChunkPool->start();
+
+		ProcessStoragesInParallel("load state", cache.storages(), [&dataDirectory, &chunkPool = *pChunkPool](auto& storage) {
+			LoadCache(dataDirectory, GetStorageFilename(storage), storage, chunkPool);
+		});
 
 		Height chainHeight;
 		{
@@ -120,8 +163,11 @@ namespace catapult { namespace filechain {
 		else
 			CATAPULT_LOG(warning) << "lock file could not be removed and must be removed manually";
 
-		for (const auto& pStorage : cache.storages())
-			SaveCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		utils::StackLogger stopwatch("save state", utils::LogLevel::Warning);
+
+		ProcessStoragesInParallel("save state", cache.storages(), [&dataDirectory](const auto& storage) {
+			SaveCache(dataDirectory, GetStorageFilename(storage), storage);
+		});
 
 		{
 			auto path = GetStatePath(dataDirectory, Supplemental_Data_Filename);
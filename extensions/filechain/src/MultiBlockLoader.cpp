@@ -27,7 +27,11 @@
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/Elements.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
+#include <deque>
+#include <thread>
 
 namespace catapult { namespace filechain {
 
@@ -76,6 +80,30 @@ namespace catapult { namespace filechain {
 	// region LoadBlockChain
 
 	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		constexpr uint64_t Blocks_Per_Batch = 100;
+		constexpr size_t Max_Prepared_Batches = 4;
+
+		uint64_t GetElapsedMillis(Clock::time_point startTime) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startTime).count());
+		}
+
+		struct StageStatistics {
+		public:
+			StageStatistics() : NumBlocks(0), ElapsedMillis(0)
+			{}
+
+		public:
+			uint64_t blocksPerSecond() const {
+				return NumBlocks * 1000 / std::max<uint64_t>(1, ElapsedMillis);
+			}
+
+		public:
+			uint64_t NumBlocks;
+			uint64_t ElapsedMillis;
+		};
+
 		class AnalyzeProgressLogger {
 		private:
 			static constexpr auto Log_Interval_Millis = 2'000;
@@ -85,12 +113,19 @@ namespace catapult { namespace filechain {
 			{}
 
 		public:
-			void operator()(Height height, Height chainHeight) {
+			void operator()(
+					Height height,
+					Height chainHeight,
+					const StageStatistics& prepareStatistics,
+					const StageStatistics& executeStatistics) {
 				auto currentMillis = m_stopwatch.millis();
 				if (currentMillis < (m_numLogs + 1) * Log_Interval_Millis)
 					return;
 
-				CATAPULT_LOG(info) << "loaded " << height << " / " << chainHeight << " blocks in " << currentMillis << "ms";
+				CATAPULT_LOG(info)
+						<< "loaded " << height << " / " << chainHeight << " blocks in " << currentMillis << "ms"
+						<< " (prepare: " << prepareStatistics.blocksPerSecond() << " blocks/s"
+						<< ", execute: " << executeStatistics.blocksPerSecond() << " blocks/s)";
 				++m_numLogs;
 			}
 
@@ -102,42 +137,126 @@ namespace catapult { namespace filechain {
 
 	class BlockChainLoader {
 	private:
-		using NotifyProgressFunc = consumer<Height, Height>;
+		using NotifyProgressFunc = consumer<Height, Height, const StageStatistics&, const StageStatistics&>;
+
+		// blocks that have been loaded from storage and scored but not yet executed
+		struct PreparedBatch {
+		public:
+			PreparedBatch() : ElapsedMillis(0)
+			{}
+
+		public:
+			// first element is the parent of the first block in the batch
+			std::vector<std::shared_ptr<const model::BlockElement>> BlockElements;
+			std::vector<std::exception_ptr> Exceptions;
+			model::ChainScore Score;
+			uint64_t ElapsedMillis;
+		};
+
+		using PreparedBatchFuture = thread::future<std::shared_ptr<PreparedBatch>>;
 
 	public:
 		BlockChainLoader(
 				const BlockDependentEntityObserverFactory& observerFactory,
 				const extensions::LocalNodeStateRef& stateRef,
-				Height startHeight)
+				Height startHeight,
+				thread::IoServiceThreadPool& pool)
 				: m_observerFactory(observerFactory)
 				, m_stateRef(stateRef)
 				, m_startHeight(startHeight)
+				, m_pool(pool)
 		{}
 
 	public:
 		model::ChainScore loadAll(const NotifyProgressFunc& notifyProgress) const {
 			const auto& storage = m_stateRef.Storage.view();
+			auto chainHeight = storage.chainHeight();
 
-			auto height = m_startHeight;
-			auto pParentBlockElement = storage.loadBlockElement(height - Height(1));
+			// blocks are loaded and scored in parallel several batches ahead while they are executed in order on this thread
+			std::deque<PreparedBatchFuture> batchFutures;
+			auto nextPrepareHeight = m_startHeight;
+			auto prepareBatches = [this, &storage, chainHeight, &batchFutures, &nextPrepareHeight]() {
+				while (Max_Prepared_Batches > batchFutures.size() && chainHeight >= nextPrepareHeight) {
+					auto numBlocks = std::min<uint64_t>(Blocks_Per_Batch, (chainHeight - nextPrepareHeight).unwrap() + 1);
+					batchFutures.push_back(this->prepare(storage, nextPrepareHeight, numBlocks));
+					nextPrepareHeight = nextPrepareHeight + Height(numBlocks);
+				}
+			};
 
 			model::ChainScore score;
-			auto chainHeight = storage.chainHeight();
-			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
-				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+			StageStatistics prepareStatistics;
+			StageStatistics executeStatistics;
+			try {
+				prepareBatches();
+				while (!batchFutures.empty()) {
+					auto pBatch = batchFutures.front().get();
+					batchFutures.pop_front();
+					prepareBatches();
+
+					for (const auto& pException : pBatch->Exceptions) {
+						if (pException)
+							std::rethrow_exception(pException);
+					}
+
+					score += pBatch->Score;
+					prepareStatistics.NumBlocks += pBatch->BlockElements.size() - 1;
+					prepareStatistics.ElapsedMillis += pBatch->ElapsedMillis;
+
+					for (auto iter = ++pBatch->BlockElements.cbegin(); pBatch->BlockElements.cend() != iter; ++iter) {
+						auto startTime = Clock::now();
+						execute(**iter);
+						++executeStatistics.NumBlocks;
+						executeStatistics.ElapsedMillis += GetElapsedMillis(startTime);
 
-				execute(*pBlockElement);
-				notifyProgress(height, chainHeight);
+						notifyProgress((*iter)->Block.Height, chainHeight, prepareStatistics, executeStatistics);
+					}
+				}
+			} catch (...) {
+				// outstanding batches reference the storage view, so they need to complete before it is released
+				for (auto& batchFuture : batchFutures)
+					batchFuture.get();
 
-				pParentBlockElement = std::move(pBlockElement);
-				height = height + Height(1);
+				throw;
 			}
 
 			return score;
 		}
 
 	private:
+		PreparedBatchFuture prepare(const io::BlockStorageView& storage, Height startHeight, uint64_t numBlocks) const {
+			auto pHeights = std::make_shared<std::vector<Height>>();
+			for (auto i = 0u; i <= numBlocks; ++i)
+				pHeights->push_back(startHeight - Height(1) + Height(i));
+
+			auto pBatch = std::make_shared<PreparedBatch>();
+			pBatch->BlockElements.resize(pHeights->size());
+			pBatch->Exceptions.resize(pHeights->size());
+
+			auto startTime = Clock::now();
+			auto& heights = *pHeights;
+			return thread::ParallelFor(m_pool.service(), heights, m_pool.numWorkerThreads(), [&storage, pBatch](auto height, auto index) {
+				try {
+					pBatch->BlockElements[index] = storage.loadBlockElement(height);
+				} catch (...) {
+					pBatch->Exceptions[index] = std::current_exception();
+				}
+
+				return true;
+			}).then([pHeights, pBatch, startTime](auto&&) {
+				// each block is scored relative to its parent, so scoring can only start after the whole batch has been loaded
+				const auto& blockElements = pBatch->BlockElements;
+				auto hasAllBlocks = std::all_of(blockElements.cbegin(), blockElements.cend(), [](const auto& pBlockElement) {
+					return !!pBlockElement;
+				});
+
+				for (auto i = 1u; hasAllBlocks && i < blockElements.size(); ++i)
+					pBatch->Score += model::ChainScore(chain::CalculateScore(blockElements[i - 1]->Block, blockElements[i]->Block));
+
+				pBatch->ElapsedMillis = GetElapsedMillis(startTime);
+				return pBatch;
+			});
+		}
+
 		void execute(const model::BlockElement& blockElement) const {
 			auto cacheDelta = m_stateRef.Cache.createDelta();
 			auto observerState = observers::ObserverState(cacheDelta, m_stateRef.State);
@@ -151,13 +270,19 @@ namespace catapult { namespace filechain {
 		const BlockDependentEntityObserverFactory& m_observerFactory;
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
+		thread::IoServiceThreadPool& m_pool;
 	};
 
 	model::ChainScore LoadBlockChain(
 			const BlockDependentEntityObserverFactory& observerFactory,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight) {
-		BlockChainLoader loader(observerFactory, stateRef, startHeight);
+		// loading and scoring blocks is independent of the cache state, so it can be spread across all cores
+		auto numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+		auto pPool = thread::CreateIoServiceThreadPool(numThreads, "block load");
+		pPool->start();
+
+		BlockChainLoader loader(observerFactory, stateRef, startHeight, *pPool);
 
 		utils::StackLogger stopwatch("load block chain", utils::LogLevel::Warning);
 		return loader.loadAll(AnalyzeProgressLogger(stopwatch));
@@ -154,6 +154,24 @@ namespace catapult { namespace filechain {
 		});
 	}
 
+	TEST(TEST_CLASS, LoadStateFailsIfAnyCacheFileIsCorrupt) {
+		// Arrange: seed and save the cache state
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		SaveState(tempDir.name(), originalCache);
+
+		// - truncate one of the (concurrently loaded) cache files
+		auto cacheFilePath = boost::filesystem::path(tempDir.name()) / "state" / "BlockDifficultyCache.dat";
+		boost::filesystem::resize_file(cacheFilePath, boost::filesystem::file_size(cacheFilePath) / 2);
+
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+
+		// Act + Assert: the failure is propagated to the caller
+		EXPECT_THROW(LoadState(tempDir.name(), cache, supplementalData), catapult_runtime_error);
+		EXPECT_EQ(Height(0), cache.createView().height());
+	}
+
 	TEST(TEST_CLASS, SaveStateIgnoresLockFile) {
 		// Arrange:
 		test::TempDirectoryGuard tempDir;
@@ -221,5 +221,26 @@ namespace catapult { namespace filechain {
 		EXPECT_EQ(expectedHeights, factoryHeights);
 	}
 
+	TEST(TEST_CLASS, LoadBlockChainLoadsBlocksSpanningMultiplePreparedBatches) {
+		// Arrange: create a storage with enough blocks to require multiple (partial) batches
+		mocks::MockEntityObserver observer;
+		std::vector<Height> factoryHeights;
+		test::LocalNodeTestState state;
+		SetStorageChainHeight(state.ref().Storage.modifier(), 345);
+
+		// Act:
+		auto score = LoadBlockChain(MakeObserverFactory(observer, factoryHeights), state.ref(), Height(2));
+
+		// Assert: all blocks are executed in order and blocks at batch boundaries are scored relative to their parents
+		std::vector<Height> expectedHeights;
+		for (auto i = 2u; i <= 345; ++i)
+			expectedHeights.push_back(Height(i));
+
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(345)), score);
+		EXPECT_EQ(344u, observer.blockHeights().size());
+		EXPECT_EQ(expectedHeights, observer.blockHeights());
+		EXPECT_EQ(expectedHeights, factoryHeights);
+	}
+
 	// endregion
 }}
@@ -0,0 +1,136 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "filechain/src/LocalNodeStateStorage.h"
+#include "plugins/services/hashcache/src/cache/HashCacheStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace filechain {
+
+#define TEST_CLASS LocalNodeStateStorageThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Accounts = 2'000'000;
+		constexpr size_t Num_Hashes = 1'000'000;
+#else
+		constexpr size_t Num_Accounts = 50'000;
+		constexpr size_t Num_Hashes = 25'000;
+#endif
+
+		constexpr size_t Num_Block_Difficulty_Infos = 3'000;
+		constexpr model::NetworkIdentifier Default_Network_Id = model::NetworkIdentifier::Mijin_Test;
+
+		cache::CatapultCache CreateCache() {
+			// use multiple independent subcaches so that their storages can be processed concurrently
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.Network.Identifier = Default_Network_Id;
+
+			std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(3);
+			test::CoreSystemCacheFactory::CreateSubCaches(config, subCaches);
+			subCaches[cache::HashCache::Id] = test::MakeSubCachePlugin<cache::HashCache, cache::HashCacheStorage>(utils::TimeSpan());
+			return cache::CatapultCache(std::move(subCaches));
+		}
+
+		void PopulateCache(cache::CatapultCache& cache) {
+			utils::StackLogger stopwatch("populate cache", utils::LogLevel::Info);
+			auto delta = cache.createDelta();
+
+			auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+			for (auto i = 0u; i < Num_Accounts; ++i) {
+				auto publicKey = test::GenerateRandomData<Key_Size>();
+				auto& accountState = accountStateCacheDelta.addAccount(publicKey, Height(1));
+				test::RandomFillAccountData(i, accountState, 3);
+			}
+
+			auto& blockDifficultyCacheDelta = delta.sub<cache::BlockDifficultyCache>();
+			for (auto i = 0u; i < Num_Block_Difficulty_Infos; ++i)
+				blockDifficultyCacheDelta.insert(Height(i + 1), Timestamp(2 * i + 1), Difficulty(3 * i + 1));
+
+			auto& hashCacheDelta = delta.sub<cache::HashCache>();
+			for (auto i = 0u; i < Num_Hashes; ++i)
+				hashCacheDelta.insert(state::TimestampedHash(Timestamp(i), test::GenerateRandomData<Hash256_Size>()));
+
+			cache.commit(Height(Num_Block_Difficulty_Infos));
+		}
+
+		template<typename TAction>
+		uint64_t MeasureMillis(const char* operationName, TAction action) {
+			utils::StackLogger stopwatch(operationName, utils::LogLevel::Info);
+			action();
+			return stopwatch.millis();
+		}
+
+		void LogThroughput(const char* operationName, uint64_t elapsedMillis) {
+			auto accountsPerSecond = 0 == elapsedMillis ? 0 : Num_Accounts * 1000u / elapsedMillis;
+			CATAPULT_LOG(info)
+					<< operationName << " state with " << Num_Accounts << " accounts in "
+					<< elapsedMillis << "ms (" << accountsPerSecond << " accounts/s)";
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, SaveAndLoadStateThroughput) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = CreateCache();
+		PopulateCache(originalCache);
+
+		cache::SupplementalData originalSupplementalData;
+		originalSupplementalData.State.LastRecalculationHeight = model::ImportanceHeight(1234);
+
+		// Act:
+		auto saveMillis = MeasureMillis("save state", [&tempDir, &originalCache, &originalSupplementalData]() {
+			SaveState(tempDir.name(), originalCache, originalSupplementalData);
+		});
+
+		auto cache = CreateCache();
+		cache::SupplementalData supplementalData;
+		auto isStateLoaded = false;
+		auto loadMillis = MeasureMillis("load state", [&tempDir, &cache, &supplementalData, &isStateLoaded]() {
+			isStateLoaded = LoadState(tempDir.name(), cache, supplementalData);
+		});
+
+		// Assert:
+		ASSERT_TRUE(isStateLoaded);
+
+		auto view = cache.createView();
+		EXPECT_EQ(Num_Accounts, view.sub<cache::AccountStateCache>().size());
+		EXPECT_EQ(Num_Block_Difficulty_Infos, view.sub<cache::BlockDifficultyCache>().size());
+		EXPECT_EQ(Num_Hashes, view.sub<cache::HashCache>().size());
+		EXPECT_EQ(Height(Num_Block_Difficulty_Infos), view.height());
+		EXPECT_EQ(model::ImportanceHeight(1234), supplementalData.State.LastRecalculationHeight);
+
+		LogThroughput("saved", saveMillis);
+		LogThroughput("loaded", loadMillis);
+	}
+}}
@@ -24,6 +24,8 @@
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/crypto/KeyPair.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace harvesting {
 
@@ -64,6 +66,42 @@ namespace catapult { namespace harvesting {
 			SignBlockHeader(keyPair, *pBlock);
 			return pBlock;
 		}
+
+		using KeyPairPointers = std::vector<const crypto::KeyPair*>;
+
+		template<typename TIsHit>
+		const crypto::KeyPair* FindFirstHit(const KeyPairPointers& keyPairs, TIsHit isHit) {
+			for (const auto* pKeyPair : keyPairs) {
+				if (isHit(*pKeyPair))
+					return pKeyPair;
+			}
+
+			return nullptr;
+		}
+
+		template<typename TIsHit>
+		const crypto::KeyPair* FindFirstHit(thread::IoServiceThreadPool& pool, const KeyPairPointers& keyPairs, TIsHit isHit) {
+			// track the lowest index with a hit so that the same account is selected as in sequential evaluation
+			std::atomic<size_t> firstHitIndex(keyPairs.size());
+			auto findFirstHitInPartition = [&firstHitIndex, isHit](auto itBegin, auto itEnd, auto startIndex, auto) {
+				// stop early when an account with a lower index has already hit
+				auto index = startIndex;
+				for (auto iter = itBegin; iter != itEnd && index < firstHitIndex; ++iter, ++index) {
+					if (!isHit(**iter))
+						continue;
+
+					auto currentFirstHitIndex = firstHitIndex.load();
+					while (index < currentFirstHitIndex && !firstHitIndex.compare_exchange_weak(currentFirstHitIndex, index))
+					{}
+
+					return;
+				}
+			};
+
+			thread::ParallelForPartition(pool.service(), keyPairs, pool.numWorkerThreads(), findFirstHitInPartition).get();
+
+			return keyPairs.size() == firstHitIndex ? nullptr : keyPairs[firstHitIndex];
+		}
 	}
 
 	Harvester::Harvester(
@@ -75,8 +113,19 @@ namespace catapult { namespace harvesting {
 			, m_config(config)
 			, m_unlockedAccounts(unlockedAccounts)
 			, m_transactionsInfoSupplier(transactionsInfoSupplier)
+			, m_pPool(nullptr)
 	{}
 
+	Harvester::Harvester(
+			const cache::CatapultCache& cache,
+			const model::BlockChainConfiguration& config,
+			const UnlockedAccounts& unlockedAccounts,
+			const TransactionsInfoSupplier& transactionsInfoSupplier,
+			thread::IoServiceThreadPool& pool)
+			: Harvester(cache, config, unlockedAccounts, transactionsInfoSupplier) {
+		m_pPool = &pool;
+	}
+
 	std::unique_ptr<model::Block> Harvester::harvest(const model::BlockElement& lastBlockElement, Timestamp timestamp) {
 		NextBlockContext context(lastBlockElement, timestamp);
 		if (!context.tryCalculateDifficulty(m_cache.sub<cache::BlockDifficultyCache>(), m_config)) {
@@ -89,24 +138,35 @@ namespace catapult { namespace harvesting {
 		hitContext.Difficulty = context.Difficulty;
 		hitContext.Height = context.Height;
 
-		const auto& accountStateCache = m_cache.sub<cache::AccountStateCache>();
-		chain::BlockHitPredicate hitPredicate(m_config, [&accountStateCache](const auto& key, auto height) {
-			auto lockedCacheView = accountStateCache.createView();
-			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
-			cache::ImportanceView view(readOnlyCache);
-			return view.getAccountImportanceOrDefault(key, height);
-		});
-
 		auto unlockedAccountsView = m_unlockedAccounts.view();
-		const crypto::KeyPair* pHarvesterKeyPair = nullptr;
-		for (const auto& keyPair : unlockedAccountsView) {
-			hitContext.Signer = keyPair.publicKey();
-			hitContext.GenerationHash = model::CalculateGenerationHash(context.ParentContext.GenerationHash, hitContext.Signer);
-
-			if (hitPredicate(hitContext)) {
-				pHarvesterKeyPair = &keyPair;
-				break;
-			}
+		KeyPairPointers keyPairs;
+		keyPairs.reserve(unlockedAccountsView.size());
+		for (const auto& keyPair : unlockedAccountsView)
+			keyPairs.push_back(&keyPair);
+
+		const crypto::KeyPair* pHarvesterKeyPair;
+		{
+			// evaluate all unlocked accounts against a single account state cache snapshot
+			// (the view is released before transactions are selected and the block is created)
+			auto accountStateCacheView = m_cache.sub<cache::AccountStateCache>().createView();
+			cache::ReadOnlyAccountStateCache readOnlyAccountStateCache(*accountStateCacheView);
+			cache::ImportanceView importanceView(readOnlyAccountStateCache);
+			chain::BlockHitPredicate hitPredicate(m_config, [&importanceView](const auto& key, auto height) {
+				return importanceView.getAccountImportanceOrDefault(key, height);
+			});
+
+			auto isHit = [&context, &hitContext, &hitPredicate](const auto& keyPair) {
+				auto candidateHitContext = hitContext;
+				candidateHitContext.Signer = keyPair.publicKey();
+				candidateHitContext.GenerationHash = model::CalculateGenerationHash(
+						context.ParentContext.GenerationHash,
+						keyPair.publicKey());
+				return hitPredicate(candidateHitContext);
+			};
+
+			pHarvesterKeyPair = m_pPool && keyPairs.size() >= Min_Unlocked_Accounts_For_Parallel_Hit_Evaluation
+					? FindFirstHit(*m_pPool, keyPairs, isHit)
+					: FindFirstHit(keyPairs, isHit);
 		}
 
 		if (!pHarvesterKeyPair)
@@ -26,8 +26,13 @@
 #include "catapult/model/Elements.h"
 #include "catapult/model/EntityInfo.h"
 
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
+
 namespace catapult { namespace harvesting {
 
+	/// Minimum number of unlocked accounts for which hits are evaluated in parallel.
+	constexpr size_t Min_Unlocked_Accounts_For_Parallel_Hit_Evaluation = 256;
+
 	/// A class that creates new blocks.
 	class Harvester {
 	public:
@@ -39,6 +44,17 @@ namespace catapult { namespace harvesting {
 				const UnlockedAccounts& unlockedAccounts,
 				const TransactionsInfoSupplier& transactionsInfoSupplier);
 
+		/// Creates a harvester around a catapult \a cache, a block chain \a config, an unlocked accounts set (\a unlockedAccounts)
+		/// and a transactions info supplier (\a transactionsInfoSupplier) that uses \a pool to evaluate hits of large unlocked
+		/// accounts sets in parallel.
+		/// \note \a pool must outlive the harvester.
+		explicit Harvester(
+				const cache::CatapultCache& cache,
+				const model::BlockChainConfiguration& config,
+				const UnlockedAccounts& unlockedAccounts,
+				const TransactionsInfoSupplier& transactionsInfoSupplier,
+				thread::IoServiceThreadPool& pool);
+
 	public:
 		/// Creates the best block (if any) harvested by any unlocked account.
 		/// Created block will have \a lastBlockElement as parent and \a timestamp as timestamp.
@@ -49,5 +65,6 @@ namespace catapult { namespace harvesting {
 		const model::BlockChainConfiguration m_config;
 		const UnlockedAccounts& m_unlockedAccounts;
 		TransactionsInfoSupplier m_transactionsInfoSupplier;
+		thread::IoServiceThreadPool* m_pPool;
 	};
 }}
@@ -38,6 +38,9 @@ namespace catapult { namespace harvesting {
 		/// Maximum number of unlocked accounts.
 		uint32_t MaxUnlockedAccounts;
 
+		/// \c true if transactions paying the highest fee per byte should be harvested first.
+		bool ShouldPrioritizeFeeDensity;
+
 	private:
 		HarvestingConfiguration() = default;
 
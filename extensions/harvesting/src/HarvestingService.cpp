@@ -28,6 +28,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/thread/MultiServicePool.h"
 
 namespace catapult { namespace harvesting {
 
@@ -65,16 +66,38 @@ namespace catapult { namespace harvesting {
 			});
 		}
 
-		thread::Task CreateHarvestingTask(extensions::ServiceState& state, UnlockedAccounts& unlockedAccounts) {
+		TransactionSelectionStrategy GetTransactionSelectionStrategy(const HarvestingConfiguration& config) {
+			return config.ShouldPrioritizeFeeDensity
+					? TransactionSelectionStrategy::Maximize_Fee_Density
+					: TransactionSelectionStrategy::Oldest;
+		}
+
+		std::unique_ptr<Harvester> CreateHarvester(
+				extensions::ServiceState& state,
+				const HarvestingConfiguration& config,
+				const UnlockedAccounts& unlockedAccounts) {
+			const auto& cache = state.cache();
+			const auto& blockChainConfig = state.config().BlockChain;
+			auto transactionsInfoSupplier = CreateTransactionsInfoSupplier(state.utCache(), GetTransactionSelectionStrategy(config));
+
+			// hits are only evaluated in parallel when a dedicated pool is available because the harvesting task blocks until
+			// the evaluation completes
+			if (state.config().Node.ShouldUseSingleThreadPool || config.MaxUnlockedAccounts < Min_Unlocked_Accounts_For_Parallel_Hit_Evaluation)
+				return std::make_unique<Harvester>(cache, blockChainConfig, unlockedAccounts, transactionsInfoSupplier);
+
+			auto pHarvestingPool = state.pool().pushIsolatedPool("harvesting");
+			return std::make_unique<Harvester>(cache, blockChainConfig, unlockedAccounts, transactionsInfoSupplier, *pHarvestingPool);
+		}
+
+		thread::Task CreateHarvestingTask(
+				extensions::ServiceState& state,
+				const HarvestingConfiguration& config,
+				UnlockedAccounts& unlockedAccounts) {
 			const auto& cache = state.cache();
 			const auto& blockChainConfig = state.config().BlockChain;
 			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
 					CreateHarvesterTaskOptions(state),
-					std::make_unique<Harvester>(
-							cache,
-							blockChainConfig,
-							unlockedAccounts,
-							CreateTransactionsInfoSupplier(state.utCache())));
+					CreateHarvester(state, config, unlockedAccounts));
 
 			auto minHarvesterBalance = blockChainConfig.MinHarvesterBalance;
 			return thread::CreateNamedTask("harvesting task", [&cache, &unlockedAccounts, pHarvesterTask, minHarvesterBalance]() {
@@ -108,7 +131,7 @@ namespace catapult { namespace harvesting {
 				locator.registerRootedService("unlockedAccounts", pUnlockedAccounts);
 
 				// add tasks
-				state.tasks().push_back(CreateHarvestingTask(state, *pUnlockedAccounts));
+				state.tasks().push_back(CreateHarvestingTask(state, m_config, *pUnlockedAccounts));
 			}
 
 		private:
@@ -23,20 +23,24 @@
 
 namespace catapult { namespace harvesting {
 
-	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache) {
-		return [&utCache](auto count) {
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache, TransactionSelectionStrategy strategy) {
+		return [&utCache, strategy](auto count) {
 			TransactionsInfo info;
 			std::vector<const model::TransactionInfo*> transactionInfos;
 
 			auto view = utCache.view();
-			if (0 != count) {
-				view.forEach([count, &info, &transactionInfos](const auto& transactionInfo) {
-					info.Transactions.push_back(transactionInfo.pEntity);
+			if (TransactionSelectionStrategy::Maximize_Fee_Density == strategy) {
+				transactionInfos = view.selectByFeeDensity(count);
+			} else if (0 != count) {
+				view.forEach([count, &transactionInfos](const auto& transactionInfo) {
 					transactionInfos.push_back(&transactionInfo);
-					return info.Transactions.size() != count;
+					return transactionInfos.size() != count;
 				});
 			}
 
+			for (const auto* pTransactionInfo : transactionInfos)
+				info.Transactions.push_back(pTransactionInfo->pEntity);
+
 			CalculateBlockTransactionsHash(transactionInfos, info.TransactionsHash);
 			return info;
 		};
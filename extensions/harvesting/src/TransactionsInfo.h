@@ -37,6 +37,15 @@ namespace catapult { namespace harvesting {
 	/// Supplies a transactions info composed of a maximum number of transactions.
 	using TransactionsInfoSupplier = std::function<TransactionsInfo (uint32_t)>;
 
-	/// Creates a default transactions info supplier around \a utCache.
-	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache);
+	/// Strategies for selecting unconfirmed transactions.
+	enum class TransactionSelectionStrategy {
+		/// Oldest transactions are selected first.
+		Oldest,
+
+		/// Transactions paying the highest fee per byte are selected first.
+		Maximize_Fee_Density
+	};
+
+	/// Creates a default transactions info supplier around \a utCache that selects transactions using \a strategy.
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache, TransactionSelectionStrategy strategy);
 }}
@@ -27,6 +27,7 @@
 #include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/KeyPairTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/Waits.h"
 #include "tests/TestHarness.h"
 
@@ -95,11 +96,11 @@ namespace catapult { namespace harvesting {
 
 		struct HarvesterContext {
 		public:
-			HarvesterContext()
+			explicit HarvesterContext(size_t numAccounts = Num_Accounts)
 					: Cache(test::CreateEmptyCatapultCache(CreateConfiguration()))
-					, KeyPairs(CreateKeyPairs(Num_Accounts))
-					, Importances(CreateImportances(Num_Accounts))
-					, pUnlockedAccounts(std::make_unique<UnlockedAccounts>(Num_Accounts))
+					, KeyPairs(CreateKeyPairs(numAccounts))
+					, Importances(CreateImportances(numAccounts))
+					, pUnlockedAccounts(std::make_unique<UnlockedAccounts>(numAccounts))
 					, pLastBlock(CreateBlock())
 					, LastBlockElement(test::BlockToBlockElement(*pLastBlock)) {
 				auto delta = Cache.createDelta();
@@ -127,6 +128,11 @@ namespace catapult { namespace harvesting {
 				return CreateHarvester(CreateConfiguration());
 			}
 
+			auto CreateHarvester(thread::IoServiceThreadPool& pool) {
+				auto transactionsInfoSupplier = [](size_t) { return TransactionsInfo(); };
+				return std::make_unique<Harvester>(Cache, CreateConfiguration(), *pUnlockedAccounts, transactionsInfoSupplier, pool);
+			}
+
 		public:
 			cache::CatapultCache Cache;
 			std::vector<KeyPair> KeyPairs;
@@ -396,6 +402,88 @@ namespace catapult { namespace harvesting {
 		EXPECT_GT(numHarvester1Blocks, numHarvester2Blocks);
 	}
 
+	// region parallel hit evaluation
+
+	namespace {
+		constexpr auto Num_Parallel_Accounts = 2 * Min_Unlocked_Accounts_For_Parallel_Hit_Evaluation;
+
+		template<typename TAction>
+		void RunParallelHarvesterTest(size_t numAccounts, TAction action) {
+			// Arrange:
+			HarvesterContext context(numAccounts);
+			auto pPool = test::CreateStartedIoServiceThreadPool();
+			auto pSequentialHarvester = context.CreateHarvester();
+			auto pParallelHarvester = context.CreateHarvester(*pPool);
+
+			// Act + Assert:
+			action(context, *pSequentialHarvester, *pParallelHarvester);
+		}
+
+		void AssertParallelHarvesterHasSameSignerAsSequentialHarvester(size_t numAccounts, bool useBestKeyTime) {
+			RunParallelHarvesterTest(numAccounts, [useBestKeyTime](const auto& context, auto& sequentialHarvester, auto& parallelHarvester) {
+				// Arrange: when using the best key time, at least one (but typically not every) account has a hit
+				auto timestamp = useBestKeyTime
+						? CalculateBlockGenerationTime(context, BestHarvesterKey(context.LastBlockElement, context.KeyPairs))
+						: Max_Time;
+
+				// Act:
+				auto pSequentialBlock = sequentialHarvester.harvest(context.LastBlockElement, timestamp);
+				auto pParallelBlock = parallelHarvester.harvest(context.LastBlockElement, timestamp);
+
+				// Assert: both harvesters select the first account with a hit
+				ASSERT_TRUE(!!pSequentialBlock);
+				ASSERT_TRUE(!!pParallelBlock);
+				EXPECT_EQ(pSequentialBlock->Signer, pParallelBlock->Signer);
+				EXPECT_EQ(pSequentialBlock->Timestamp, pParallelBlock->Timestamp);
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelHarvesterHasFirstHarvesterWithHitAsSigner) {
+		RunParallelHarvesterTest(Num_Parallel_Accounts, [](const auto& context, const auto&, auto& parallelHarvester) {
+			// Arrange:
+			auto firstPublicKey = context.pUnlockedAccounts->view().begin()->publicKey();
+
+			// Act:
+			auto pBlock = parallelHarvester.harvest(context.LastBlockElement, Max_Time);
+
+			// Assert:
+			ASSERT_TRUE(!!pBlock);
+			EXPECT_EQ(firstPublicKey, pBlock->Signer);
+		});
+	}
+
+	TEST(TEST_CLASS, ParallelHarvesterReturnsNullptrIfNoHarvesterHasHit) {
+		RunParallelHarvesterTest(Num_Parallel_Accounts, [](const auto& context, const auto&, auto& parallelHarvester) {
+			// Arrange:
+			auto bestKey = BestHarvesterKey(context.LastBlockElement, context.KeyPairs);
+			auto tooEarly = Timestamp(CalculateBlockGenerationTime(context, bestKey).unwrap() - 1000);
+
+			// Act:
+			auto pBlock = parallelHarvester.harvest(context.LastBlockElement, tooEarly);
+
+			// Assert:
+			EXPECT_FALSE(!!pBlock);
+		});
+	}
+
+	TEST(TEST_CLASS, ParallelHarvesterHasSameSignerAsSequentialHarvesterWhenAllAccountsHaveHit) {
+		// Assert:
+		AssertParallelHarvesterHasSameSignerAsSequentialHarvester(Num_Parallel_Accounts, false);
+	}
+
+	TEST(TEST_CLASS, ParallelHarvesterHasSameSignerAsSequentialHarvesterWhenSomeAccountsHaveHit) {
+		// Assert:
+		AssertParallelHarvesterHasSameSignerAsSequentialHarvester(Num_Parallel_Accounts, true);
+	}
+
+	TEST(TEST_CLASS, ParallelHarvesterHasSameSignerAsSequentialHarvesterWhenBelowParallelThreshold) {
+		// Assert:
+		AssertParallelHarvesterHasSameSignerAsSequentialHarvester(Num_Accounts, true);
+	}
+
+	// endregion
+
 	// region transaction supplier
 
 	namespace {
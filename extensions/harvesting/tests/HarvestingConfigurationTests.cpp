@@ -35,7 +35,8 @@ namespace catapult { namespace harvesting {
 						{
 							{ "harvestKey", "harvest-key" },
 							{ "isAutoHarvestingEnabled", "true" },
-							{ "maxUnlockedAccounts", "2" }
+							{ "maxUnlockedAccounts", "2" },
+							{ "shouldPrioritizeFeeDensity", "true" }
 						}
 					}
 				};
@@ -50,6 +51,7 @@ namespace catapult { namespace harvesting {
 				EXPECT_EQ("", config.HarvestKey);
 				EXPECT_FALSE(config.IsAutoHarvestingEnabled);
 				EXPECT_EQ(0u, config.MaxUnlockedAccounts);
+				EXPECT_FALSE(config.ShouldPrioritizeFeeDensity);
 			}
 
 			static void AssertCustom(const HarvestingConfiguration& config) {
@@ -57,6 +59,7 @@ namespace catapult { namespace harvesting {
 				EXPECT_EQ("harvest-key", config.HarvestKey);
 				EXPECT_TRUE(config.IsAutoHarvestingEnabled);
 				EXPECT_EQ(2u, config.MaxUnlockedAccounts);
+				EXPECT_TRUE(config.ShouldPrioritizeFeeDensity);
 			}
 		};
 	}
@@ -78,6 +81,7 @@ namespace catapult { namespace harvesting {
 		EXPECT_EQ("", config.HarvestKey);
 		EXPECT_FALSE(config.IsAutoHarvestingEnabled);
 		EXPECT_EQ(5u, config.MaxUnlockedAccounts);
+		EXPECT_TRUE(config.ShouldPrioritizeFeeDensity);
 	}
 
 	// endregion
@@ -19,6 +19,7 @@
 **/
 
 #include "harvesting/src/HarvestingService.h"
+#include "harvesting/src/Harvester.h"
 #include "harvesting/src/HarvestingConfiguration.h"
 #include "harvesting/src/UnlockedAccounts.h"
 #include "tests/test/cache/CacheTestUtils.h"
@@ -70,6 +71,10 @@ namespace catapult { namespace harvesting {
 				const_cast<model::BlockChainConfiguration&>(testState().state().config().BlockChain).MinHarvesterBalance = balance;
 			}
 
+			void setMaxUnlockedAccounts(uint32_t maxUnlockedAccounts) {
+				m_config.MaxUnlockedAccounts = maxUnlockedAccounts;
+			}
+
 			Key harvesterKey() const {
 				return crypto::KeyPair::FromString(m_config.HarvestKey).publicKey();
 			}
@@ -158,6 +163,32 @@ namespace catapult { namespace harvesting {
 		test::AssertRegisteredTask(TestContext(), 1, Task_Name);
 	}
 
+	namespace {
+		void AssertNumPoolServicesAdded(uint32_t maxUnlockedAccounts, size_t expectedNumPoolServices) {
+			// Arrange:
+			TestContext context;
+			context.setMaxUnlockedAccounts(maxUnlockedAccounts);
+			auto numInitialPoolServices = context.testState().state().pool().numServices();
+
+			// Act:
+			context.boot();
+
+			// Assert:
+			EXPECT_EQ(numInitialPoolServices + expectedNumPoolServices, context.testState().state().pool().numServices());
+		}
+	}
+
+	TEST(TEST_CLASS, HarvestingPoolIsNotCreatedWhenMaxUnlockedAccountsIsBelowParallelThreshold) {
+		// Assert:
+		AssertNumPoolServicesAdded(Min_Unlocked_Accounts_For_Parallel_Hit_Evaluation - 1, 0);
+	}
+
+	TEST(TEST_CLASS, HarvestingPoolIsCreatedWhenMaxUnlockedAccountsIsAtLeastParallelThreshold) {
+		// Assert:
+		AssertNumPoolServicesAdded(Min_Unlocked_Accounts_For_Parallel_Hit_Evaluation, 1);
+		AssertNumPoolServicesAdded(Min_Unlocked_Accounts_For_Parallel_Hit_Evaluation + 1, 1);
+	}
+
 	namespace {
 		constexpr Amount Account_Balance(1000);
 		constexpr auto Importance_Grouping = 234u;
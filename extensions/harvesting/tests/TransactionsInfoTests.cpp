@@ -21,6 +21,7 @@
 #include "harvesting/src/TransactionsInfo.h"
 #include "catapult/cache/MemoryUtCache.h"
 #include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace harvesting {
@@ -40,7 +41,7 @@ namespace catapult { namespace harvesting {
 			auto pCache = PrepareCache(count);
 
 			// Act:
-			auto info = CreateTransactionsInfoSupplier(*pCache)(numRequested);
+			auto info = CreateTransactionsInfoSupplier(*pCache, TransactionSelectionStrategy::Oldest)(numRequested);
 
 			// Assert:
 			// - check transactions
@@ -80,4 +81,88 @@ namespace catapult { namespace harvesting {
 		// Assert:
 		AssertSupplierBehavior(10, 15, 10);
 	}
+
+	// region Maximize_Fee_Density
+
+	namespace {
+		auto PrepareCacheWithFees(const std::vector<Amount>& fees, size_t numTransactionsWithSameSigner = 0) {
+			auto pCache = std::make_unique<cache::MemoryUtCache>(cache::MemoryCacheOptions(1000, 1000));
+			auto transactionInfos = test::CreateTransactionInfos(fees.size());
+			auto signer = test::GenerateRandomData<Key_Size>();
+			for (auto i = 0u; i < fees.size(); ++i) {
+				auto pTransaction = test::GenerateRandomTransaction();
+				pTransaction->Fee = fees[i];
+				if (i < numTransactionsWithSameSigner)
+					pTransaction->Signer = signer;
+
+				transactionInfos[i].pEntity = std::move(pTransaction);
+			}
+
+			test::AddAll(*pCache, transactionInfos);
+			return pCache;
+		}
+
+		void AssertFeeDensitySupplierBehavior(uint32_t numRequested, const std::vector<size_t>& expectedIndexes) {
+			// Arrange: all transactions have the same size, so fee density is proportional to fee
+			auto pCache = PrepareCacheWithFees({ Amount(5), Amount(9), Amount(1), Amount(9), Amount(7) });
+			std::vector<const model::TransactionInfo*> allTransactionInfos;
+			pCache->view().forEach([&allTransactionInfos](const auto& transactionInfo) {
+				allTransactionInfos.push_back(&transactionInfo);
+				return true;
+			});
+
+			// Act:
+			auto info = CreateTransactionsInfoSupplier(*pCache, TransactionSelectionStrategy::Maximize_Fee_Density)(numRequested);
+
+			// Assert:
+			// - check transactions
+			std::vector<const model::TransactionInfo*> expectedTransactionInfos;
+			for (auto index : expectedIndexes)
+				expectedTransactionInfos.push_back(allTransactionInfos[index]);
+
+			ASSERT_EQ(expectedTransactionInfos.size(), info.Transactions.size());
+			for (auto i = 0u; i < expectedTransactionInfos.size(); ++i)
+				EXPECT_EQ(*expectedTransactionInfos[i]->pEntity, *info.Transactions[i]) << "transaction at " << i;
+
+			// - check hash
+			Hash256 expectedHash;
+			CalculateBlockTransactionsHash(expectedTransactionInfos, expectedHash);
+			EXPECT_EQ(expectedHash, info.TransactionsHash);
+		}
+	}
+
+	TEST(TEST_CLASS, FeeDensitySupplierReturnsNoTransactionInfosIfZeroInfosAreRequested) {
+		// Assert:
+		AssertFeeDensitySupplierBehavior(0, {});
+	}
+
+	TEST(TEST_CLASS, FeeDensitySupplierReturnsTransactionInfosWithHighestFeesIfCacheHasEnoughTransactions) {
+		// Assert:
+		AssertFeeDensitySupplierBehavior(3, { 1, 3, 4 });
+	}
+
+	TEST(TEST_CLASS, FeeDensitySupplierReturnsSelectedTransactionInfosInArrivalOrder) {
+		// Assert: transaction 0 is selected after transactions 1, 3 and 4 but is returned first
+		AssertFeeDensitySupplierBehavior(4, { 0, 1, 3, 4 });
+	}
+
+	TEST(TEST_CLASS, FeeDensitySupplierReturnsAllTransactionInfosIfCacheHasLessThanCountTransactions) {
+		// Assert:
+		AssertFeeDensitySupplierBehavior(10, { 0, 1, 2, 3, 4 });
+	}
+
+	TEST(TEST_CLASS, FeeDensitySupplierDoesNotReturnTransactionInfoWithoutEarlierTransactionInfosWithSameSigner) {
+		// Arrange: transaction 1 pays the highest fee but might depend on transaction 0 with the same signer
+		auto pCache = PrepareCacheWithFees({ Amount(1), Amount(9), Amount(5) }, 2);
+		auto expectedTransactionInfos = test::ExtractTransactionInfos(pCache->view(), 3);
+
+		// Act:
+		auto info = CreateTransactionsInfoSupplier(*pCache, TransactionSelectionStrategy::Maximize_Fee_Density)(1);
+
+		// Assert: transaction 2 is selected instead of transaction 1
+		ASSERT_EQ(1u, info.Transactions.size());
+		EXPECT_EQ(*expectedTransactionInfos[2]->pEntity, *info.Transactions[0]);
+	}
+
+	// endregion
 }}
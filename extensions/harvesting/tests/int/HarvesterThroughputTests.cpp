@@ -0,0 +1,129 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "harvesting/src/Harvester.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace harvesting {
+
+#define TEST_CLASS HarvesterThroughputTests
+
+	namespace {
+		constexpr size_t Num_Unlocked_Accounts = 10'000;
+		constexpr size_t Num_Passes = 20;
+
+		model::BlockChainConfiguration CreateConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.Network.Identifier = model::NetworkIdentifier::Mijin_Test;
+			config.BlockGenerationTargetTime = utils::TimeSpan::FromSeconds(60);
+			config.MaxDifficultyBlocks = 60;
+			config.ImportanceGrouping = 123;
+			return config;
+		}
+
+		class HarvesterThroughputContext {
+		public:
+			HarvesterThroughputContext()
+					: m_config(CreateConfiguration())
+					, m_cache(test::CreateEmptyCatapultCache(m_config))
+					, m_unlockedAccounts(Num_Unlocked_Accounts)
+					, m_pLastBlock(test::GenerateEmptyRandomBlock())
+					, m_lastBlockElement(test::BlockToBlockElement(*m_pLastBlock)) {
+				utils::StackLogger stopwatch("seed harvester accounts", utils::LogLevel::Info);
+				m_pLastBlock->Height = Height(1);
+				m_pLastBlock->Difficulty = Difficulty::Min();
+				m_lastBlockElement.GenerationHash = test::GenerateRandomData<Hash256_Size>();
+
+				auto delta = m_cache.createDelta();
+				auto& accountStateCache = delta.sub<cache::AccountStateCache>();
+				auto modifier = m_unlockedAccounts.modifier();
+				for (auto i = 0u; i < Num_Unlocked_Accounts; ++i) {
+					auto keyPair = crypto::KeyPair::FromPrivate(test::GenerateRandomPrivateKey());
+					auto& accountState = accountStateCache.addAccount(keyPair.publicKey(), Height(1));
+					accountState.ImportanceInfo.set(Importance(1'000'000), model::ImportanceHeight(1));
+					modifier.add(std::move(keyPair));
+				}
+
+				auto& difficultyCache = delta.sub<cache::BlockDifficultyCache>();
+				difficultyCache.insert(state::BlockDifficultyInfo(m_pLastBlock->Height, m_pLastBlock->Timestamp, m_pLastBlock->Difficulty));
+				m_cache.commit(Height());
+			}
+
+		public:
+			std::unique_ptr<Harvester> createHarvester() const {
+				return std::make_unique<Harvester>(m_cache, m_config, m_unlockedAccounts, CreateTransactionsInfoSupplier());
+			}
+
+			std::unique_ptr<Harvester> createHarvester(thread::IoServiceThreadPool& pool) const {
+				return std::make_unique<Harvester>(m_cache, m_config, m_unlockedAccounts, CreateTransactionsInfoSupplier(), pool);
+			}
+
+			std::unique_ptr<model::Block> measureHarvest(const char* name, Harvester& harvester, Timestamp timestamp) const {
+				std::unique_ptr<model::Block> pBlock;
+				utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+				for (auto i = 0u; i < Num_Passes; ++i)
+					pBlock = harvester.harvest(m_lastBlockElement, timestamp);
+
+				CATAPULT_LOG(info)
+						<< name << " evaluated " << Num_Unlocked_Accounts << " unlocked accounts "
+						<< Num_Passes << " times in " << stopwatch.millis() << "ms";
+				return pBlock;
+			}
+
+		private:
+			static TransactionsInfoSupplier CreateTransactionsInfoSupplier() {
+				return [](auto) { return TransactionsInfo(); };
+			}
+
+		private:
+			model::BlockChainConfiguration m_config;
+			cache::CatapultCache m_cache;
+			UnlockedAccounts m_unlockedAccounts;
+			std::shared_ptr<model::Block> m_pLastBlock;
+			model::BlockElement m_lastBlockElement;
+		};
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, HitEvaluationThroughput) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		HarvesterThroughputContext context;
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+		auto pSequentialHarvester = context.createHarvester();
+		auto pParallelHarvester = context.createHarvester(*pPool);
+
+		// Act: no account has a hit immediately after the last block, so all accounts are evaluated
+		auto pSequentialBlock = context.measureHarvest("sequential (no hit)", *pSequentialHarvester, Timestamp(1));
+		auto pParallelBlock = context.measureHarvest("parallel (no hit)", *pParallelHarvester, Timestamp(1));
+
+		// Assert:
+		EXPECT_FALSE(!!pSequentialBlock);
+		EXPECT_FALSE(!!pParallelBlock);
+	}
+}}
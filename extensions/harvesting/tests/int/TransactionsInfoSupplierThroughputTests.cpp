@@ -0,0 +1,171 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "harvesting/src/TransactionsInfo.h"
+#include "catapult/cache/MemoryUtCache.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/TestHarness.h"
+#include <algorithm>
+
+namespace catapult { namespace harvesting {
+
+#define TEST_CLASS TransactionsInfoSupplierThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Transactions = 1'000'000;
+#else
+		constexpr size_t Num_Transactions = 100'000;
+#endif
+
+		constexpr size_t Num_Passes = 5;
+
+		using TransactionPointers = std::vector<const model::Transaction*>;
+
+		std::unique_ptr<cache::MemoryUtCache> SeedCache(size_t numSigners) {
+			utils::StackLogger stopwatch("seed ut cache", utils::LogLevel::Info);
+			auto pCache = std::make_unique<cache::MemoryUtCache>(cache::MemoryCacheOptions(1'000'000, Num_Transactions));
+
+			auto signers = test::GenerateRandomDataVector<Key>(numSigners);
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < Num_Transactions; ++i) {
+				auto pTransaction = test::GenerateRandomTransaction(sizeof(model::Transaction) + test::Random() % 256);
+				pTransaction->Signer = signers[i % numSigners];
+				pTransaction->Fee = Amount(test::Random() % 1'000'000);
+
+				auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+				test::FillWithRandomData(transactionInfo.EntityHash);
+				transactionInfos.push_back(std::move(transactionInfo));
+			}
+
+			test::AddAll(*pCache, transactionInfos);
+			return pCache;
+		}
+
+		bool HasHigherFeeDensity(const model::Transaction& lhs, const model::Transaction& rhs) {
+			// all fees used in this test are small enough to not overflow
+			return lhs.Fee.unwrap() * rhs.Size > rhs.Fee.unwrap() * lhs.Size;
+		}
+
+		void SortByFeeDensity(TransactionPointers& transactions) {
+			std::stable_sort(transactions.begin(), transactions.end(), [](const auto* pLhs, const auto* pRhs) {
+				return HasHigherFeeDensity(*pLhs, *pRhs);
+			});
+		}
+
+		TransactionPointers SelectWithSupplier(const cache::MemoryUtCache& cache, size_t count, TransactionSelectionStrategy strategy) {
+			auto info = CreateTransactionsInfoSupplier(cache, strategy)(static_cast<uint32_t>(count));
+
+			TransactionPointers transactions;
+			for (const auto& pTransaction : info.Transactions)
+				transactions.push_back(pTransaction.get());
+
+			return transactions;
+		}
+
+		TransactionPointers SelectOldest(const cache::MemoryUtCache& cache, size_t count) {
+			return SelectWithSupplier(cache, count, TransactionSelectionStrategy::Oldest);
+		}
+
+		TransactionPointers SelectByFeeDensity(const cache::MemoryUtCache& cache, size_t count) {
+			return SelectWithSupplier(cache, count, TransactionSelectionStrategy::Maximize_Fee_Density);
+		}
+
+		TransactionPointers SelectByFeeDensitySort(const cache::MemoryUtCache& cache, size_t count) {
+			// mirrors the selection that would be required without a fee density index (ignoring dependencies between transactions)
+			TransactionPointers transactions;
+			auto view = cache.view();
+			transactions.reserve(view.size());
+			view.forEach([&transactions](const auto& transactionInfo) {
+				transactions.push_back(transactionInfo.pEntity.get());
+				return true;
+			});
+
+			auto numSelected = std::min(count, transactions.size());
+			std::partial_sort(
+					transactions.begin(),
+					transactions.begin() + static_cast<std::ptrdiff_t>(numSelected),
+					transactions.end(),
+					[](const auto* pLhs, const auto* pRhs) { return HasHigherFeeDensity(*pLhs, *pRhs); });
+			transactions.resize(numSelected);
+			return transactions;
+		}
+
+		template<typename TSelector>
+		TransactionPointers MeasureSelection(const char* name, const cache::MemoryUtCache& cache, size_t count, TSelector selector) {
+			TransactionPointers transactions;
+			utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+			for (auto i = 0u; i < Num_Passes; ++i)
+				transactions = selector(cache, count);
+
+			auto elapsedMillis = stopwatch.millis();
+			CATAPULT_LOG(info)
+					<< name << " selected " << transactions.size() << " of " << cache.view().size() << " transactions "
+					<< Num_Passes << " times in " << elapsedMillis << "ms";
+			return transactions;
+		}
+
+		void AssertSameFeeDensities(const TransactionPointers& expected, const TransactionPointers& actual) {
+			// transactions with equal fee densities can be ordered differently by partial_sort
+			ASSERT_EQ(expected.size(), actual.size());
+			for (auto i = 0u; i < expected.size(); ++i) {
+				EXPECT_FALSE(HasHigherFeeDensity(*expected[i], *actual[i])) << "transaction at " << i;
+				EXPECT_FALSE(HasHigherFeeDensity(*actual[i], *expected[i])) << "transaction at " << i;
+			}
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, BlockCandidateSelectionThroughput_IndependentTransactions) {
+		// Arrange: all transactions have different signers
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		auto pCache = SeedCache(Num_Transactions);
+
+		for (auto count : { 1'000u, 10'000u, 100'000u }) {
+			// Act:
+			auto oldest = MeasureSelection("oldest (supplier)", *pCache, count, SelectOldest);
+			auto byFeeDensity = MeasureSelection("fee density (supplier)", *pCache, count, SelectByFeeDensity);
+			auto bySort = MeasureSelection("fee density (sort)", *pCache, count, SelectByFeeDensitySort);
+
+			// Assert: independent transactions are selected by fee density alone
+			EXPECT_EQ(count, oldest.size());
+			SortByFeeDensity(byFeeDensity);
+			AssertSameFeeDensities(bySort, byFeeDensity);
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, BlockCandidateSelectionThroughput_DependentTransactions) {
+		// Arrange: each signer has ten transactions
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		auto pCache = SeedCache(Num_Transactions / 10);
+
+		for (auto count : { 1'000u, 10'000u, 100'000u }) {
+			// Act:
+			auto oldest = MeasureSelection("oldest (supplier)", *pCache, count, SelectOldest);
+			auto byFeeDensity = MeasureSelection("fee density (supplier)", *pCache, count, SelectByFeeDensity);
+
+			// Assert:
+			EXPECT_EQ(count, oldest.size());
+			EXPECT_EQ(count, byFeeDensity.size());
+		}
+	}
+}}
@@ -117,12 +117,14 @@ namespace catapult { namespace mongo {
 
 			// add a pre load handler for initializing (nemesis) storage
 			auto pMongoBlockStorage = CreateMongoBlockStorage(*pMongoContext, *pTransactionRegistry);
+			auto flushBlocks = [&mongoBlockStorage = *pMongoBlockStorage]() { mongoBlockStorage.flush(); };
 			MongoNemesisBlockPreparer nemesisBlockPreparer(
 					*pMongoBlockStorage,
 					*pExternalCacheStorage,
 					config.BlockChain,
 					bootstrapper.subscriptionManager().fileStorage(),
-					bootstrapper.pluginManager());
+					bootstrapper.pluginManager(),
+					flushBlocks);
 
 			bootstrapper.extensionManager().addPreLoadHandler([nemesisBlockPreparer](const auto& cache) {
 				nemesisBlockPreparer.prepare(cache);
@@ -132,7 +134,7 @@ namespace catapult { namespace mongo {
 			EmptyCollection(*pMongoContext, Ut_Collection_Name);
 			EmptyCollection(*pMongoContext, Pt_Collection_Name);
 
-			// register subscriptions
+			// register subscriptions (blocks saved for a chain part are group committed before its state change is saved)
 			bootstrapper.subscriptionManager().addBlockChangeSubscriber(
 					io::CreateBlockStorageChangeSubscriber(std::move(pMongoBlockStorage)));
 			bootstrapper.subscriptionManager().addUtChangeSubscriber(
@@ -141,7 +143,8 @@ namespace catapult { namespace mongo {
 			bootstrapper.subscriptionManager().addTransactionStatusSubscriber(CreateMongoTransactionStatusStorage(*pMongoContext));
 			bootstrapper.subscriptionManager().addStateChangeSubscriber(std::make_unique<ApiStateChangeSubscriber>(
 					std::move(pChainScoreProvider),
-					std::move(pExternalCacheStorage)));
+					std::move(pExternalCacheStorage),
+					flushBlocks));
 		}
 	}
 }}
@@ -30,11 +30,14 @@ namespace catapult { namespace mongo {
 	class ApiStateChangeSubscriber : public subscribers::StateChangeSubscriber {
 	public:
 		/// Creates a subscriber around \a pChainScoreProvider and \a pCacheStorage.
+		/// \a flushBlocks is called before saving a state change in order to ensure that all blocks are written before it.
 		ApiStateChangeSubscriber(
 				std::unique_ptr<ChainScoreProvider>&& pChainScoreProvider,
-				std::unique_ptr<ExternalCacheStorage>&& pCacheStorage)
+				std::unique_ptr<ExternalCacheStorage>&& pCacheStorage,
+				const action& flushBlocks)
 				: m_pChainScoreProvider(std::move(pChainScoreProvider))
 				, m_pCacheStorage(std::move(pCacheStorage))
+				, m_flushBlocks(flushBlocks)
 		{}
 
 	public:
@@ -43,11 +46,14 @@ namespace catapult { namespace mongo {
 		}
 
 		void notifyStateChange(const consumers::StateChangeInfo& stateChangeInfo) override {
+			// the state change must never be written ahead of the blocks that produced it
+			m_flushBlocks();
 			m_pCacheStorage->saveDelta(stateChangeInfo.CacheDelta);
 		}
 
 	private:
 		std::unique_ptr<ChainScoreProvider> m_pChainScoreProvider;
 		std::unique_ptr<ExternalCacheStorage> m_pCacheStorage;
+		action m_flushBlocks;
 	};
 }}
@@ -19,13 +19,13 @@
 **/
 
 #include "MongoBlockStorage.h"
-#include "MongoBulkWriter.h"
 #include "MongoChainInfoUtils.h"
 #include "MongoTransactionMetadata.h"
 #include "mappers/BlockMapper.h"
 #include "mappers/HashMapper.h"
 #include "mappers/MapperUtils.h"
 #include "mappers/TransactionMapper.h"
+#include "catapult/utils/ExceptionLogging.h"
 
 using namespace bsoncxx::builder::stream;
 
@@ -86,26 +86,85 @@ namespace catapult { namespace mongo {
 			HandleDropResult(result, "transactions");
 		}
 
-		class MongoBlockStorage final : public io::LightBlockStorage {
+		constexpr size_t Max_Blocks_Per_Commit = 100;
+
+		// documents of a saved block that has not yet been written to the database
+		struct PendingBlock {
+		public:
+			PendingBlock(Height height, bsoncxx::document::value&& blockDocument)
+					: BlockHeight(height)
+					, BlockDocument(std::move(blockDocument))
+			{}
+
+		public:
+			Height BlockHeight;
+			bsoncxx::document::value BlockDocument;
+			std::vector<bsoncxx::document::value> TransactionDocuments;
+		};
+
+		Height LoadChainHeight(const mongocxx::database& database) {
+			auto chainInfoDocument = GetChainInfoDocument(database);
+			if (mappers::IsEmptyDocument(chainInfoDocument))
+				return Height();
+
+			auto heightValue = mappers::GetUint64OrDefault(chainInfoDocument.view(), "height", 0);
+			return Height(heightValue);
+		}
+
+		void InsertDocuments(
+				mongocxx::database& database,
+				const std::string& collectionName,
+				const std::vector<bsoncxx::document::value>& documents,
+				Height height) {
+			if (documents.empty())
+				return;
+
+			auto collection = database[collectionName];
+			auto result = collection.insert_many(documents);
+			auto numInsertedDocuments = result ? static_cast<size_t>(result->inserted_count()) : 0u;
+			if (documents.size() != numInsertedDocuments) {
+				CATAPULT_LOG(error)
+						<< "only inserted " << numInsertedDocuments << " of " << documents.size() << " "
+						<< collectionName << " documents up to height " << height;
+				CATAPULT_THROW_RUNTIME_ERROR_1("could not insert documents for blocks up to height", height);
+			}
+		}
+
+		class DefaultMongoBlockStorage final : public MongoBlockStorage {
 		public:
-			MongoBlockStorage(MongoStorageContext& context, const MongoTransactionRegistry& transactionRegistry)
-					: m_context(context)
-					, m_transactionRegistry(transactionRegistry)
-					, m_database(m_context.createDatabaseConnection())
+			DefaultMongoBlockStorage(MongoStorageContext& context, const MongoTransactionRegistry& transactionRegistry)
+					: m_transactionRegistry(transactionRegistry)
+					, m_database(context.createDatabaseConnection())
+					, m_isChainHeightKnown(false)
 			{}
 
+			~DefaultMongoBlockStorage() override {
+				try {
+					writePendingBlocks();
+				} catch (...) {
+					CATAPULT_LOG(error) << "mongo block storage could not write pending blocks:" << EXCEPTION_DIAGNOSTIC_MESSAGE();
+				}
+			}
+
 		public:
 			Height chainHeight() const override {
-				auto chainInfoDocument = GetChainInfoDocument(m_database);
-				if (mappers::IsEmptyDocument(chainInfoDocument))
-					return Height();
+				// the chain height includes all pending blocks, so it only needs to be read from the database once
+				if (!m_isChainHeightKnown) {
+					m_chainHeight = LoadChainHeight(m_database);
+					m_isChainHeightKnown = true;
+				}
 
-				auto heightValue = mappers::GetUint64OrDefault(chainInfoDocument.view(), "height", 0);
-				return Height(heightValue);
+				return m_chainHeight;
+			}
+
+			void flush() override {
+				writePendingBlocks();
 			}
 
 		public:
 			model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override {
+				writePendingBlocks();
+
 				auto dbHeight = chainHeight();
 				if (Height(0) == height || dbHeight < height)
 					return model::HashRange();
@@ -123,36 +182,26 @@ namespace catapult { namespace mongo {
 				if (height != dbHeight + Height(1))
 					CATAPULT_THROW_INVALID_ARGUMENT_2("cannot save out of order block (block height, chain height)", height, dbHeight);
 
-				auto blocks = m_database["blocks"];
-
-				auto dbBlock = mappers::ToDbModel(blockElement);
-				auto result = blocks.insert_one(dbBlock.view()).get().result();
-				if (0 == result.inserted_count())
-					CATAPULT_THROW_RUNTIME_ERROR("saveBlock failed: block header was not inserted");
-
-				const auto& registry = m_transactionRegistry;
-				std::atomic<size_t> numTotalTransactionDocuments(0);
-				auto createDocuments = [height, &registry, &numTotalTransactionDocuments](const auto& transactionElement, auto index) {
-					auto metadata = MongoTransactionMetadata(transactionElement, height, index);
-					auto documents = mappers::ToDbDocuments(transactionElement.Transaction, metadata, registry);
-					numTotalTransactionDocuments += documents.size();
-					return documents;
-				};
-				auto results = m_context.bulkWriter().bulkInsert("transactions", blockElement.Transactions, createDocuments).get();
-				auto aggregate = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
-				auto numInsertedDocuments = mappers::ToUint32(aggregate.NumInserted);
-				if (blockElement.Transactions.size() > numInsertedDocuments || numTotalTransactionDocuments != numInsertedDocuments) {
-					CATAPULT_LOG(error)
-							<< "only inserted " << numInsertedDocuments << " documents with "
-							<< blockElement.Transactions.size() << " transactions and "
-							<< numTotalTransactionDocuments << " expected documents at height " << height;
-					CATAPULT_THROW_RUNTIME_ERROR_1("could not insert transactions for block at height", height);
+				// map the block right away because the block element is not owned by the storage
+				PendingBlock pendingBlock(height, mappers::ToDbModel(blockElement));
+				auto index = 0u;
+				for (const auto& transactionElement : blockElement.Transactions) {
+					auto metadata = MongoTransactionMetadata(transactionElement, height, index++);
+					auto documents = mappers::ToDbDocuments(transactionElement.Transaction, metadata, m_transactionRegistry);
+					for (auto& transactionDocument : documents)
+						pendingBlock.TransactionDocuments.push_back(std::move(transactionDocument));
 				}
 
-				SetHeight(m_database, blockElement.Block.Height);
+				m_pendingBlocks.push_back(std::move(pendingBlock));
+				m_chainHeight = height;
+
+				if (Max_Blocks_Per_Commit == m_pendingBlocks.size())
+					writePendingBlocks();
 			}
 
 			void dropBlocksAfter(Height height) override {
+				writePendingBlocks();
+
 				auto dbHeight = chainHeight();
 				if (dbHeight <= height)
 					return;
@@ -161,18 +210,56 @@ namespace catapult { namespace mongo {
 
 				DropBlocks(m_database, height);
 				DropTransactions(m_database, height);
+				m_chainHeight = height;
+			}
+
+		private:
+			void writePendingBlocks() const {
+				if (m_pendingBlocks.empty())
+					return;
+
+				// pending blocks are discarded even if the write fails because blocks after a failed block cannot be written
+				// without leaving a gap, so forget the chain height and continue from the one in the database instead
+				auto pendingBlocks = std::move(m_pendingBlocks);
+				m_pendingBlocks.clear();
+				try {
+					commit(pendingBlocks);
+				} catch (...) {
+					m_isChainHeightKnown = false;
+					throw;
+				}
+			}
+
+			void commit(std::vector<PendingBlock>& pendingBlocks) const {
+				std::vector<bsoncxx::document::value> blockDocuments;
+				std::vector<bsoncxx::document::value> transactionDocuments;
+				for (auto& pendingBlock : pendingBlocks) {
+					blockDocuments.push_back(std::move(pendingBlock.BlockDocument));
+					for (auto& transactionDocument : pendingBlock.TransactionDocuments)
+						transactionDocuments.push_back(std::move(transactionDocument));
+				}
+
+				// the chain height is only updated after all blocks and transactions have been inserted
+				auto height = pendingBlocks.back().BlockHeight;
+				InsertDocuments(m_database, "blocks", blockDocuments, height);
+				InsertDocuments(m_database, "transactions", transactionDocuments, height);
+				SetHeight(m_database, height);
 			}
 
 		private:
-			MongoStorageContext& m_context;
 			const MongoTransactionRegistry& m_transactionRegistry;
-			MongoDatabase m_database;
+			mutable MongoDatabase m_database;
+
+			// pending blocks (and the database they are written to) are mutable because reads write them first
+			mutable std::vector<PendingBlock> m_pendingBlocks;
+			mutable Height m_chainHeight;
+			mutable bool m_isChainHeightKnown;
 		};
 	}
 
-	std::unique_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+	std::unique_ptr<MongoBlockStorage> CreateMongoBlockStorage(
 			MongoStorageContext& context,
 			const MongoTransactionRegistry& transactionRegistry) {
-		return std::make_unique<MongoBlockStorage>(context, transactionRegistry);
+		return std::make_unique<DefaultMongoBlockStorage>(context, transactionRegistry);
 	}
 }}
@@ -26,8 +26,17 @@ namespace catapult { namespace mongo { class MongoTransactionRegistry; } }
 
 namespace catapult { namespace mongo {
 
+	/// Mongodb block storage that buffers saved blocks and group commits them with a single bulk write per collection.
+	/// \note Pending blocks are written when they are flushed, when too many blocks are pending and before any other storage
+	///       operation accesses the database.
+	class MongoBlockStorage : public io::LightBlockStorage {
+	public:
+		/// Writes all pending blocks to the database.
+		virtual void flush() = 0;
+	};
+
 	/// Creates a mongodb block storage around \a context and \a transactionRegistry.
-	std::unique_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+	std::unique_ptr<MongoBlockStorage> CreateMongoBlockStorage(
 			MongoStorageContext& context,
 			const MongoTransactionRegistry& transactionRegistry);
 }}
@@ -33,12 +33,14 @@ namespace catapult { namespace mongo {
 			ExternalCacheStorage& externalCacheStorage,
 			const model::BlockChainConfiguration& config,
 			const io::BlockStorage& sourceStorage,
-			const plugins::PluginManager& pluginManager)
+			const plugins::PluginManager& pluginManager,
+			const action& flushBlocks)
 			: m_destinationStorage(destinationStorage)
 			, m_externalCacheStorage(externalCacheStorage)
 			, m_config(config)
 			, m_sourceStorage(sourceStorage)
 			, m_pluginManager(pluginManager)
+			, m_flushBlocks(flushBlocks)
 	{}
 
 	bool MongoNemesisBlockPreparer::prepare(const cache::CatapultCache& cache) const {
@@ -62,7 +64,8 @@ namespace catapult { namespace mongo {
 		extensions::NemesisBlockLoader loader(m_pluginManager.transactionRegistry(), *pNotificationPublisher, *pEntityObserver);
 		loader.execute(m_config, *pNemesisBlockElement, *pCacheDelta);
 
-		// 4. save the cache state externally (into mongo)
+		// 4. save the cache state externally (into mongo) after the nemesis block has been written
+		m_flushBlocks();
 		m_externalCacheStorage.saveDelta(*pCacheDelta);
 		return true;
 	}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
 
 namespace catapult {
 	namespace cache { class CatapultCache; }
@@ -38,12 +39,14 @@ namespace catapult { namespace mongo {
 	public:
 		/// Creates a preparer that will prepare destination (mongo) block storage (\a destinationStorage) and (mongo) cache
 		/// storage (\a externalCacheStorage) using \a config, source block storage (\a sourceStorage) and \a pluginManager.
+		/// \a flushBlocks is called before saving the nemesis cache state in order to ensure that the nemesis block is written before it.
 		MongoNemesisBlockPreparer(
 				io::LightBlockStorage& destinationStorage,
 				ExternalCacheStorage& externalCacheStorage,
 				const model::BlockChainConfiguration& config,
 				const io::BlockStorage& sourceStorage,
-				const plugins::PluginManager& pluginManager);
+				const plugins::PluginManager& pluginManager,
+				const action& flushBlocks);
 
 	public:
 		/// Prepares the mongo nemesis block given \a cache with all registered plugins.
@@ -55,5 +58,6 @@ namespace catapult { namespace mongo {
 		const model::BlockChainConfiguration& m_config;
 		const io::BlockStorage& m_sourceStorage;
 		const plugins::PluginManager& m_pluginManager;
+		action m_flushBlocks;
 	};
 }}
@@ -80,7 +80,12 @@ namespace catapult { namespace mongo {
 					, m_pChainScoreProviderRaw(m_pChainScoreProvider.get())
 					, m_pExternalCacheStorage(std::make_unique<MockExternalCacheStorage>())
 					, m_pExternalCacheStorageRaw(m_pExternalCacheStorage.get())
-					, m_subscriber(std::move(m_pChainScoreProvider), std::move(m_pExternalCacheStorage))
+					, m_numFlushes(0)
+					, m_subscriber(std::move(m_pChainScoreProvider), std::move(m_pExternalCacheStorage), [this]() {
+						// flushes must happen before the delta is saved
+						m_numDeltasAtFlush.push_back(m_pExternalCacheStorageRaw->deltas().size());
+						++m_numFlushes;
+					})
 			{}
 
 		public:
@@ -96,11 +101,21 @@ namespace catapult { namespace mongo {
 				return m_subscriber;
 			}
 
+			auto numFlushes() const {
+				return m_numFlushes;
+			}
+
+			const auto& numDeltasAtFlush() const {
+				return m_numDeltasAtFlush;
+			}
+
 		private:
 			std::unique_ptr<MockChainScoreProvider> m_pChainScoreProvider; // notice that this is moved into m_subscriber
 			MockChainScoreProvider* m_pChainScoreProviderRaw;
 			std::unique_ptr<MockExternalCacheStorage> m_pExternalCacheStorage; // notice that this is moved into m_subscriber
 			MockExternalCacheStorage* m_pExternalCacheStorageRaw;
+			size_t m_numFlushes;
+			std::vector<size_t> m_numDeltasAtFlush;
 			ApiStateChangeSubscriber m_subscriber;
 		};
 	}
@@ -118,6 +133,7 @@ namespace catapult { namespace mongo {
 		EXPECT_EQ(chainScore, context.chainScoreProvider().scores()[0]);
 
 		EXPECT_TRUE(context.externalCacheStorage().deltas().empty());
+		EXPECT_EQ(0u, context.numFlushes());
 	}
 
 	TEST(TEST_CLASS, NotifyStateChangeForwardsToExternalCacheStorage) {
@@ -136,4 +152,20 @@ namespace catapult { namespace mongo {
 		ASSERT_EQ(1u, context.externalCacheStorage().deltas().size());
 		EXPECT_EQ(&cacheDelta, context.externalCacheStorage().deltas()[0]);
 	}
+
+	TEST(TEST_CLASS, NotifyStateChangeFlushesBlocksBeforeForwardingToExternalCacheStorage) {
+		// Arrange:
+		TestContext context;
+		auto cache = cache::CatapultCache({});
+		auto cacheDelta = cache.createDelta();
+		auto chainScore = model::ChainScore(123, 435);
+
+		// Act:
+		context.subscriber().notifyStateChange(consumers::StateChangeInfo(cacheDelta, chainScore, Height(123)));
+
+		// Assert: a single flush happened before the delta was saved
+		EXPECT_EQ(1u, context.numFlushes());
+		EXPECT_EQ(std::vector<size_t>({ 0 }), context.numDeltasAtFlush());
+		EXPECT_EQ(1u, context.externalCacheStorage().deltas().size());
+	}
 }}
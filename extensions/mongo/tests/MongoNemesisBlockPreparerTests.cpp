@@ -117,6 +117,11 @@ namespace catapult { namespace mongo {
 				return m_externalCacheStorage;
 			}
 
+			/// Gets the number of (saved blocks, cache state saves) at the time of each flush.
+			const auto& flushes() const {
+				return m_flushes;
+			}
+
 		public:
 			bool prepare() {
 				MongoNemesisBlockPreparer nemesisBlockPreparer(
@@ -124,7 +129,11 @@ namespace catapult { namespace mongo {
 						m_externalCacheStorage,
 						m_pPluginManager->config(),
 						m_sourceStorage,
-						*m_pPluginManager);
+						*m_pPluginManager,
+						[this]() {
+							auto numSavedBlocks = m_mongoStorage.savedBlockElements().size();
+							m_flushes.emplace_back(numSavedBlocks, m_externalCacheStorage.numSaveDeltaCalls());
+						});
 
 				return nemesisBlockPreparer.prepare(m_cache);
 			}
@@ -136,6 +145,7 @@ namespace catapult { namespace mongo {
 
 			mocks::MockSavingBlockStorage m_mongoStorage;
 			MockExternalAccountStateCacheStorage m_externalCacheStorage;
+			std::vector<std::pair<size_t, size_t>> m_flushes;
 		};
 
 		// endregion
@@ -179,6 +189,20 @@ namespace catapult { namespace mongo {
 			EXPECT_TRUE(!!transactionElement.OptionalExtractedAddresses);
 	}
 
+	TEST(TEST_CLASS, PrepareFlushesNemesisBlockBeforeSavingCacheState) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		auto isPreparePerformed = context.prepare();
+
+		// Assert: blocks were flushed once after the nemesis block was saved but before the cache state was saved
+		EXPECT_TRUE(isPreparePerformed);
+		ASSERT_EQ(1u, context.flushes().size());
+		EXPECT_EQ((std::pair<size_t, size_t>(1, 0)), context.flushes()[0]);
+		EXPECT_EQ(1u, context.externalCacheStorage().numSaveDeltaCalls());
+	}
+
 	// endregion
 
 	// region cache storage forwarding
@@ -242,6 +266,7 @@ namespace catapult { namespace mongo {
 			auto numExpectedSaves = expectIsPreparePerformed ? 1u : 0u;
 			EXPECT_EQ(numExpectedSaves, context.externalCacheStorage().numSaveDeltaCalls());
 			EXPECT_EQ(numExpectedSaves, context.mongoStorageView().savedBlockElements().size());
+			EXPECT_EQ(numExpectedSaves, context.flushes().size());
 		}
 	}
 
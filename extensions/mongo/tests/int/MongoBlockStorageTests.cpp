@@ -41,8 +41,8 @@ namespace catapult { namespace mongo {
 	namespace {
 		constexpr uint64_t Multiple_Blocks_Count = 10;
 
-		std::shared_ptr<io::LightBlockStorage> CreateMongoBlockStorage(std::unique_ptr<MongoTransactionPlugin>&& pTransactionPlugin) {
-			return test::CreateStorage<io::LightBlockStorage>(
+		std::shared_ptr<MongoBlockStorage> CreateMongoBlockStorage(std::unique_ptr<MongoTransactionPlugin>&& pTransactionPlugin) {
+			return test::CreateStorage<MongoBlockStorage>(
 					std::move(pTransactionPlugin),
 					test::DbInitializationType::None,
 					mongo::CreateMongoBlockStorage);
@@ -152,6 +152,7 @@ namespace catapult { namespace mongo {
 
 			// Act:
 			pStorage->saveBlock(blockElement);
+			pStorage->flush();
 
 			// Assert:
 			ASSERT_EQ(Height(1), pStorage->chainHeight());
@@ -194,15 +195,24 @@ namespace catapult { namespace mongo {
 			}
 
 		public:
-			io::LightBlockStorage& storage() {
+			MongoBlockStorage& storage() {
 				return *m_pStorage;
 			}
 
 			void saveBlocks() {
+				saveBlocksWithoutFlush();
+				storage().flush();
+			}
+
+			void saveBlocksWithoutFlush() {
 				for (const auto& blockElement : m_blockElements)
 					storage().saveBlock(blockElement);
 			}
 
+			void destroyStorage() {
+				m_pStorage.reset();
+			}
+
 			const std::vector<model::BlockElement>& elements() {
 				return m_blockElements;
 			}
@@ -210,7 +220,7 @@ namespace catapult { namespace mongo {
 		private:
 			std::vector<std::unique_ptr<model::Block>> m_blocks;
 			std::vector<model::BlockElement> m_blockElements;
-			std::shared_ptr<io::LightBlockStorage> m_pStorage;
+			std::shared_ptr<MongoBlockStorage> m_pStorage;
 		};
 	}
 
@@ -232,6 +242,82 @@ namespace catapult { namespace mongo {
 		test::AssertCollectionSize("transactions", numExpectedTransactions);
 	}
 
+	TEST(TEST_CLASS, ChainHeightIncludesPendingBlocks) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+
+		// Act:
+		context.saveBlocksWithoutFlush();
+
+		// Assert:
+		EXPECT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
+	}
+
+	TEST(TEST_CLASS, CannotSaveOutOfOrderBlock) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		context.storage().saveBlock(context.elements()[0]);
+
+		// Act + Assert:
+		EXPECT_THROW(context.storage().saveBlock(context.elements()[2]), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, SaveBlockDoesNotWritePendingBlocks) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+
+		// Act:
+		context.saveBlocksWithoutFlush();
+
+		// Assert:
+		test::AssertCollectionSize("blocks", 0);
+		test::AssertCollectionSize("transactions", 0);
+	}
+
+	TEST(TEST_CLASS, SaveBlockWritesPendingBlocksWhenMaxPendingBlocksIsReached) {
+		// Arrange: storage commits at most 100 blocks at once
+		TestContext context(100 + 1);
+
+		// Act:
+		context.saveBlocksWithoutFlush();
+
+		// Assert: the first 100 blocks were written but the last one is still pending
+		test::AssertCollectionSize("blocks", 100);
+		test::AssertCollectionSize("transactions", 100 * 10);
+	}
+
+	TEST(TEST_CLASS, FlushWritesAllPendingBlocks) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		context.saveBlocksWithoutFlush();
+
+		// Act:
+		context.storage().flush();
+
+		// Assert:
+		test::AssertCollectionSize("blocks", Multiple_Blocks_Count);
+
+		auto connection = test::CreateDbConnection();
+		auto database = connection[test::DatabaseName()];
+		auto chainInfoDocument = GetChainInfoDocument(database);
+		EXPECT_EQ(Multiple_Blocks_Count, test::GetUint64(chainInfoDocument.view(), "height"));
+	}
+
+	TEST(TEST_CLASS, DestructionWritesAllPendingBlocks) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		context.saveBlocksWithoutFlush();
+
+		// Act:
+		context.destroyStorage();
+
+		// Assert:
+		for (const auto& blockElement : context.elements())
+			AssertEqual(blockElement);
+
+		test::AssertCollectionSize("blocks", Multiple_Blocks_Count);
+	}
+
 	TEST(TEST_CLASS, SaveBlockDoesNotOverwriteScore) {
 		// Arrange:
 		TestContext context(Multiple_Blocks_Count);
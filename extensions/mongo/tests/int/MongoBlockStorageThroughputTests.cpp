@@ -0,0 +1,168 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "mongo/src/MongoBlockStorage.h"
+#include "mongo/src/ApiStateChangeSubscriber.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/model/ChainScore.h"
+#include "catapult/utils/StackLogger.h"
+#include "mongo/tests/test/MongoTestUtils.h"
+#include "mongo/tests/test/mocks/MockTransactionMapper.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace mongo {
+
+#define TEST_CLASS MongoBlockStorageThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr uint32_t Num_Blocks = 10'000;
+#else
+		constexpr uint32_t Num_Blocks = 1'000;
+#endif
+
+		constexpr uint32_t Num_Transactions_Per_Block = 10;
+
+		// region mocks
+
+		class MockChainScoreProvider : public ChainScoreProvider {
+		public:
+			void saveScore(const model::ChainScore&) override
+			{}
+
+			model::ChainScore loadScore() const override {
+				CATAPULT_THROW_RUNTIME_ERROR("loadScore - not supported in mock");
+			}
+		};
+
+		class MockExternalCacheStorage : public ExternalCacheStorage {
+		public:
+			MockExternalCacheStorage() : ExternalCacheStorage("MockExternalCacheStorage", std::numeric_limits<size_t>::max())
+			{}
+
+		public:
+			void saveDelta(const cache::CatapultCacheDelta&) override
+			{}
+
+			void loadAll(cache::CatapultCache&, Height) const override {
+				CATAPULT_THROW_RUNTIME_ERROR("loadAll - not supported in mock");
+			}
+		};
+
+		// endregion
+
+		class TestContext {
+		public:
+			TestContext() {
+				for (auto i = 1u; i <= Num_Blocks; ++i) {
+					auto transactions = test::GenerateRandomTransactions(Num_Transactions_Per_Block);
+					m_blocks.push_back(test::GenerateRandomBlockWithTransactions(test::MakeConst(transactions)));
+					m_blocks.back()->Height = Height(i);
+					m_blockElements.emplace_back(test::BlockToBlockElement(*m_blocks.back(), test::GenerateRandomData<Hash256_Size>()));
+				}
+			}
+
+		public:
+			const std::vector<model::BlockElement>& elements() const {
+				return m_blockElements;
+			}
+
+		private:
+			std::vector<std::unique_ptr<model::Block>> m_blocks;
+			std::vector<model::BlockElement> m_blockElements;
+		};
+
+		enum class FlushMode { Every_Block, State_Change };
+
+		void MeasureStateChangeThroughput(const char* name, uint32_t numBlocksPerStateChange, FlushMode flushMode) {
+			// Arrange:
+			TestContext context;
+			auto pStorage = test::CreateStorage<MongoBlockStorage>(
+					mocks::CreateMockTransactionMongoPlugin(),
+					test::DbInitializationType::Prepare,
+					CreateMongoBlockStorage);
+			ApiStateChangeSubscriber subscriber(
+					std::make_unique<MockChainScoreProvider>(),
+					std::make_unique<MockExternalCacheStorage>(),
+					[&storage = *pStorage]() { storage.flush(); });
+
+			auto cache = test::CreateEmptyCatapultCache();
+			auto cacheDelta = cache.createDelta();
+			model::ChainScore scoreDelta(1);
+
+			// Act: emulate the sync consumer, which saves all blocks of a chain part and then notifies a single state change
+			uint64_t elapsedMillis;
+			{
+				utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+				for (const auto& blockElement : context.elements()) {
+					pStorage->saveBlock(blockElement);
+
+					// flushing after every block emulates a synchronous writer that cannot group commit
+					if (FlushMode::Every_Block == flushMode)
+						pStorage->flush();
+
+					auto height = blockElement.Block.Height;
+					if (0 == height.unwrap() % numBlocksPerStateChange || Num_Blocks == height.unwrap())
+						subscriber.notifyStateChange(consumers::StateChangeInfo(cacheDelta, scoreDelta, height));
+				}
+
+				elapsedMillis = stopwatch.millis();
+			}
+
+			// Assert:
+			auto blocksPerSecond = static_cast<uint64_t>(Num_Blocks) * 1000 / std::max<uint64_t>(1, elapsedMillis);
+			CATAPULT_LOG(info)
+					<< name << " saved " << Num_Blocks << " blocks with " << Num_Transactions_Per_Block << " transactions each ("
+					<< numBlocksPerStateChange << " blocks per state change) in " << elapsedMillis << "ms ("
+					<< blocksPerSecond << " blocks/s)";
+			EXPECT_EQ(Height(Num_Blocks), pStorage->chainHeight());
+			test::AssertCollectionSize("blocks", Num_Blocks);
+			test::AssertCollectionSize("transactions", Num_Blocks * Num_Transactions_Per_Block);
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, StateChangeThroughput_FlushEveryBlock) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureStateChangeThroughput("save blocks one by one", 10, FlushMode::Every_Block);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, StateChangeThroughput_GroupCommitSmallChainParts) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureStateChangeThroughput("save blocks with group commits (small chain parts)", 10, FlushMode::State_Change);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, StateChangeThroughput_GroupCommitLargeChainParts) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureStateChangeThroughput("save blocks with group commits (large chain parts)", 100, FlushMode::State_Change);
+	}
+}}
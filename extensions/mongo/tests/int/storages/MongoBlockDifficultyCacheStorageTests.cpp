@@ -63,6 +63,8 @@ namespace catapult { namespace mongo { namespace storages {
 			void saveBlocks() {
 				for (const auto& blockElement : m_blockElements)
 					m_pDbStorage->saveBlock(blockElement);
+
+				m_pDbStorage->flush();
 			}
 
 			const std::vector<model::BlockElement>& elements() {
@@ -75,7 +77,7 @@ namespace catapult { namespace mongo { namespace storages {
 			std::unique_ptr<MongoStorageContext> m_pMongoContext;
 			mongo::MongoTransactionRegistry m_transactionRegistry;
 			std::unique_ptr<ExternalCacheStorage> m_pCacheStorage;
-			std::unique_ptr<io::LightBlockStorage> m_pDbStorage;
+			std::unique_ptr<MongoBlockStorage> m_pDbStorage;
 		};
 
 		auto ToBlockDifficultyInfo(const model::Block& block) {
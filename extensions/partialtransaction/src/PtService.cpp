@@ -34,14 +34,14 @@ namespace catapult { namespace partialtransaction {
 
 	namespace {
 		constexpr auto Service_Name = "api.partial";
+		constexpr auto Service_Id = ionet::ServiceIdentifier(0x50415254);
 
 		thread::Task CreateConnectPeersTask(extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& connectionsConfig = state.config().Node.OutgoingConnections;
 			auto& nodes = state.nodes();
 
-			auto serviceId = ionet::ServiceIdentifier(0x50415254);
-			auto selector = extensions::CreateNodeSelector(serviceId, ionet::NodeRoles::Api, connectionsConfig, nodes);
-			auto task = extensions::CreateConnectPeersTask(nodes, packetWriters, serviceId, selector);
+			auto selector = extensions::CreateNodeSelector(Service_Id, ionet::NodeRoles::Api, connectionsConfig, nodes);
+			auto task = extensions::CreateConnectPeersTask(nodes, packetWriters, Service_Id, selector);
 			task.Name += " for service Pt";
 			return task;
 		}
@@ -62,6 +62,7 @@ namespace catapult { namespace partialtransaction {
 					std::move(ptSynchronizer),
 					api::CreateRemotePtApi,
 					packetWriters,
+					Service_Id,
 					state,
 					task.Name);
 			return task;
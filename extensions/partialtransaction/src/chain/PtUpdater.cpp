@@ -27,14 +27,30 @@
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/utils/ArraySet.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/utils/MemoryUtils.h"
 #include <boost/asio.hpp>
+#include <unordered_map>
 
 namespace catapult { namespace chain {
 
 	namespace {
 		using DetachedCosignatures = std::vector<model::DetachedCosignature>;
+		using CosignatureUpdateResults = std::vector<CosignatureUpdateResult>;
+
+		std::vector<bool> VerifyAll(const DetachedCosignatures& cosignatures, const std::vector<size_t>& indexes) {
+			// verify each cosignature individually because batch verification can accept signatures with crafted small order
+			// components that are rejected by the single verification used when the aggregate is validated
+			std::vector<bool> verifyResults;
+			verifyResults.reserve(indexes.size());
+			for (auto index : indexes) {
+				const auto& cosignature = cosignatures[index];
+				verifyResults.push_back(crypto::Verify(cosignature.Signer, cosignature.ParentHash, cosignature.Signature));
+			}
+
+			return verifyResults;
+		}
 
 		std::shared_ptr<const model::AggregateTransaction> RemoveCosignatures(
 				const std::shared_ptr<const model::AggregateTransaction>& pAggregateTransaction) {
@@ -197,40 +213,107 @@ namespace catapult { namespace chain {
 
 	public:
 		thread::future<CosignatureUpdateResult> update(const model::DetachedCosignature& cosignature) {
-			auto pPromise = std::make_shared<thread::promise<CosignatureUpdateResult>>(); // needs to be copyable to pass to post
+			return updateGroup({ cosignature }).then([](auto&& resultsFuture) {
+				return resultsFuture.get()[0];
+			});
+		}
+
+		thread::future<CosignatureUpdateResults> update(const DetachedCosignatures& cosignatures) {
+			// group cosignatures by aggregate hash so that each group is processed by a single task
+			std::vector<DetachedCosignatures> groups;
+			std::vector<std::vector<size_t>> groupIndexes;
+			std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> aggregateHashToGroupIdMap;
+			for (auto i = 0u; i < cosignatures.size(); ++i) {
+				const auto& cosignature = cosignatures[i];
+				auto groupIdPair = aggregateHashToGroupIdMap.emplace(cosignature.ParentHash, groups.size());
+				if (groupIdPair.second) {
+					groups.emplace_back();
+					groupIndexes.emplace_back();
+				}
+
+				groups[groupIdPair.first->second].push_back(cosignature);
+				groupIndexes[groupIdPair.first->second].push_back(i);
+			}
+
+			std::vector<thread::future<CosignatureUpdateResults>> futures;
+			for (auto& group : groups)
+				futures.push_back(updateGroup(std::move(group)));
+
+			auto numCosignatures = cosignatures.size();
+			return thread::when_all(std::move(futures)).then([numCosignatures, groupIndexes](auto&& groupResultsFuture) {
+				CosignatureUpdateResults results(numCosignatures, CosignatureUpdateResult::Error);
+				auto groupResultsFutures = groupResultsFuture.get();
+				for (auto i = 0u; i < groupResultsFutures.size(); ++i) {
+					auto groupResults = groupResultsFutures[i].get();
+					for (auto j = 0u; j < groupResults.size(); ++j)
+						results[groupIndexes[i][j]] = groupResults[j];
+				}
+
+				return results;
+			});
+		}
+
+	private:
+		// all cosignatures in a group are expected to have the same parent (aggregate) hash
+		thread::future<CosignatureUpdateResults> updateGroup(DetachedCosignatures&& cosignatures) {
+			auto pPromise = std::make_shared<thread::promise<CosignatureUpdateResults>>(); // needs to be copyable to pass to post
 			auto updateFuture = pPromise->get_future();
 
-			m_pPool->service().post([pThis = shared_from_this(), cosignature, pPromise]() {
-				auto result = pThis->updateImpl(cosignature);
-				pPromise->set_value(std::move(result));
+			m_pPool->service().post([pThis = shared_from_this(), cosignatures = std::move(cosignatures), pPromise]() {
+				auto results = pThis->updateImpl(cosignatures);
+				pPromise->set_value(std::move(results));
 			});
 
 			return updateFuture;
 		}
 
-	private:
-		CosignatureUpdateResult updateImpl(const model::DetachedCosignature& cosignature) {
-			auto eligiblityResult = checkEligibility(cosignature);
+		CosignatureUpdateResults updateImpl(const DetachedCosignatures& cosignatures) {
+			CosignatureUpdateResults results(cosignatures.size(), CosignatureUpdateResult::Error);
+
+			// 1. check the eligibility of each cosignature individually
+			std::vector<size_t> eligibleIndexes;
+			for (auto i = 0u; i < cosignatures.size(); ++i) {
+				const auto& cosignature = cosignatures[i];
+				auto eligiblityResult = checkEligibility(cosignature);
 
-			// proactively refresh the cache even if the new cosignature is invalid
-			if (eligiblityResult.isCacheStale() && !eligiblityResult.isPurgeRequired())
-				refreshStaleCacheEntry(eligiblityResult.staleTransactionInfo());
+				// proactively refresh the cache even if the new cosignature is invalid
+				if (eligiblityResult.isCacheStale() && !eligiblityResult.isPurgeRequired())
+					refreshStaleCacheEntry(eligiblityResult.staleTransactionInfo());
 
-			if (!eligiblityResult.isEligibile()) {
-				if (eligiblityResult.isPurgeRequired())
-					remove(cosignature.ParentHash);
+				if (!eligiblityResult.isEligibile()) {
+					if (eligiblityResult.isPurgeRequired())
+						remove(cosignature.ParentHash);
 
-				return eligiblityResult.updateResult();
+					results[i] = eligiblityResult.updateResult();
+					continue;
+				}
+
+				eligibleIndexes.push_back(i);
 			}
 
-			if (!crypto::Verify(cosignature.Signer, cosignature.ParentHash, cosignature.Signature)) {
+			if (eligibleIndexes.empty())
+				return results;
+
+			// 2. verify all eligible cosignatures
+			std::vector<size_t> verifiedIndexes;
+			auto verifyResults = VerifyAll(cosignatures, eligibleIndexes);
+			for (auto i = 0u; i < eligibleIndexes.size(); ++i) {
+				auto index = eligibleIndexes[i];
+				if (verifyResults[i]) {
+					verifiedIndexes.push_back(index);
+					continue;
+				}
+
+				const auto& cosignature = cosignatures[index];
 				CATAPULT_LOG(debug)
 						<< "ignoring unverifiable cosignature (signer = " << utils::HexFormat(cosignature.Signer)
 						<< ", parentHash = " << utils::HexFormat(cosignature.ParentHash) << ")";
-				return CosignatureUpdateResult::Unverifiable;
+				results[index] = CosignatureUpdateResult::Unverifiable;
 			}
 
-			return addCosignature(cosignature);
+			// 3. add all verified cosignatures under a single cache lock and check completeness once
+			addCosignatures(cosignatures, verifiedIndexes, results);
+			return results;
 		}
 
 		thread::future<TransactionUpdateResult> update(
@@ -239,14 +322,10 @@ namespace catapult { namespace chain {
 			if (cosignatures.empty())
 				return thread::make_ready_future(TransactionUpdateResult{ updateType, 0u });
 
-			std::vector<thread::future<CosignatureUpdateResult>> futures;
-			for (const auto& cosignature : cosignatures)
-				futures.emplace_back(update(cosignature));
-
-			return thread::when_all(std::move(futures)).then([updateType](auto&& resultsFuture) {
+			// all cosignatures extracted from an aggregate share its hash, so they form a single group
+			return updateGroup(DetachedCosignatures(cosignatures)).then([updateType](auto&& resultsFuture) {
 				auto results = resultsFuture.get();
-				auto numCosignaturesAdded = std::count_if(results.begin(), results.end(), [](auto& resultFuture) {
-					auto result = resultFuture.get();
+				auto numCosignaturesAdded = std::count_if(results.cbegin(), results.cend(), [](auto result) {
 					return CosignatureUpdateResult::Added_Incomplete == result || CosignatureUpdateResult::Added_Complete == result;
 				});
 
@@ -254,14 +333,28 @@ namespace catapult { namespace chain {
 			});
 		}
 
-		CosignatureUpdateResult addCosignature(const model::DetachedCosignature& cosignature) {
+		void addCosignatures(
+				const DetachedCosignatures& cosignatures,
+				const std::vector<size_t>& indexes,
+				CosignatureUpdateResults& results) {
+			auto lastAddedIndex = cosignatures.size();
 			{
 				auto modifier = m_transactionsCache.modifier();
-				if (!modifier.add(cosignature.ParentHash, cosignature.Signer, cosignature.Signature))
-					return CosignatureUpdateResult::Redundant;
+				for (auto index : indexes) {
+					const auto& cosignature = cosignatures[index];
+					if (!modifier.add(cosignature.ParentHash, cosignature.Signer, cosignature.Signature)) {
+						results[index] = CosignatureUpdateResult::Redundant;
+						continue;
+					}
+
+					results[index] = CosignatureUpdateResult::Added_Incomplete;
+					lastAddedIndex = index;
+				}
 			}
 
-			return checkCompleteness(cosignature.ParentHash);
+			// only the last added cosignature can complete the owning transaction
+			if (cosignatures.size() != lastAddedIndex)
+				results[lastAddedIndex] = checkCompleteness(cosignatures[lastAddedIndex].ParentHash);
 		}
 
 	private:
@@ -416,4 +509,8 @@ namespace catapult { namespace chain {
 	thread::future<CosignatureUpdateResult> PtUpdater::update(const model::DetachedCosignature& cosignature) {
 		return m_pImpl->update(cosignature);
 	}
+
+	thread::future<std::vector<CosignatureUpdateResult>> PtUpdater::update(const std::vector<model::DetachedCosignature>& cosignatures) {
+		return m_pImpl->update(cosignatures);
+	}
 }}
@@ -553,7 +553,7 @@ namespace catapult { namespace chain {
 
 		EXPECT_TRUE(context.completedTransactions().empty());
 		EXPECT_TRUE(context.failedTransactionStatuses().empty());
-		context.validator().assertCalls(*pTransaction, transactionInfo.EntityHash, { 1, 6, 3 });
+		context.validator().assertCalls(*pTransaction, transactionInfo.EntityHash, { 1, 4, 3 });
 	}
 
 	TEST(TEST_CLASS, CanAddCompleteAggregateWithoutCosignatures) {
@@ -587,7 +587,7 @@ namespace catapult { namespace chain {
 		test::FixCosignatures(transactionInfo.EntityHash, *pTransaction);
 
 		// - mark the transaction as complete
-		context.validator().setValidateCosignersResult(CosignersValidationResult::Success, 6);
+		context.validator().setValidateCosignersResult(CosignersValidationResult::Success, 4);
 
 		// Act:
 		auto result = context.updater().update(transactionInfo).get();
@@ -603,7 +603,7 @@ namespace catapult { namespace chain {
 			pCosignatures[0], pCosignatures[1], pCosignatures[2]
 		});
 		EXPECT_TRUE(context.failedTransactionStatuses().empty());
-		context.validator().assertCalls(*pTransaction, transactionInfo.EntityHash, { 1, 6, 3 });
+		context.validator().assertCalls(*pTransaction, transactionInfo.EntityHash, { 1, 4, 3 });
 	}
 
 	// endregion
@@ -642,7 +642,7 @@ namespace catapult { namespace chain {
 
 			EXPECT_TRUE(context.completedTransactions().empty());
 			EXPECT_TRUE(context.failedTransactionStatuses().empty());
-			context.validator().assertCalls(transaction1, { 0, 4, 3 + 2 });
+			context.validator().assertCalls(transaction1, { 0, 3, 3 + 2 });
 		});
 	}
 
@@ -669,7 +669,7 @@ namespace catapult { namespace chain {
 
 			EXPECT_TRUE(context.completedTransactions().empty());
 			EXPECT_TRUE(context.failedTransactionStatuses().empty());
-			context.validator().assertCalls(transaction1, { 0, 4, 3 + 2 });
+			context.validator().assertCalls(transaction1, { 0, 3, 3 + 2 });
 		});
 	}
 
@@ -677,7 +677,7 @@ namespace catapult { namespace chain {
 		// Arrange:
 		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo1, const auto& transaction1) {
 			// - mark the transaction as complete
-			context.validator().setValidateCosignersResult(CosignersValidationResult::Success, 4);
+			context.validator().setValidateCosignersResult(CosignersValidationResult::Success, 3);
 
 			// Act: add a second transaction with same hash
 			auto pTransaction2 = CreateRandomAggregateTransaction(2);
@@ -698,7 +698,7 @@ namespace catapult { namespace chain {
 				pCosignatures2[0], pCosignatures2[1]
 			});
 			EXPECT_TRUE(context.failedTransactionStatuses().empty());
-			context.validator().assertCalls(transaction1, { 0, 4, 3 + 2 });
+			context.validator().assertCalls(transaction1, { 0, 3, 3 + 2 });
 		});
 	}
 
@@ -734,11 +734,9 @@ namespace catapult { namespace chain {
 			ExpectedValidatorCalls expectedValidatorCalls;
 			expectedValidatorCalls.NumValidatePartialCalls.setExactMatch(1); // 1 (transaction isValid)
 			// * 1 x 3 (cosig checkEligibility) + 1 x numIneligibleCosigners (ineligible-cosig checkEligibility)
-			// * 1 x 2 (valid-cosig isComplete)
-			expectedValidatorCalls.NumValidateCosignersCalls.setExactMatch(5 + numIneligibleCosigners);
-			// * 1: { Valid, Valid, Invalid } - last call only with ineligible cosignature
-			// * 2: { Valid, Invalid, Valid }, { Invalid, Valid, Valid } - invalid cosignature is excluded from subsequent calls
-			expectedValidatorCalls.NumLastCosigners.setInclusiveRangeMatch(1, 2);
+			// * 1 (isComplete after all valid cosignatures are added)
+			expectedValidatorCalls.NumValidateCosignersCalls.setExactMatch(4 + numIneligibleCosigners);
+			expectedValidatorCalls.NumLastCosigners.setExactMatch(2); // 2 (valid cosigs)
 			context.validator().assertCalls(*pTransaction, transactionInfo.EntityHash, expectedValidatorCalls);
 		}
 	}
@@ -781,7 +779,7 @@ namespace catapult { namespace chain {
 
 		EXPECT_TRUE(context.completedTransactions().empty());
 		EXPECT_TRUE(context.failedTransactionStatuses().empty());
-		context.validator().assertCalls(*pTransaction, transactionInfo.EntityHash, { 1, 4, 2 });
+		context.validator().assertCalls(*pTransaction, transactionInfo.EntityHash, { 1, 3, 2 });
 	}
 
 	// endregion
@@ -1277,6 +1275,145 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region update cosignatures - grouped
+
+	TEST(TEST_CLASS, AddingCosignaturesWithMatchingTransactionAddsAllCosignaturesToTransaction) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create compatible cosignatures
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < 3; ++i)
+				cosignatures.push_back(test::GenerateValidCosignature(transactionInfo.EntityHash));
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert: all cosignatures were added
+			std::vector<CosignatureUpdateResult> expectedResults(3, CosignatureUpdateResult::Added_Incomplete);
+			EXPECT_EQ(expectedResults, results);
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2],
+				cosignatures[0], cosignatures[1], cosignatures[2]
+			});
+			context.assertTransactionInCacheHasCorrectExtendedProperties(transactionInfo);
+
+			EXPECT_TRUE(context.completedTransactions().empty());
+			EXPECT_TRUE(context.failedTransactionStatuses().empty());
+
+			// - 3 (cosig checkEligibility) + 1 (isComplete after all cosignatures are added)
+			context.validator().assertCalls(transaction, { 0, 4, 3 + 3 });
+		});
+	}
+
+	TEST(TEST_CLASS, AddingCosignaturesWithMatchingTransactionCompletesTransactionOnce) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create compatible cosignatures
+			std::vector<model::DetachedCosignature> cosignatures;
+			for (auto i = 0u; i < 3; ++i)
+				cosignatures.push_back(test::GenerateValidCosignature(transactionInfo.EntityHash));
+
+			// - mark the transaction as complete when checked after all cosignatures are added
+			context.validator().setValidateCosignersResult(CosignersValidationResult::Success, 4);
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert: all cosignatures were added and the last one completed the transaction
+			std::vector<CosignatureUpdateResult> expectedResults{
+				CosignatureUpdateResult::Added_Incomplete,
+				CosignatureUpdateResult::Added_Incomplete,
+				CosignatureUpdateResult::Added_Complete
+			};
+			EXPECT_EQ(expectedResults, results);
+
+			EXPECT_EQ(0u, context.transactionsCache().view().size());
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			ASSERT_EQ(1u, context.completedTransactions().size());
+			test::AssertStitchedTransaction(*context.completedTransactions()[0], transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2],
+				cosignatures[0], cosignatures[1], cosignatures[2]
+			});
+			EXPECT_TRUE(context.failedTransactionStatuses().empty());
+			context.validator().assertCalls(transaction, { 0, 4, 3 + 3 });
+		});
+	}
+
+	TEST(TEST_CLASS, AddingCosignaturesPreservesResultOrder) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// - create a mix of valid, unverifiable, redundant and unmatched cosignatures
+			const auto& existingCosignature = transaction.CosignaturesPtr()[1];
+			std::vector<model::DetachedCosignature> cosignatures{
+				test::GenerateValidCosignature(transactionInfo.EntityHash),
+				test::GenerateValidCosignature(test::GenerateRandomData<Hash256_Size>()),
+				test::GenerateValidCosignature(transactionInfo.EntityHash),
+				{ existingCosignature.Signer, existingCosignature.Signature, transactionInfo.EntityHash },
+				test::GenerateValidCosignature(transactionInfo.EntityHash)
+			};
+			cosignatures[2].Signature[0] ^= 0xFF;
+
+			// Act:
+			auto results = context.updater().update(cosignatures).get();
+
+			// Assert:
+			std::vector<CosignatureUpdateResult> expectedResults{
+				CosignatureUpdateResult::Added_Incomplete,
+				CosignatureUpdateResult::Ineligible,
+				CosignatureUpdateResult::Unverifiable,
+				CosignatureUpdateResult::Redundant,
+				CosignatureUpdateResult::Added_Incomplete
+			};
+			EXPECT_EQ(expectedResults, results);
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2],
+				cosignatures[0], cosignatures[4]
+			});
+
+			EXPECT_TRUE(context.completedTransactions().empty());
+			EXPECT_TRUE(context.failedTransactionStatuses().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, AddingCosignaturesCanUpdateMultipleTransactions) {
+		// Arrange:
+		UpdaterTestContext context;
+		std::vector<std::shared_ptr<model::AggregateTransaction>> transactions;
+		std::vector<model::TransactionInfo> transactionInfos;
+		for (auto i = 0u; i < 2; ++i) {
+			transactions.push_back(CreateRandomAggregateTransaction(0));
+			transactionInfos.push_back(CreateRandomTransactionInfo(transactions.back()));
+			context.updater().update(transactionInfos.back()).get();
+		}
+
+		// - interleave cosignatures for both transactions
+		std::vector<model::DetachedCosignature> cosignatures;
+		for (auto i = 0u; i < 5; ++i)
+			cosignatures.push_back(test::GenerateValidCosignature(transactionInfos[i % 2].EntityHash));
+
+		// Act:
+		auto results = context.updater().update(cosignatures).get();
+
+		// Assert:
+		std::vector<CosignatureUpdateResult> expectedResults(5, CosignatureUpdateResult::Added_Incomplete);
+		EXPECT_EQ(expectedResults, results);
+
+		auto view = context.transactionsCache().view();
+		EXPECT_EQ(2u, view.size());
+		EXPECT_EQ(3u, view.find(transactionInfos[0].EntityHash).cosignatures().size());
+		EXPECT_EQ(2u, view.find(transactionInfos[1].EntityHash).cosignatures().size());
+
+		EXPECT_TRUE(context.completedTransactions().empty());
+		EXPECT_TRUE(context.failedTransactionStatuses().empty());
+	}
+
+	// endregion
+
 	// region threading
 
 	TEST(TEST_CLASS, FuturesAreFulfilledEvenIfUpdaterIsDestroyed) {
@@ -43,6 +43,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/ExtractedAddressesCache.h"
 #include "catapult/plugins/PluginManager.h"
 #include "catapult/subscribers/StateChangeSubscriber.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
@@ -56,12 +57,15 @@ using namespace catapult::disruptor;
 namespace catapult { namespace sync {
 
 	namespace {
+		constexpr auto Addresses_Cache_Service_Name = "dispatcher.addressesCache";
+
 		// region utils
 
 		ConsumerDispatcherOptions CreateBlockConsumerDispatcherOptions(const config::NodeConfiguration& config) {
 			auto options = ConsumerDispatcherOptions("block dispatcher", config.BlockDisruptorSize);
 			options.ElementTraceInterval = config.BlockElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.WaitStrategy = config.BlockDisruptorWaitStrategy;
 			return options;
 		}
 
@@ -69,6 +73,7 @@ namespace catapult { namespace sync {
 			auto options = ConsumerDispatcherOptions("transaction dispatcher", config.TransactionDisruptorSize);
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowIfFull = config.ShouldAbortWhenDispatcherIsFull;
+			options.WaitStrategy = config.TransactionDisruptorWaitStrategy;
 			return options;
 		}
 
@@ -170,8 +175,8 @@ namespace catapult { namespace sync {
 					extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
 			}
 
-			void addPrecomputedTransactionAddressConsumer(const model::NotificationPublisher& publisher) {
-				m_consumers.push_back(CreateBlockAddressExtractionConsumer(publisher));
+			void addPrecomputedTransactionAddressConsumer(model::ExtractedAddressesCache& addressesCache) {
+				m_consumers.push_back(CreateBlockAddressExtractionConsumer(addressesCache));
 			}
 
 			std::shared_ptr<ConsumerDispatcher> build(
@@ -248,8 +253,8 @@ namespace catapult { namespace sync {
 						m_state.hooks().knownHashPredicate(m_state.utCache())));
 			}
 
-			void addPrecomputedTransactionAddressConsumer(const model::NotificationPublisher& publisher) {
-				m_consumers.push_back(CreateTransactionAddressExtractionConsumer(publisher));
+			void addPrecomputedTransactionAddressConsumer(model::ExtractedAddressesCache& addressesCache) {
+				m_consumers.push_back(CreateTransactionAddressExtractionConsumer(addressesCache));
 			}
 
 			std::shared_ptr<ConsumerDispatcher> build(
@@ -305,14 +310,18 @@ namespace catapult { namespace sync {
 
 		// endregion
 
-		chain::UtUpdater& CreateAndRegisterUtUpdater(extensions::ServiceLocator& locator, extensions::ServiceState& state) {
+		chain::UtUpdater& CreateAndRegisterUtUpdater(
+				extensions::ServiceLocator& locator,
+				extensions::ServiceState& state,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
 			auto pUtUpdater = std::make_shared<chain::UtUpdater>(
 					state.utCache(),
 					state.cache(),
 					CreateExecutionConfiguration(state.pluginManager()),
 					state.timeSupplier(),
 					extensions::SubscriberToSink(state.transactionStatusSubscriber()),
-					CreateUtUpdaterThrottle(state.config()));
+					CreateUtUpdaterThrottle(state.config()),
+					pValidatorPool);
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
 			auto& utUpdater = *pUtUpdater;
@@ -345,6 +354,27 @@ namespace catapult { namespace sync {
 			});
 		}
 
+		void AddAddressesCacheCounters(extensions::ServiceLocator& locator) {
+			using AddressesCache = model::ExtractedAddressesCache;
+			locator.registerServiceCounter<AddressesCache>(Addresses_Cache_Service_Name, "ADDR C", [](const auto& cache) {
+				return cache.size();
+			});
+			locator.registerServiceCounter<AddressesCache>(Addresses_Cache_Service_Name, "ADDR HIT", [](const auto& cache) {
+				return cache.statistics().NumHits.load();
+			});
+			locator.registerServiceCounter<AddressesCache>(Addresses_Cache_Service_Name, "ADDR MISS", [](const auto& cache) {
+				return cache.statistics().NumMisses.load();
+			});
+			locator.registerServiceCounter<AddressesCache>(Addresses_Cache_Service_Name, "ADDR HIT PCT", [](const auto& cache) {
+				auto numHits = cache.statistics().NumHits.load();
+				auto numLookups = numHits + cache.statistics().NumMisses.load();
+				return 0 == numLookups ? 0 : numHits * 100 / numLookups;
+			});
+			locator.registerServiceCounter<AddressesCache>(Addresses_Cache_Service_Name, "ADDR EXTR MS", [](const auto& cache) {
+				return cache.statistics().ExtractionMicros.load() / 1000;
+			});
+		}
+
 		class DispatcherServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -359,12 +389,14 @@ namespace catapult { namespace sync {
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB IGNORE RCT", RollbackResult::Ignored, RollbackCounterType::Recent);
+
+				AddAddressesCacheCounters(locator);
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				// create shared services
 				auto pValidatorPool = state.pool().pushIsolatedPool("validator");
-				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state);
+				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state, pValidatorPool);
 
 				// create the block and transaction dispatchers and related services
 				// (notice that the dispatcher service group must be after the validator isolated pool in order to allow proper shutdown)
@@ -377,10 +409,14 @@ namespace catapult { namespace sync {
 				transactionDispatcherBuilder.addHashConsumers();
 
 				if (state.config().Node.ShouldPrecomputeTransactionAddresses) {
+					// addresses extracted from unconfirmed transactions are reused when the transactions are confirmed
 					auto pPublisher = state.pluginManager().createNotificationPublisher();
-					blockDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pPublisher);
-					transactionDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pPublisher);
+					auto maxCacheSize = state.config().Node.UnconfirmedTransactionsCacheMaxSize;
+					auto pAddressesCache = std::make_shared<model::ExtractedAddressesCache>(*pPublisher, maxCacheSize);
+					blockDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pAddressesCache);
+					transactionDispatcherBuilder.addPrecomputedTransactionAddressConsumer(*pAddressesCache);
 					locator.registerRootedService("dispatcher.notificationPublisher", std::move(pPublisher));
+					locator.registerRootedService(Addresses_Cache_Service_Name, pAddressesCache);
 				}
 
 				auto pRollbackInfo = CreateAndRegisterRollbackService(locator, state.timeSupplier(), state.config().BlockChain);
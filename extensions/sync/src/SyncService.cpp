@@ -36,14 +36,14 @@ namespace catapult { namespace sync {
 
 	namespace {
 		constexpr auto Sync_Source = disruptor::InputSource::Remote_Pull;
+		constexpr auto Service_Id = ionet::ServiceIdentifier(0x53594E43);
 
 		thread::Task CreateConnectPeersTask(extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& connectionsConfig = state.config().Node.OutgoingConnections;
 			auto& nodes = state.nodes();
 
-			auto serviceId = ionet::ServiceIdentifier(0x53594E43);
-			auto selector = extensions::CreateNodeSelector(serviceId, ionet::NodeRoles::Peer, connectionsConfig, nodes);
-			auto task = extensions::CreateConnectPeersTask(nodes, packetWriters, serviceId, selector);
+			auto selector = extensions::CreateNodeSelector(Service_Id, ionet::NodeRoles::Peer, connectionsConfig, nodes);
+			auto task = extensions::CreateConnectPeersTask(nodes, packetWriters, Service_Id, selector);
 			task.Name += " for service Sync";
 			return task;
 		}
@@ -52,6 +52,7 @@ namespace catapult { namespace sync {
 			chain::ChainSynchronizerConfiguration chainSynchronizerConfig;
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
+			chainSynchronizerConfig.MaxPendingBlockRequests = config.Node.MaxPendingBlockRequests;
 			chainSynchronizerConfig.MaxRollbackBlocks = config.BlockChain.MaxRollbackBlocks;
 			return chainSynchronizerConfig;
 		}
@@ -72,6 +73,7 @@ namespace catapult { namespace sync {
 					std::move(chainSynchronizer),
 					api::CreateRemoteChainApi,
 					packetWriters,
+					Service_Id,
 					state,
 					task.Name);
 			return task;
@@ -88,6 +90,7 @@ namespace catapult { namespace sync {
 					std::move(utSynchronizer),
 					api::CreateRemoteTransactionApi,
 					packetWriters,
+					Service_Id,
 					state,
 					task.Name);
 			return task;
@@ -24,6 +24,7 @@
 #include "catapult/cache_core/BlockDifficultyCache.h"
 #include "catapult/disruptor/ConsumerDispatcher.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/model/ExtractedAddressesCache.h"
 #include "catapult/plugins/PluginLoader.h"
 #include "catapult/utils/NetworkTime.h"
 #include "tests/test/cache/CacheTestUtils.h"
@@ -44,7 +45,7 @@ namespace catapult { namespace sync {
 
 	namespace {
 		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 8u;
+		constexpr auto Num_Expected_Counters = 13u;
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -55,6 +56,11 @@ namespace catapult { namespace sync {
 		constexpr auto Rollback_Elements_Committed_Recent = "RB COMMIT RCT";
 		constexpr auto Rollback_Elements_Ignored_All = "RB IGNORE ALL";
 		constexpr auto Rollback_Elements_Ignored_Recent = "RB IGNORE RCT";
+		constexpr auto Addresses_Cache_Size_Counter_Name = "ADDR C";
+		constexpr auto Addresses_Cache_Hits_Counter_Name = "ADDR HIT";
+		constexpr auto Addresses_Cache_Misses_Counter_Name = "ADDR MISS";
+		constexpr auto Addresses_Cache_Hit_Percentage_Counter_Name = "ADDR HIT PCT";
+		constexpr auto Addresses_Cache_Extraction_Millis_Counter_Name = "ADDR EXTR MS";
 		constexpr auto Sentinel_Counter_Value = extensions::ServiceLocator::Sentinel_Counter_Value;
 
 		// region utils
@@ -256,6 +262,13 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
 
+		// - addresses cache counters should indicate that the cache is not registered
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Addresses_Cache_Size_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Addresses_Cache_Hits_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Addresses_Cache_Misses_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Addresses_Cache_Hit_Percentage_Counter_Name));
+		EXPECT_EQ(Sentinel_Counter_Value, context.counter(Addresses_Cache_Extraction_Millis_Counter_Name));
+
 		// - block dispatcher should be initialized
 		auto blockDispatcherStatus = GetBlockDispatcherStatus(context.locator());
 		EXPECT_EQ("block dispatcher", blockDispatcherStatus.Name);
@@ -306,15 +319,23 @@ namespace catapult { namespace sync {
 		context.boot();
 
 		// Assert:
-		EXPECT_EQ(Num_Expected_Services + 1, context.locator().numServices());
+		EXPECT_EQ(Num_Expected_Services + 2, context.locator().numServices());
 		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
 		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
 
 		EXPECT_EQ(7u, GetBlockDispatcherStatus(context.locator()).Size);
 		EXPECT_EQ(5u, GetTransactionDispatcherStatus(context.locator()).Size);
 
-		// - notification publisher service should exist
+		// - notification publisher and addresses cache services should exist
 		EXPECT_TRUE(!!context.locator().service<model::NotificationPublisher>("dispatcher.notificationPublisher"));
+		EXPECT_TRUE(!!context.locator().service<model::ExtractedAddressesCache>("dispatcher.addressesCache"));
+
+		// - addresses cache counters should be zero
+		EXPECT_EQ(0u, context.counter(Addresses_Cache_Size_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Addresses_Cache_Hits_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Addresses_Cache_Misses_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Addresses_Cache_Hit_Percentage_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Addresses_Cache_Extraction_Millis_Counter_Name));
 	}
 
 	TEST(TEST_CLASS, CanShutdownService) {
@@ -20,6 +20,7 @@
 
 #include "CoreSystem.h"
 #include "handlers/CoreDiagnosticHandlers.h"
+#include "observers/ImportanceCalculator.h"
 #include "observers/Observers.h"
 #include "validators/Validators.h"
 #include "catapult/cache_core/AccountStateCacheStorage.h"
@@ -55,6 +56,19 @@ namespace catapult { namespace plugins {
 			});
 		}
 
+		void AddImportanceCalculatorCounters(
+				PluginManager& manager,
+				const std::shared_ptr<observers::ImportanceCalculatorStatistics>& pStatistics) {
+			manager.addDiagnosticCounterHook([pStatistics](auto& counters, const cache::CatapultCache&) {
+				counters.emplace_back(utils::DiagnosticCounterId("IMPCALC MS"), [pStatistics]() {
+					return pStatistics->ElapsedMillis.load();
+				});
+				counters.emplace_back(utils::DiagnosticCounterId("IMPCALC ACCTS"), [pStatistics]() {
+					return pStatistics->NumCalculatedAccounts.load();
+				});
+			});
+		}
+
 		void AddBlockDifficultyCache(PluginManager& manager, const model::BlockChainConfiguration& config) {
 			using namespace catapult::cache;
 
@@ -72,7 +86,10 @@ namespace catapult { namespace plugins {
 	void RegisterCoreSystem(PluginManager& manager) {
 		const auto& config = manager.config();
 
+		auto pImportanceCalculatorStatistics = std::make_shared<observers::ImportanceCalculatorStatistics>();
+
 		AddAccountStateCache(manager, config);
+		AddImportanceCalculatorCounters(manager, pImportanceCalculatorStatistics);
 		AddBlockDifficultyCache(manager, config);
 
 		manager.addStatelessValidatorHook([&config](auto& builder) {
@@ -99,9 +116,9 @@ namespace catapult { namespace plugins {
 				.add(observers::CreateHarvestFeeObserver());
 		});
 
-		manager.addTransientObserverHook([&config](auto& builder) {
+		manager.addTransientObserverHook([&config, pImportanceCalculatorStatistics](auto& builder) {
 			auto pRecalculateImportancesObserver = observers::CreateRecalculateImportancesObserver(
-					observers::CreateImportanceCalculator(config),
+					observers::CreateImportanceCalculator(config, pImportanceCalculatorStatistics),
 					observers::CreateRestoreImportanceCalculator());
 			builder
 				.add(std::move(pRecalculateImportancesObserver))
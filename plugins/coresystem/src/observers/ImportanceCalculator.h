@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/model/ImportanceHeight.h"
 #include "catapult/types.h"
+#include <atomic>
 #include <memory>
 
 namespace catapult {
@@ -41,9 +42,32 @@ namespace catapult { namespace observers {
 		virtual void recalculate(model::ImportanceHeight importanceHeight, cache::AccountStateCacheDelta& cache) const = 0;
 	};
 
+	/// Statistics about the most recent importance recalculation.
+	struct ImportanceCalculatorStatistics {
+	public:
+		/// Creates zeroed statistics.
+		ImportanceCalculatorStatistics()
+				: ElapsedMillis(0)
+				, NumCalculatedAccounts(0)
+		{}
+
+	public:
+		/// Number of milliseconds spent in the recalculation.
+		std::atomic<uint64_t> ElapsedMillis;
+
+		/// Number of accounts with calculated importances.
+		std::atomic<uint64_t> NumCalculatedAccounts;
+	};
+
 	/// Creates an importance calculator for the block chain described by \a config.
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config);
 
+	/// Creates an importance calculator for the block chain described by \a config that updates \a statistics
+	/// after each recalculation.
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			const std::shared_ptr<ImportanceCalculatorStatistics>& pStatistics);
+
 	/// Creates a restore importance calculator.
 	std::unique_ptr<ImportanceCalculator> CreateRestoreImportanceCalculator();
 }}
@@ -20,6 +20,7 @@
 
 #include "ImportanceCalculator.h"
 #include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/exceptions.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/ImportanceHeight.h"
 #include "catapult/state/AccountImportance.h"
@@ -31,9 +32,96 @@
 namespace catapult { namespace observers {
 
 	namespace {
+		// region FixedPointDivider
+
+		struct UInt128 {
+			uint64_t High;
+			uint64_t Low;
+		};
+
+		UInt128 Multiply(uint64_t lhs, uint64_t rhs) {
+#ifdef __SIZEOF_INT128__
+			auto product = static_cast<unsigned __int128>(lhs) * rhs;
+			return { static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product) };
+#else
+			constexpr uint64_t Low_Mask = 0xFFFF'FFFF;
+			auto lowLow = (lhs & Low_Mask) * (rhs & Low_Mask);
+			auto highLow = (lhs >> 32) * (rhs & Low_Mask);
+			auto lowHigh = (lhs & Low_Mask) * (rhs >> 32);
+			auto highHigh = (lhs >> 32) * (rhs >> 32);
+
+			auto middle = (lowLow >> 32) + (highLow & Low_Mask) + (lowHigh & Low_Mask);
+			return { highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32), (middle << 32) | (lowLow & Low_Mask) };
+#endif
+		}
+
+		uint8_t CountLeadingZeros(uint64_t value) {
+			uint8_t numLeadingZeros = 0;
+			for (auto mask = static_cast<uint64_t>(1) << 63; 0 != mask && 0 == (value & mask); mask >>= 1)
+				++numLeadingZeros;
+
+			return numLeadingZeros;
+		}
+
+		/// Divides 128 bit dividends by a fixed 64 bit divisor using a precomputed fixed-point reciprocal.
+		/// \note This is the 2-by-1 division with a precomputed reciprocal by Moller and Granlund,
+		///       so every quotient is exact and equal to the one produced by a regular division.
+		class FixedPointDivider {
+		public:
+			/// Creates a divider around \a divisor, which must be nonzero.
+			explicit FixedPointDivider(uint64_t divisor)
+					: m_shift(CountLeadingZeros(divisor))
+					, m_divisor(divisor << m_shift) {
+				if (0 == divisor)
+					CATAPULT_THROW_INVALID_ARGUMENT("divisor must be nonzero");
+
+				// reciprocal = floor((2^128 - 1) / divisor) - 2^64 (with normalized divisor)
+				boost::multiprecision::uint128_t numerator = ~m_divisor;
+				numerator <<= 64;
+				numerator |= ~static_cast<uint64_t>(0);
+				m_reciprocal = static_cast<uint64_t>(numerator / m_divisor);
+			}
+
+		public:
+			/// Divides \a dividend by the divisor.
+			/// \note The quotient must fit into 64 bits.
+			uint64_t divide(const UInt128& dividend) const {
+				// normalize the dividend (shifting cannot overflow because the quotient fits into 64 bits)
+				auto high = 0 == m_shift ? dividend.High : (dividend.High << m_shift) | (dividend.Low >> (64 - m_shift));
+				auto low = dividend.Low << m_shift;
+
+				// estimate the quotient from the reciprocal and correct it at most twice
+				auto estimate = Multiply(m_reciprocal, high);
+				auto estimateLow = estimate.Low + low;
+				auto quotient = estimate.High + high + 1 + (estimateLow < low ? 1 : 0);
+
+				// first correction is frequent and unpredictable, so apply it without branching
+				auto remainder = low - quotient * m_divisor;
+				auto correctionMask = static_cast<uint64_t>(0) - (remainder > estimateLow ? 1 : 0);
+				quotient += correctionMask;
+				remainder += correctionMask & m_divisor;
+
+				if (remainder >= m_divisor)
+					++quotient;
+
+				return quotient;
+			}
+
+		private:
+			uint8_t m_shift;
+			uint64_t m_divisor;
+			uint64_t m_reciprocal;
+		};
+
+		// endregion
+
 		class PosImportanceCalculator final : public ImportanceCalculator {
 		public:
-			explicit PosImportanceCalculator(const model::BlockChainConfiguration& config) : m_totalChainBalance(config.TotalChainBalance)
+			PosImportanceCalculator(
+					const model::BlockChainConfiguration& config,
+					const std::shared_ptr<ImportanceCalculatorStatistics>& pStatistics)
+					: m_totalChainBalance(config.TotalChainBalance)
+					, m_pStatistics(pStatistics)
 			{}
 
 		public:
@@ -43,34 +131,54 @@ namespace catapult { namespace observers {
 				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
 				auto highValueAddresses = cache.highValueAddresses();
 				std::vector<state::AccountState*> highValueAccounts;
+				std::vector<Amount::ValueType> balances;
 				highValueAccounts.reserve(highValueAddresses.size());
+				balances.reserve(highValueAddresses.size());
 
 				// 2. calculate sum
 				Amount activeXem;
 				for (const auto& address : highValueAddresses) {
 					auto& accountState = cache.get(address);
 					highValueAccounts.push_back(&accountState);
-					activeXem = activeXem + accountState.Balances.get(Xem_Id);
+					balances.push_back(accountState.Balances.get(Xem_Id).unwrap());
+					activeXem = activeXem + Amount(balances.back());
 				}
 
 				// 3. update accounts
-				for (auto* pAccountState : highValueAccounts) {
-					boost::multiprecision::uint128_t importance = m_totalChainBalance.microxem().unwrap();
-					importance *= pAccountState->Balances.get(Xem_Id).unwrap();
-					importance /= activeXem.unwrap();
-					importance /= utils::XemUnit(utils::XemAmount(1)).microxem().unwrap();
-					pAccountState->ImportanceInfo.set(Importance(static_cast<Importance::ValueType>(importance)), importanceHeight);
+				//    importance = floor(floor(totalChainBalance * balance / activeXem) / microxem per xem)
+				//    every balance is part of activeXem, so the inner quotient cannot exceed totalChainBalance
+				if (!highValueAccounts.empty()) {
+					constexpr auto Microxem_Per_Xem = utils::XemUnit(utils::XemAmount(1)).microxem().unwrap();
+					auto totalChainBalance = m_totalChainBalance.microxem().unwrap();
+					FixedPointDivider divider(activeXem.unwrap());
+					for (auto i = 0u; i < highValueAccounts.size(); ++i) {
+						auto importance = divider.divide(Multiply(totalChainBalance, balances[i])) / Microxem_Per_Xem;
+						highValueAccounts[i]->ImportanceInfo.set(Importance(importance), importanceHeight);
+					}
 				}
 
 				CATAPULT_LOG(debug) << "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)";
+
+				// 4. update statistics
+				if (m_pStatistics) {
+					m_pStatistics->ElapsedMillis = stopwatch.millis();
+					m_pStatistics->NumCalculatedAccounts = highValueAccounts.size();
+				}
 			}
 
 		private:
 			const utils::XemUnit m_totalChainBalance;
+			std::shared_ptr<ImportanceCalculatorStatistics> m_pStatistics;
 		};
 	}
 
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockChainConfiguration& config) {
-		return std::make_unique<PosImportanceCalculator>(config);
+		return CreateImportanceCalculator(config, nullptr);
+	}
+
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockChainConfiguration& config,
+			const std::shared_ptr<ImportanceCalculatorStatistics>& pStatistics) {
+		return std::make_unique<PosImportanceCalculator>(config, pStatistics);
 	}
 }}
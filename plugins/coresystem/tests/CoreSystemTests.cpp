@@ -51,7 +51,7 @@ namespace catapult { namespace plugins {
 			}
 
 			static std::vector<std::string> GetDiagnosticCounterNames() {
-				return { "ACNTST C", "BLKDIF C" };
+				return { "ACNTST C", "IMPCALC MS", "IMPCALC ACCTS", "BLKDIF C" };
 			}
 
 			static std::vector<std::string> GetStatelessValidatorNames() {
@@ -0,0 +1,109 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/observers/ImportanceCalculator.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace observers {
+
+#define TEST_CLASS PosImportanceCalculatorThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr uint32_t Num_Accounts = 1'000'000;
+#else
+		constexpr uint32_t Num_Accounts = 200'000;
+#endif
+
+		constexpr uint32_t Num_Recalculations = 10;
+		constexpr Amount Min_Harvester_Balance(1'000'000'000);
+
+		model::BlockChainConfiguration CreateConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.TotalChainBalance = utils::XemAmount(9'000'000'000);
+			config.MinHarvesterBalance = Min_Harvester_Balance;
+			return config;
+		}
+
+		void SeedCache(cache::AccountStateCache& cache, uint32_t numEligibleAccounts) {
+			utils::StackLogger stopwatch("seed account state cache", utils::LogLevel::Info);
+			auto delta = cache.createDelta();
+			for (auto i = 0u; i < Num_Accounts; ++i) {
+				auto& accountState = delta->addAccount(test::GenerateRandomData<Key_Size>(), Height(1));
+
+				// only the first accounts have sufficient balance to be eligible for harvesting
+				auto balance = Amount((i < numEligibleAccounts ? Min_Harvester_Balance.unwrap() : 0) + test::Random() % 1'000'000'000);
+				accountState.Balances.credit(Xem_Id, balance);
+			}
+
+			cache.commit();
+		}
+
+		void MeasureRecalculation(const char* name, uint32_t numEligibleAccounts) {
+			// Arrange:
+			auto config = CreateConfiguration();
+			auto options = cache::AccountStateCacheTypes::Options{ model::NetworkIdentifier::Mijin_Test, 123, Min_Harvester_Balance };
+			cache::AccountStateCache cache(cache::CacheConfiguration(), options);
+			SeedCache(cache, numEligibleAccounts);
+
+			auto pStatistics = std::make_shared<ImportanceCalculatorStatistics>();
+			auto pCalculator = CreateImportanceCalculator(config, pStatistics);
+			auto delta = cache.createDelta();
+
+			// Act: recalculate importances at consecutive importance heights
+			uint64_t totalElapsedMillis = 0;
+			uint64_t maxElapsedMillis = 0;
+			for (auto i = 1u; i <= Num_Recalculations; ++i) {
+				pCalculator->recalculate(model::ImportanceHeight(i * 123), *delta);
+				totalElapsedMillis += pStatistics->ElapsedMillis;
+				maxElapsedMillis = std::max<uint64_t>(maxElapsedMillis, pStatistics->ElapsedMillis);
+
+				// Sanity:
+				EXPECT_EQ(numEligibleAccounts, pStatistics->NumCalculatedAccounts) << "recalculation " << i;
+			}
+
+			// Assert:
+			CATAPULT_LOG(info)
+					<< name << " recalculated importances of " << numEligibleAccounts << " / " << Num_Accounts << " accounts "
+					<< Num_Recalculations << " times in " << totalElapsedMillis << "ms (max " << maxElapsedMillis << "ms)";
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, RecalculationThroughput_AllAccountsEligible) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureRecalculation("all accounts eligible", Num_Accounts);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, RecalculationThroughput_TenthOfAccountsEligible) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureRecalculation("tenth of accounts eligible", Num_Accounts / 10);
+	}
+}}
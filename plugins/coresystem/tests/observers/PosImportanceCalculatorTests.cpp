@@ -24,6 +24,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkInfo.h"
 #include "tests/TestHarness.h"
+#include <boost/multiprecision/cpp_int.hpp>
 
 namespace catapult { namespace observers {
 
@@ -209,4 +210,87 @@ namespace catapult { namespace observers {
 		// Assert:
 		EXPECT_EQ(importance1 + importance1, importance2);
 	}
+
+	TEST(TEST_CLASS, PosCalculatesExactImportancesForLargeBalances) {
+		// Arrange: use balances that are not multiples of each other and together hold (almost) all xem
+		auto config = CreateConfiguration();
+		auto totalChainBalance = config.TotalChainBalance.microxem().unwrap();
+		std::vector<Amount::ValueType> amounts{
+			totalChainBalance / 3 + 1,
+			totalChainBalance / 7 - 1,
+			totalChainBalance / 11 + 12'345,
+			config.MinHarvesterBalance.unwrap(),
+			config.MinHarvesterBalance.unwrap() + 1,
+			totalChainBalance / 5 + 999'999
+		};
+
+		CacheHolder holder(config.MinHarvesterBalance);
+		holder.seedDelta(amounts, Recalculation_Height);
+		auto pCalculator = CreateImportanceCalculator(config);
+
+		// Act:
+		pCalculator->recalculate(Recalculation_Height, *holder.Delta);
+
+		// Assert: importances match the ones calculated with (slow) 128 bit division
+		Amount::ValueType activeXem = 0;
+		for (auto amount : amounts)
+			activeXem += amount;
+
+		for (uint8_t i = 1; i <= amounts.size(); ++i) {
+			boost::multiprecision::uint128_t expectedImportance = totalChainBalance;
+			expectedImportance *= amounts[i - 1];
+			expectedImportance /= activeXem;
+			expectedImportance /= utils::XemUnit(utils::XemAmount(1)).microxem().unwrap();
+
+			const auto& accountState = holder.get(Key{ { i } });
+			EXPECT_EQ(Importance(static_cast<Importance::ValueType>(expectedImportance)), accountState.ImportanceInfo.current()) << i;
+		}
+	}
+
+	// region statistics
+
+	TEST(TEST_CLASS, PosUpdatesStatisticsAfterRecalculation) {
+		// Arrange: only 6 of 10 accounts have sufficient balance
+		auto config = CreateConfiguration();
+		std::vector<Amount::ValueType> amounts;
+		for (auto i = 1u; i <= Num_Account_States; ++i)
+			amounts.push_back(i * config.MinHarvesterBalance.unwrap() / 5);
+
+		CacheHolder holder(config.MinHarvesterBalance);
+		holder.seedDelta(amounts, Recalculation_Height);
+		auto pStatistics = std::make_shared<ImportanceCalculatorStatistics>();
+		auto pCalculator = CreateImportanceCalculator(config, pStatistics);
+
+		// Act:
+		pCalculator->recalculate(Recalculation_Height, *holder.Delta);
+
+		// Assert:
+		EXPECT_EQ(6u, pStatistics->NumCalculatedAccounts);
+		EXPECT_GE(1000u, pStatistics->ElapsedMillis);
+	}
+
+	TEST(TEST_CLASS, PosCalculatesSameImportancesWithAndWithoutStatistics) {
+		// Arrange:
+		auto config = CreateConfiguration();
+		std::vector<Amount::ValueType> amounts;
+		for (auto i = 1u; i <= Num_Account_States; ++i)
+			amounts.push_back(i * config.MinHarvesterBalance.unwrap());
+
+		CacheHolder holder1(config.MinHarvesterBalance);
+		holder1.seedDelta(amounts, Recalculation_Height);
+		CacheHolder holder2(config.MinHarvesterBalance);
+		holder2.seedDelta(amounts, Recalculation_Height);
+
+		// Act:
+		CreateImportanceCalculator(config)->recalculate(Recalculation_Height, *holder1.Delta);
+		CreateImportanceCalculator(config, std::make_shared<ImportanceCalculatorStatistics>())->recalculate(
+				Recalculation_Height,
+				*holder2.Delta);
+
+		// Assert:
+		for (uint8_t i = 1; i <= Num_Account_States; ++i)
+			EXPECT_EQ(holder1.get(Key{ { i } }).ImportanceInfo.current(), holder2.get(Key{ { i } }).ImportanceInfo.current()) << i;
+	}
+
+	// endregion
 }}
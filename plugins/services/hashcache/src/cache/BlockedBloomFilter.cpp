@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockedBloomFilter.h"
+#include <algorithm>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr size_t Cache_Line_Size = 64;
+		constexpr size_t Words_Per_Block = Cache_Line_Size / sizeof(uint64_t);
+		constexpr size_t Bits_Per_Block = Cache_Line_Size * 8;
+		constexpr size_t Bits_Per_Key = 16;
+
+		// each bit index within a block is composed of 9 bits, so six of them can be taken from a single 64-bit value
+		constexpr size_t Num_Bits_Per_Key_Set = 6;
+		constexpr size_t Bit_Index_Size = 9;
+		constexpr uint64_t Bit_Index_Multiplier = 0x9E3779B97F4A7C15;
+
+		size_t CalculateNumBlocks(size_t capacity) {
+			// use a power of two number of blocks so that a block can be selected with a mask
+			size_t numBlocks = 1;
+			while (numBlocks * Bits_Per_Block < std::max<size_t>(capacity, 1) * Bits_Per_Key)
+				numBlocks <<= 1;
+
+			return numBlocks;
+		}
+
+		template<typename TAction>
+		void ForEachBitIndex(uint64_t key, TAction action) {
+			// block selection uses the low bits of the key, so derive the bit indexes from a multiplicative hash of the whole key
+			auto bits = key * Bit_Index_Multiplier;
+			for (auto i = 0u; i < Num_Bits_Per_Key_Set; ++i) {
+				action(bits >> (64 - Bit_Index_Size));
+				bits <<= Bit_Index_Size;
+			}
+		}
+	}
+
+	BlockedBloomFilter::BlockedBloomFilter(size_t capacity) {
+		auto numBlocks = CalculateNumBlocks(capacity);
+		m_capacity = numBlocks * Bits_Per_Block / Bits_Per_Key;
+		m_blockMask = numBlocks - 1;
+
+		// allocate an additional block so that the first block can be aligned to a cache line
+		m_words.resize((numBlocks + 1) * Words_Per_Block);
+		auto misalignment = reinterpret_cast<uintptr_t>(m_words.data()) % Cache_Line_Size;
+		m_blocksOffset = 0 == misalignment ? 0 : (Cache_Line_Size - misalignment) / sizeof(uint64_t);
+	}
+
+	size_t BlockedBloomFilter::capacity() const {
+		return m_capacity;
+	}
+
+	void BlockedBloomFilter::add(uint64_t key) {
+		auto* pBlock = &m_words[blockStartIndex(key)];
+		ForEachBitIndex(key, [pBlock](auto bitIndex) {
+			pBlock[bitIndex / 64] |= static_cast<uint64_t>(1) << (bitIndex % 64);
+		});
+	}
+
+	bool BlockedBloomFilter::mayContain(uint64_t key) const {
+		const auto* pBlock = &m_words[blockStartIndex(key)];
+		auto isSet = true;
+		ForEachBitIndex(key, [pBlock, &isSet](auto bitIndex) {
+			isSet &= 0 != (pBlock[bitIndex / 64] & (static_cast<uint64_t>(1) << (bitIndex % 64)));
+		});
+
+		return isSet;
+	}
+
+	size_t BlockedBloomFilter::blockStartIndex(uint64_t key) const {
+		return m_blocksOffset + (key & m_blockMask) * Words_Per_Block;
+	}
+}}
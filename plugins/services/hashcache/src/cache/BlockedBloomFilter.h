@@ -0,0 +1,55 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace cache {
+
+	/// Bloom filter of uniformly distributed 64-bit keys that confines all bits of a key to a single cache line.
+	/// \note Keys cannot be removed, so the filter needs to be rebuilt when keys are removed from the filtered set.
+	class BlockedBloomFilter {
+	public:
+		/// Creates a filter that can hold at least \a capacity keys with a low false positive rate.
+		explicit BlockedBloomFilter(size_t capacity);
+
+	public:
+		/// Gets the number of keys the filter was sized for.
+		size_t capacity() const;
+
+	public:
+		/// Adds \a key to the filter.
+		void add(uint64_t key);
+
+		/// Returns \c false if \a key was definitely not added to the filter or \c true if it might have been added.
+		bool mayContain(uint64_t key) const;
+
+	private:
+		size_t blockStartIndex(uint64_t key) const;
+
+	private:
+		size_t m_capacity;
+		uint64_t m_blockMask;
+		size_t m_blocksOffset;
+		std::vector<uint64_t> m_words;
+	};
+}}
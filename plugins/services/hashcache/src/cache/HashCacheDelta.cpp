@@ -24,12 +24,22 @@ namespace catapult { namespace cache {
 
 	BasicHashCacheDelta::BasicHashCacheDelta(const HashCacheTypes::BaseSetDeltaPointers& hashSets, const HashCacheTypes::Options& options)
 			: HashCacheDeltaMixins::Size(*hashSets.pPrimary)
-			, HashCacheDeltaMixins::Contains(*hashSets.pPrimary)
 			, HashCacheDeltaMixins::BasicInsertRemove(*hashSets.pPrimary)
 			, m_pOrderedDelta(hashSets.pPrimary)
+			, m_pIndex(hashSets.pIndex)
 			, m_retentionTime(options.RetentionTime)
 	{}
 
+	bool BasicHashCacheDelta::contains(const ValueType& timestampedHash) const {
+		// hashes that are not original elements can only be contained in the pending additions
+		if (m_pIndex && !m_pIndex->mayContain(timestampedHash)) {
+			const auto& addedElements = m_pOrderedDelta->deltas().Added;
+			return addedElements.cend() != addedElements.find(timestampedHash);
+		}
+
+		return m_pOrderedDelta->contains(timestampedHash);
+	}
+
 	utils::TimeSpan BasicHashCacheDelta::retentionTime() const {
 		return m_retentionTime;
 	}
@@ -33,7 +33,6 @@ namespace catapult { namespace cache {
 	class BasicHashCacheDelta
 			: public utils::MoveOnly
 			, public HashCacheDeltaMixins::Size
-			, public HashCacheDeltaMixins::Contains
 			, public HashCacheDeltaMixins::BasicInsertRemove {
 	public:
 		using ReadOnlyView = HashCacheTypes::CacheReadOnlyType;
@@ -44,6 +43,9 @@ namespace catapult { namespace cache {
 		BasicHashCacheDelta(const HashCacheTypes::BaseSetDeltaPointers& hashSets, const HashCacheTypes::Options& options);
 
 	public:
+		/// Gets a value indicating whether or not the cache contains \a timestampedHash.
+		bool contains(const ValueType& timestampedHash) const;
+
 		/// Gets the retention time for the cache.
 		utils::TimeSpan retentionTime() const;
 
@@ -56,6 +58,7 @@ namespace catapult { namespace cache {
 
 	private:
 		HashCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pOrderedDelta;
+		const HashCacheIndex* m_pIndex;
 		utils::TimeSpan m_retentionTime;
 		deltaset::PruningBoundary<ValueType> m_pruningBoundary;
 	};
@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HashCacheIndex.h"
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		// small indexes fit into the cpu caches, so they do not benefit from a bloom filter
+		constexpr size_t Min_Bloom_Filter_Size = 10'000;
+
+		uint64_t TruncateHash(const state::TimestampedHash& timestampedHash) {
+			uint64_t truncatedHash;
+			std::memcpy(&truncatedHash, timestampedHash.Hash.data(), sizeof(uint64_t));
+			return truncatedHash;
+		}
+	}
+
+	HashCacheIndex::HashCacheIndex()
+			: m_size(0)
+			, m_numRemovalsSinceRebuild(0)
+	{}
+
+	size_t HashCacheIndex::size() const {
+		return m_size;
+	}
+
+	bool HashCacheIndex::hasBloomFilter() const {
+		return !!m_pBloomFilter;
+	}
+
+	bool HashCacheIndex::mayContain(const state::TimestampedHash& timestampedHash) const {
+		auto truncatedHash = TruncateHash(timestampedHash);
+		if (m_pBloomFilter && !m_pBloomFilter->mayContain(truncatedHash))
+			return false;
+
+		return m_truncatedHashCounts.cend() != m_truncatedHashCounts.find(truncatedHash);
+	}
+
+	void HashCacheIndex::insert(const state::TimestampedHash& timestampedHash) {
+		auto truncatedHash = TruncateHash(timestampedHash);
+		++m_truncatedHashCounts[truncatedHash];
+		++m_size;
+
+		if (!m_pBloomFilter) {
+			if (m_size >= Min_Bloom_Filter_Size)
+				rebuildBloomFilter();
+
+			return;
+		}
+
+		if (m_size > m_pBloomFilter->capacity())
+			rebuildBloomFilter();
+		else
+			m_pBloomFilter->add(truncatedHash);
+	}
+
+	void HashCacheIndex::remove(const state::TimestampedHash& timestampedHash) {
+		auto iter = m_truncatedHashCounts.find(TruncateHash(timestampedHash));
+		if (m_truncatedHashCounts.cend() == iter)
+			return;
+
+		if (0 == --iter->second)
+			m_truncatedHashCounts.erase(iter);
+
+		--m_size;
+		if (!m_pBloomFilter)
+			return;
+
+		// removed hashes cannot be cleared from the bloom filter, so rebuild it once they outnumber the indexed hashes
+		if (m_size < Min_Bloom_Filter_Size / 2) {
+			m_pBloomFilter.reset();
+			m_numRemovalsSinceRebuild = 0;
+		} else if (++m_numRemovalsSinceRebuild > m_size)
+			rebuildBloomFilter();
+	}
+
+	void HashCacheIndex::rebuildBloomFilter() {
+		// leave room for the index to double in size before the bloom filter needs to be rebuilt again
+		m_pBloomFilter = std::make_unique<BlockedBloomFilter>(2 * m_size);
+		for (const auto& pair : m_truncatedHashCounts)
+			m_pBloomFilter->add(pair.first);
+
+		m_numRemovalsSinceRebuild = 0;
+	}
+}}
@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BlockedBloomFilter.h"
+#include "catapult/state/TimestampedHash.h"
+#include <memory>
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	/// Index of the truncated hashes contained in a hash cache.
+	/// \note This allows most unknown timestamped hashes to be rejected without an ordered set lookup.
+	///       Once the index is large, a bloom filter is placed in front of it to avoid most index lookups too.
+	class HashCacheIndex {
+	public:
+		/// Creates an empty index.
+		HashCacheIndex();
+
+	public:
+		/// Gets the number of indexed hashes.
+		size_t size() const;
+
+		/// Returns \c true if the index is prefiltered by a bloom filter.
+		bool hasBloomFilter() const;
+
+	public:
+		/// Returns \c false if \a timestampedHash is definitely not indexed or \c true if it might be indexed.
+		bool mayContain(const state::TimestampedHash& timestampedHash) const;
+
+	public:
+		/// Adds \a timestampedHash to the index.
+		void insert(const state::TimestampedHash& timestampedHash);
+
+		/// Removes \a timestampedHash from the index.
+		/// \note \a timestampedHash must have been previously inserted.
+		void remove(const state::TimestampedHash& timestampedHash);
+
+	private:
+		void rebuildBloomFilter();
+
+	private:
+		struct IdentityHasher {
+			size_t operator()(uint64_t key) const {
+				return static_cast<size_t>(key);
+			}
+		};
+
+	private:
+		size_t m_size;
+		std::unordered_map<uint64_t, uint32_t, IdentityHasher> m_truncatedHashCounts;
+		std::unique_ptr<BlockedBloomFilter> m_pBloomFilter;
+		size_t m_numRemovalsSinceRebuild;
+	};
+}}
@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HashCacheTypes.h"
+#include "catapult/deltaset/BaseSetDelta.h"
+#include "catapult/deltaset/BaseSetIterationView.h"
+
+namespace catapult { namespace cache {
+
+	HashCacheTypes::BaseSets::BaseSets(const CacheConfiguration& config)
+			: CacheDatabaseMixin(config, { "default" })
+			, Primary(GetContainerMode(config), database(), 0) {
+		// the index needs to visit pruned elements, which is only possible when the ordered set is iterable
+		if (deltaset::IsBaseSetIterable(Primary))
+			m_pIndex = std::make_unique<HashCacheIndex>();
+	}
+
+	const HashCacheIndex* HashCacheTypes::BaseSets::index() const {
+		return m_pIndex.get();
+	}
+
+	HashCacheTypes::BaseSetDeltaPointers HashCacheTypes::BaseSets::rebase() {
+		auto pPrimaryDelta = Primary.rebase();
+		m_pWeakDelta = pPrimaryDelta;
+		return { pPrimaryDelta, m_pIndex.get() };
+	}
+
+	HashCacheTypes::BaseSetDeltaPointers HashCacheTypes::BaseSets::rebaseDetached() const {
+		return { Primary.rebaseDetached(), m_pIndex.get() };
+	}
+
+	void HashCacheTypes::BaseSets::commit(const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary) {
+		// the index must be updated before the changes are committed because pruned elements are only visible before the commit
+		auto pDelta = m_pWeakDelta.lock();
+		if (m_pIndex && pDelta)
+			updateIndex(*pDelta, pruningBoundary);
+
+		Primary.commit(pruningBoundary);
+	}
+
+	void HashCacheTypes::BaseSets::updateIndex(
+			const PrimaryTypes::BaseSetDeltaType& delta,
+			const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary) {
+		auto isPruned = [&pruningBoundary](const auto& timestampedHash) {
+			return pruningBoundary.isSet() && timestampedHash < pruningBoundary.value();
+		};
+
+		// removed elements are always original elements and added elements are never original elements
+		auto deltas = delta.deltas();
+		for (const auto& timestampedHash : deltas.Removed)
+			m_pIndex->remove(timestampedHash);
+
+		for (const auto& timestampedHash : deltas.Added) {
+			if (!isPruned(timestampedHash))
+				m_pIndex->insert(timestampedHash);
+		}
+
+		// original elements are ordered by time, so all pruned elements are at the beginning of the set
+		for (const auto& timestampedHash : deltaset::MakeIterableView(Primary)) {
+			if (!isPruned(timestampedHash))
+				break;
+
+			if (deltas.Removed.cend() == deltas.Removed.find(timestampedHash))
+				m_pIndex->remove(timestampedHash);
+		}
+	}
+}}
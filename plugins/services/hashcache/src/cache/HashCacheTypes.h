@@ -19,8 +19,10 @@
 **/
 
 #pragma once
+#include "HashCacheIndex.h"
+#include "catapult/cache/CacheDatabaseMixin.h"
 #include "catapult/cache/CacheDescriptorAdapters.h"
-#include "catapult/cache/SingleSetCacheTypesAdapter.h"
+#include "catapult/deltaset/PruningBoundary.h"
 #include "catapult/state/TimestampedHash.h"
 #include "catapult/utils/TimeSpan.h"
 
@@ -62,7 +64,8 @@ namespace catapult { namespace cache {
 	};
 
 	/// Hash cache types.
-	struct HashCacheTypes : public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor>, std::true_type> {
+	struct HashCacheTypes {
+		using PrimaryTypes = ImmutableOrderedSetAdapter<HashCacheDescriptor>;
 		using CacheReadOnlyType = ReadOnlySimpleCache<BasicHashCacheView, BasicHashCacheDelta, state::TimestampedHash>;
 
 		/// Custom sub view options.
@@ -70,5 +73,59 @@ namespace catapult { namespace cache {
 			/// Cache retention time.
 			utils::TimeSpan RetentionTime;
 		};
+
+	public:
+		// in order to speed up lookups of unknown hashes, the ordered set is paired with a hash index of its committed elements
+
+		struct BaseSetDeltaPointers {
+			PrimaryTypes::BaseSetDeltaPointerType pPrimary;
+
+			/// Index of the original elements (\c nullptr when the original elements are not indexed).
+			const HashCacheIndex* pIndex;
+		};
+
+		struct BaseSets : public CacheDatabaseMixin {
+		public:
+			/// Indicates the set is ordered (used for capability detection in templates).
+			using IsOrderedSet = std::true_type;
+
+		public:
+			explicit BaseSets(const CacheConfiguration& config);
+
+		public:
+			PrimaryTypes::BaseSetType Primary;
+
+		public:
+			/// Gets the index of the committed elements or \c nullptr if they are not indexed.
+			const HashCacheIndex* index() const;
+
+		public:
+			BaseSetDeltaPointers rebase();
+
+			BaseSetDeltaPointers rebaseDetached() const;
+
+			void commit(const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary);
+
+			void enableUndoJournal() {
+				Primary.enableUndoJournal();
+			}
+
+			void pruneUndoJournal(size_t numRetainedCommits) {
+				Primary.pruneUndoJournal(numRetainedCommits);
+			}
+
+			void undo(size_t numCommits) {
+				Primary.undo(numCommits);
+			}
+
+		private:
+			void updateIndex(
+					const PrimaryTypes::BaseSetDeltaType& delta,
+					const deltaset::PruningBoundary<state::TimestampedHash>& pruningBoundary);
+
+		private:
+			std::unique_ptr<HashCacheIndex> m_pIndex;
+			std::weak_ptr<PrimaryTypes::BaseSetDeltaType> m_pWeakDelta;
+		};
 	};
 }}
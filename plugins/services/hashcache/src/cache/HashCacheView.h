@@ -33,7 +33,6 @@ namespace catapult { namespace cache {
 	class BasicHashCacheView
 			: public utils::MoveOnly
 			, public HashCacheViewMixins::Size
-			, public HashCacheViewMixins::Contains
 			, public HashCacheViewMixins::Iteration {
 	public:
 		using ReadOnlyView = HashCacheTypes::CacheReadOnlyType;
@@ -42,18 +41,29 @@ namespace catapult { namespace cache {
 		/// Creates a view around \a hashSets and \a options.
 		explicit BasicHashCacheView(const HashCacheTypes::BaseSets& hashSets, const HashCacheTypes::Options& options)
 				: HashCacheViewMixins::Size(hashSets.Primary)
-				, HashCacheViewMixins::Contains(hashSets.Primary)
 				, HashCacheViewMixins::Iteration(hashSets.Primary)
+				, m_orderedSet(hashSets.Primary)
+				, m_pIndex(hashSets.index())
 				, m_retentionTime(options.RetentionTime)
 		{}
 
 	public:
+		/// Gets a value indicating whether or not the cache contains \a timestampedHash.
+		bool contains(const state::TimestampedHash& timestampedHash) const {
+			if (m_pIndex && !m_pIndex->mayContain(timestampedHash))
+				return false;
+
+			return m_orderedSet.contains(timestampedHash);
+		}
+
 		/// Gets the retention time for the cache.
 		utils::TimeSpan retentionTime() const {
 			return m_retentionTime;
 		}
 
 	private:
+		const HashCacheTypes::PrimaryTypes::BaseSetType& m_orderedSet;
+		const HashCacheIndex* m_pIndex;
 		utils::TimeSpan m_retentionTime;
 	};
 
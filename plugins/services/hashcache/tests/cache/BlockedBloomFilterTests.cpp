@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/BlockedBloomFilter.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS BlockedBloomFilterTests
+
+	namespace {
+		std::vector<uint64_t> GenerateRandomKeys(size_t count) {
+			std::vector<uint64_t> keys;
+			for (auto i = 0u; i < count; ++i)
+				keys.push_back(test::Random());
+
+			return keys;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CapacityIsRoundedUpToWholeNumberOfBlocks) {
+		// Assert: each block has 512 bits and each key is allotted 16 bits
+		EXPECT_EQ(32u, BlockedBloomFilter(0).capacity());
+		EXPECT_EQ(32u, BlockedBloomFilter(1).capacity());
+		EXPECT_EQ(32u, BlockedBloomFilter(32).capacity());
+		EXPECT_EQ(64u, BlockedBloomFilter(33).capacity());
+		EXPECT_EQ(1024u, BlockedBloomFilter(1000).capacity());
+	}
+
+	TEST(TEST_CLASS, EmptyFilterDoesNotContainAnyKeys) {
+		// Arrange:
+		BlockedBloomFilter filter(100);
+
+		// Act + Assert:
+		for (auto key : GenerateRandomKeys(100))
+			EXPECT_FALSE(filter.mayContain(key)) << key;
+	}
+
+	// endregion
+
+	// region add / mayContain
+
+	TEST(TEST_CLASS, FilterContainsAllAddedKeys) {
+		// Arrange:
+		BlockedBloomFilter filter(1000);
+		auto keys = GenerateRandomKeys(1000);
+
+		// Act:
+		for (auto key : keys)
+			filter.add(key);
+
+		// Assert:
+		for (auto key : keys)
+			EXPECT_TRUE(filter.mayContain(key)) << key;
+	}
+
+	TEST(TEST_CLASS, FilterHasLowFalsePositiveRateAtCapacity) {
+		// Arrange:
+		BlockedBloomFilter filter(10'000);
+		for (auto key : GenerateRandomKeys(filter.capacity()))
+			filter.add(key);
+
+		// Act:
+		auto numFalsePositives = 0u;
+		for (auto key : GenerateRandomKeys(10'000))
+			numFalsePositives += filter.mayContain(key) ? 1 : 0;
+
+		// Assert: the expected false positive rate is around 0.2%
+		EXPECT_GT(100u, numFalsePositives);
+	}
+
+	// endregion
+}}
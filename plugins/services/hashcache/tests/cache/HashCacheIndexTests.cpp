@@ -0,0 +1,217 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/HashCacheIndex.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS HashCacheIndexTests
+
+	namespace {
+		constexpr size_t Min_Bloom_Filter_Size = 10'000;
+
+		std::vector<state::TimestampedHash> CreateTimestampedHashes(size_t count) {
+			std::vector<state::TimestampedHash> timestampedHashes;
+			for (auto i = 0u; i < count; ++i)
+				timestampedHashes.emplace_back(Timestamp(i), test::GenerateRandomData<Hash256_Size>());
+
+			return timestampedHashes;
+		}
+
+		void InsertAll(HashCacheIndex& index, const std::vector<state::TimestampedHash>& timestampedHashes) {
+			for (const auto& timestampedHash : timestampedHashes)
+				index.insert(timestampedHash);
+		}
+
+		void AssertMayContain(
+				const HashCacheIndex& index,
+				const std::vector<state::TimestampedHash>& timestampedHashes,
+				size_t startIndex,
+				size_t endIndex,
+				bool expectedMayContain) {
+			for (auto i = startIndex; i < endIndex; ++i)
+				EXPECT_EQ(expectedMayContain, index.mayContain(timestampedHashes[i])) << i;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyIndex) {
+		// Act:
+		HashCacheIndex index;
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_FALSE(index.hasBloomFilter());
+		EXPECT_FALSE(index.mayContain(state::TimestampedHash(Timestamp(), test::GenerateRandomData<Hash256_Size>())));
+	}
+
+	// endregion
+
+	// region insert / remove
+
+	TEST(TEST_CLASS, InsertedHashesAreIndexed) {
+		// Arrange:
+		HashCacheIndex index;
+		auto timestampedHashes = CreateTimestampedHashes(10);
+
+		// Act:
+		InsertAll(index, timestampedHashes);
+
+		// Assert:
+		EXPECT_EQ(10u, index.size());
+		EXPECT_FALSE(index.hasBloomFilter());
+		AssertMayContain(index, timestampedHashes, 0, 10, true);
+	}
+
+	TEST(TEST_CLASS, UnknownHashesAreNotIndexed) {
+		// Arrange:
+		HashCacheIndex index;
+		InsertAll(index, CreateTimestampedHashes(10));
+
+		// Act + Assert:
+		AssertMayContain(index, CreateTimestampedHashes(10), 0, 10, false);
+	}
+
+	TEST(TEST_CLASS, RemovedHashesAreNotIndexed) {
+		// Arrange:
+		HashCacheIndex index;
+		auto timestampedHashes = CreateTimestampedHashes(10);
+		InsertAll(index, timestampedHashes);
+
+		// Act:
+		for (auto i = 0u; i < 4; ++i)
+			index.remove(timestampedHashes[i]);
+
+		// Assert:
+		EXPECT_EQ(6u, index.size());
+		AssertMayContain(index, timestampedHashes, 0, 4, false);
+		AssertMayContain(index, timestampedHashes, 4, 10, true);
+	}
+
+	TEST(TEST_CLASS, RemovingUnknownHashHasNoEffect) {
+		// Arrange:
+		HashCacheIndex index;
+		auto timestampedHashes = CreateTimestampedHashes(10);
+		InsertAll(index, timestampedHashes);
+
+		// Act:
+		index.remove(CreateTimestampedHashes(1)[0]);
+
+		// Assert:
+		EXPECT_EQ(10u, index.size());
+		AssertMayContain(index, timestampedHashes, 0, 10, true);
+	}
+
+	TEST(TEST_CLASS, HashesWithSameTruncatedHashAreCountedSeparately) {
+		// Arrange: only the timestamps of the hashes differ
+		HashCacheIndex index;
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		auto timestampedHash1 = state::TimestampedHash(Timestamp(1), hash);
+		auto timestampedHash2 = state::TimestampedHash(Timestamp(2), hash);
+		index.insert(timestampedHash1);
+		index.insert(timestampedHash2);
+
+		// Act:
+		index.remove(timestampedHash1);
+
+		// Assert: the truncated hash is still indexed because of the second hash
+		EXPECT_EQ(1u, index.size());
+		EXPECT_TRUE(index.mayContain(timestampedHash1));
+		EXPECT_TRUE(index.mayContain(timestampedHash2));
+
+		// Act:
+		index.remove(timestampedHash2);
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_FALSE(index.mayContain(timestampedHash1));
+		EXPECT_FALSE(index.mayContain(timestampedHash2));
+	}
+
+	// endregion
+
+	// region bloom filter
+
+	TEST(TEST_CLASS, BloomFilterIsCreatedWhenIndexBecomesLarge) {
+		// Arrange:
+		HashCacheIndex index;
+		auto timestampedHashes = CreateTimestampedHashes(Min_Bloom_Filter_Size);
+
+		// Act:
+		InsertAll(index, { timestampedHashes.cbegin(), timestampedHashes.cend() - 1 });
+		auto hasBloomFilterBeforeLastInsert = index.hasBloomFilter();
+		index.insert(timestampedHashes.back());
+
+		// Assert:
+		EXPECT_FALSE(hasBloomFilterBeforeLastInsert);
+		EXPECT_TRUE(index.hasBloomFilter());
+		AssertMayContain(index, timestampedHashes, 0, Min_Bloom_Filter_Size, true);
+	}
+
+	TEST(TEST_CLASS, BloomFilterIsRebuiltWhenIndexGrows) {
+		// Arrange:
+		HashCacheIndex index;
+		auto timestampedHashes = CreateTimestampedHashes(5 * Min_Bloom_Filter_Size);
+
+		// Act:
+		InsertAll(index, timestampedHashes);
+
+		// Assert:
+		EXPECT_TRUE(index.hasBloomFilter());
+		AssertMayContain(index, timestampedHashes, 0, timestampedHashes.size(), true);
+	}
+
+	TEST(TEST_CLASS, BloomFilterIsRebuiltWhenManyHashesAreRemoved) {
+		// Arrange:
+		HashCacheIndex index;
+		auto timestampedHashes = CreateTimestampedHashes(4 * Min_Bloom_Filter_Size);
+		InsertAll(index, timestampedHashes);
+
+		// Act:
+		for (auto i = 0u; i < 3 * Min_Bloom_Filter_Size; ++i)
+			index.remove(timestampedHashes[i]);
+
+		// Assert:
+		EXPECT_TRUE(index.hasBloomFilter());
+		AssertMayContain(index, timestampedHashes, 0, 3 * Min_Bloom_Filter_Size, false);
+		AssertMayContain(index, timestampedHashes, 3 * Min_Bloom_Filter_Size, timestampedHashes.size(), true);
+	}
+
+	TEST(TEST_CLASS, BloomFilterIsDestroyedWhenIndexBecomesSmall) {
+		// Arrange:
+		HashCacheIndex index;
+		auto timestampedHashes = CreateTimestampedHashes(Min_Bloom_Filter_Size);
+		InsertAll(index, timestampedHashes);
+
+		// Act:
+		auto numRemovedHashes = Min_Bloom_Filter_Size / 2 + 1;
+		for (auto i = 0u; i < numRemovedHashes; ++i)
+			index.remove(timestampedHashes[i]);
+
+		// Assert:
+		EXPECT_FALSE(index.hasBloomFilter());
+		AssertMayContain(index, timestampedHashes, 0, numRemovedHashes, false);
+		AssertMayContain(index, timestampedHashes, numRemovedHashes, Min_Bloom_Filter_Size, true);
+	}
+
+	// endregion
+}}
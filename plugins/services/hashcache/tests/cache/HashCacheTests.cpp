@@ -111,4 +111,191 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region contains (index)
+
+	namespace {
+		std::vector<state::TimestampedHash> CreateTimestampedHashes(size_t count) {
+			std::vector<state::TimestampedHash> timestampedHashes;
+			for (auto i = 0u; i < count; ++i)
+				timestampedHashes.emplace_back(Timestamp(i + 1), test::GenerateRandomData<Hash256_Size>());
+
+			return timestampedHashes;
+		}
+
+		void InsertAndCommit(HashCache& cache, const std::vector<state::TimestampedHash>& timestampedHashes) {
+			auto delta = cache.createDelta();
+			for (const auto& timestampedHash : timestampedHashes)
+				delta->insert(timestampedHash);
+
+			cache.commit();
+		}
+
+		void PruneAndCommit(HashCache& cache, Timestamp timestamp) {
+			auto delta = cache.createDelta();
+			delta->prune(timestamp);
+			cache.commit();
+		}
+
+		void AssertContains(
+				const HashCache& cache,
+				const std::vector<state::TimestampedHash>& timestampedHashes,
+				size_t startIndex,
+				size_t endIndex,
+				bool expectedContains) {
+			auto view = cache.createView();
+			auto detachedDelta = cache.createDetachedDelta();
+			auto pDetachedDelta = detachedDelta.lock();
+			for (auto i = startIndex; i < endIndex; ++i) {
+				EXPECT_EQ(expectedContains, view->contains(timestampedHashes[i])) << "view " << i;
+				EXPECT_EQ(expectedContains, pDetachedDelta->contains(timestampedHashes[i])) << "detached delta " << i;
+			}
+		}
+
+		void AssertContainsAfterPruning(size_t numHashes, size_t numPrunedHashes) {
+			// Arrange:
+			HashCache cache(CacheConfiguration(), utils::TimeSpan::FromMilliseconds(0));
+			auto timestampedHashes = CreateTimestampedHashes(numHashes);
+			InsertAndCommit(cache, timestampedHashes);
+
+			// Act:
+			PruneAndCommit(cache, Timestamp(numPrunedHashes + 1));
+
+			// Assert:
+			EXPECT_EQ(numHashes - numPrunedHashes, cache.createView()->size());
+			AssertContains(cache, timestampedHashes, 0, numPrunedHashes, false);
+			AssertContains(cache, timestampedHashes, numPrunedHashes, numHashes, true);
+		}
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForUnknownHashes) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		InsertAndCommit(cache, CreateTimestampedHashes(10));
+
+		// Act + Assert:
+		AssertContains(cache, CreateTimestampedHashes(10), 0, 10, false);
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForKnownHashWithDifferentTimestamp) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		auto timestampedHashes = CreateTimestampedHashes(10);
+		InsertAndCommit(cache, timestampedHashes);
+
+		// - change the timestamp of a known hash
+		auto timestampedHash = timestampedHashes[4];
+		timestampedHash.Time = Timestamp(100);
+
+		// Act + Assert:
+		AssertContains(cache, { timestampedHash }, 0, 1, false);
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsTrueForCommittedHashes) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		auto timestampedHashes = CreateTimestampedHashes(10);
+
+		// Act:
+		InsertAndCommit(cache, timestampedHashes);
+
+		// Assert:
+		AssertContains(cache, timestampedHashes, 0, 10, true);
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForCommittedRemovedHashes) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		auto timestampedHashes = CreateTimestampedHashes(10);
+		InsertAndCommit(cache, timestampedHashes);
+
+		// Act:
+		{
+			auto delta = cache.createDelta();
+			delta->remove(timestampedHashes[2]);
+			delta->remove(timestampedHashes[7]);
+			cache.commit();
+		}
+
+		// Assert:
+		AssertContains(cache, timestampedHashes, 2, 3, false);
+		AssertContains(cache, timestampedHashes, 7, 8, false);
+		AssertContains(cache, timestampedHashes, 0, 2, true);
+		AssertContains(cache, timestampedHashes, 3, 7, true);
+		AssertContains(cache, timestampedHashes, 8, 10, true);
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsTrueForPendingInsertedHashesInDelta) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		auto timestampedHashes = CreateTimestampedHashes(10);
+		InsertAndCommit(cache, { timestampedHashes.cbegin(), timestampedHashes.cbegin() + 5 });
+
+		// Act:
+		auto delta = cache.createDelta();
+		for (auto i = 5u; i < 10; ++i)
+			delta->insert(timestampedHashes[i]);
+
+		delta->remove(timestampedHashes[1]);
+
+		// Assert: pending changes are only visible in the delta
+		for (auto i = 0u; i < 10; ++i)
+			EXPECT_EQ(1 != i, delta->contains(timestampedHashes[i])) << i;
+
+		AssertContains(cache, timestampedHashes, 0, 5, true);
+		AssertContains(cache, timestampedHashes, 5, 10, false);
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForPrunedHashes) {
+		// Assert:
+		AssertContainsAfterPruning(10, 4);
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsFalseForPrunedHashes_BloomFilter) {
+		// Assert: use enough hashes to place a bloom filter in front of the index
+		AssertContainsAfterPruning(25'000, 20'000);
+	}
+
+	TEST(TEST_CLASS, ContainsReturnsTrueForHashesReinsertedAfterPruning) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromMilliseconds(0));
+		auto timestampedHashes = CreateTimestampedHashes(10);
+		InsertAndCommit(cache, timestampedHashes);
+		PruneAndCommit(cache, Timestamp(5));
+
+		// Act:
+		InsertAndCommit(cache, { timestampedHashes.cbegin(), timestampedHashes.cbegin() + 4 });
+
+		// Assert:
+		AssertContains(cache, timestampedHashes, 0, 10, true);
+	}
+
+	TEST(TEST_CLASS, PruningIgnoresHashesInsertedAndRemovedInSameCommit) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromMilliseconds(0));
+		auto timestampedHashes = CreateTimestampedHashes(10);
+		InsertAndCommit(cache, { timestampedHashes.cbegin(), timestampedHashes.cbegin() + 5 });
+
+		// Act: insert hashes on both sides of the pruning boundary and remove a pruned hash
+		{
+			auto delta = cache.createDelta();
+			for (auto i = 5u; i < 10; ++i)
+				delta->insert(timestampedHashes[i]);
+
+			delta->remove(timestampedHashes[1]);
+			delta->prune(Timestamp(7));
+			cache.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(4u, cache.createView()->size());
+		AssertContains(cache, timestampedHashes, 0, 6, false);
+		AssertContains(cache, timestampedHashes, 6, 10, true);
+
+		// - reinsert all hashes to check that the index was not corrupted
+		InsertAndCommit(cache, timestampedHashes);
+		AssertContains(cache, timestampedHashes, 0, 10, true);
+	}
+
+	// endregion
 }}
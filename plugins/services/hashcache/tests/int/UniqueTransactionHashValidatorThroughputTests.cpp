@@ -0,0 +1,179 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/validators/Validators.h"
+#include "src/cache/HashCache.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/utils/StackLogger.h"
+#include "catapult/validators/ValidatorContext.h"
+#include "tests/test/HashCacheTestUtils.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/test/plugins/ValidatorTestUtils.h"
+#include "tests/TestHarness.h"
+#include <set>
+
+namespace catapult { namespace validators {
+
+#define TEST_CLASS UniqueTransactionHashValidatorThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr uint32_t Num_Retained_Hashes = 10'000'000;
+#else
+		constexpr uint32_t Num_Retained_Hashes = 1'000'000;
+#endif
+
+		constexpr uint32_t Num_Validations = 1'000'000;
+
+		using TimestampedHashes = std::vector<state::TimestampedHash>;
+
+		TimestampedHashes CreateTimestampedHashes(size_t count) {
+			TimestampedHashes timestampedHashes;
+			timestampedHashes.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				timestampedHashes.push_back(state::TimestampedHash(Timestamp(i), test::GenerateRandomData<Hash256_Size>()));
+
+			return timestampedHashes;
+		}
+
+		cache::CatapultCache CreateCache(const TimestampedHashes& timestampedHashes) {
+			auto cache = test::CreateEmptyCatapultCache<test::HashCacheFactory>(model::BlockChainConfiguration::Uninitialized());
+			auto delta = cache.createDelta();
+			auto& hashCache = delta.sub<cache::HashCache>();
+			for (const auto& timestampedHash : timestampedHashes)
+				hashCache.insert(timestampedHash);
+
+			cache.commit(Height());
+			return cache;
+		}
+
+		void LogThroughput(const char* name, uint64_t elapsedMillis) {
+			auto validationsPerSecond = static_cast<uint64_t>(Num_Validations) * 1000 / std::max<uint64_t>(1, elapsedMillis);
+			CATAPULT_LOG(info)
+					<< name << " performed " << Num_Validations << " validations against " << Num_Retained_Hashes
+					<< " retained hashes in " << elapsedMillis << "ms (" << validationsPerSecond << " validations/s)";
+		}
+
+		enum class HashSource { Unknown, Retained };
+
+		TimestampedHashes SelectValidationHashes(const TimestampedHashes& retainedHashes, HashSource hashSource) {
+			if (HashSource::Unknown == hashSource)
+				return CreateTimestampedHashes(Num_Validations);
+
+			TimestampedHashes timestampedHashes;
+			timestampedHashes.reserve(Num_Validations);
+			for (auto i = 0u; i < Num_Validations; ++i)
+				timestampedHashes.push_back(retainedHashes[test::Random() % retainedHashes.size()]);
+
+			return timestampedHashes;
+		}
+
+		void MeasureValidatorThroughput(const char* name, HashSource hashSource) {
+			// Arrange:
+			auto retainedHashes = CreateTimestampedHashes(Num_Retained_Hashes);
+			auto cache = CreateCache(retainedHashes);
+			auto validationHashes = SelectValidationHashes(retainedHashes, hashSource);
+
+			auto pValidator = CreateUniqueTransactionHashValidator();
+			auto cacheView = cache.createView();
+			auto readOnlyCache = cacheView.toReadOnly();
+			auto context = test::CreateValidatorContext(Height(1), readOnlyCache);
+
+			// Act:
+			auto numFailures = 0u;
+			uint64_t elapsedMillis;
+			{
+				utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+				for (const auto& timestampedHash : validationHashes) {
+					auto notification = model::TransactionNotification(
+							Key(),
+							timestampedHash.Hash,
+							model::EntityType(),
+							timestampedHash.Time);
+					if (ValidationResult::Success != pValidator->validate(notification, context))
+						++numFailures;
+				}
+
+				elapsedMillis = stopwatch.millis();
+			}
+
+			// Assert:
+			LogThroughput(name, elapsedMillis);
+			EXPECT_EQ(HashSource::Unknown == hashSource ? 0u : Num_Validations, numFailures);
+		}
+
+		void MeasureOrderedSetThroughput(const char* name, HashSource hashSource) {
+			// Arrange: emulate the lookups performed by the hash cache before it was indexed
+			auto retainedHashes = CreateTimestampedHashes(Num_Retained_Hashes);
+			std::set<state::TimestampedHash> orderedSet(retainedHashes.cbegin(), retainedHashes.cend());
+			auto validationHashes = SelectValidationHashes(retainedHashes, hashSource);
+
+			// Act:
+			auto numFailures = 0u;
+			uint64_t elapsedMillis;
+			{
+				utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+				for (const auto& timestampedHash : validationHashes) {
+					if (orderedSet.cend() != orderedSet.find(timestampedHash))
+						++numFailures;
+				}
+
+				elapsedMillis = stopwatch.millis();
+			}
+
+			// Assert:
+			LogThroughput(name, elapsedMillis);
+			EXPECT_EQ(HashSource::Unknown == hashSource ? 0u : Num_Validations, numFailures);
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ValidatorThroughput_UnknownHashes) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureValidatorThroughput("validate unknown hashes", HashSource::Unknown);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ValidatorThroughput_RetainedHashes) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureValidatorThroughput("validate retained hashes", HashSource::Retained);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, OrderedSetThroughput_UnknownHashes) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureOrderedSetThroughput("ordered set lookup of unknown hashes", HashSource::Unknown);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, OrderedSetThroughput_RetainedHashes) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureOrderedSetThroughput("ordered set lookup of retained hashes", HashSource::Retained);
+	}
+}}
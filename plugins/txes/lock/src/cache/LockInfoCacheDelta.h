@@ -82,14 +82,23 @@ namespace catapult { namespace cache {
 		/// Collects all unused lock infos that expired at \a height.
 		std::vector<const typename TDescriptor::ValueType*> collectUnusedExpiredLocks(Height height) {
 			std::vector<const typename TDescriptor::ValueType*> values;
-			ForEachIdentifierWithGroup(utils::as_const(*m_pDelta), *m_pHeightGroupingDelta, height, [&values](const auto& lockInfo) {
-				if (model::LockStatus::Unused == lockInfo.Status)
-					values.push_back(&lockInfo);
+			forEachUnusedExpiredLock(height, [&values](const auto& lockInfo) {
+				values.push_back(&lockInfo);
 			});
 
 			return values;
 		}
 
+		/// Calls \a action for each unused lock info that expired at \a height.
+		/// \note This does not allocate and only requires a single lookup when no lock expired at \a height.
+		template<typename TAction>
+		void forEachUnusedExpiredLock(Height height, TAction action) {
+			ForEachIdentifierWithGroup(utils::as_const(*m_pDelta), *m_pHeightGroupingDelta, height, [action](const auto& lockInfo) {
+				if (model::LockStatus::Unused == lockInfo.Status)
+					action(lockInfo);
+			});
+		}
+
 	private:
 		typename TCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pDelta;
 		typename TCacheTypes::HeightGroupingTypes::BaseSetDeltaPointerType m_pHeightGroupingDelta;
@@ -84,6 +84,21 @@ namespace catapult { namespace cache {
 				Primary.commit();
 				HeightGrouping.commit();
 			}
+
+			void enableUndoJournal() {
+				Primary.enableUndoJournal();
+				HeightGrouping.enableUndoJournal();
+			}
+
+			void pruneUndoJournal(size_t numRetainedCommits) {
+				Primary.pruneUndoJournal(numRetainedCommits);
+				HeightGrouping.pruneUndoJournal(numRetainedCommits);
+			}
+
+			void undo(size_t numCommits) {
+				Primary.undo(numCommits);
+				HeightGrouping.undo(numCommits);
+			}
 		};
 	};
 }}
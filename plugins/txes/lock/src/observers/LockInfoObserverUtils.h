@@ -34,14 +34,14 @@ namespace catapult { namespace observers {
 		auto& accountStateCache = context.Cache.sub<cache::AccountStateCache>();
 		auto& lockInfoCache = context.Cache.template sub<TLockInfoCache>();
 
-		auto lockInfos = lockInfoCache.collectUnusedExpiredLocks(context.Height);
-		for (const auto* pLockInfo : lockInfos) {
-			auto& accountState = accountStateCache.get(ownerAccountIdSupplier(*pLockInfo));
+		lockInfoCache.forEachUnusedExpiredLock(context.Height, [&context, &accountStateCache, ownerAccountIdSupplier](
+				const auto& lockInfo) {
+			auto& accountState = accountStateCache.get(ownerAccountIdSupplier(lockInfo));
 			if (NotifyMode::Commit == context.Mode)
-				accountState.Balances.credit(pLockInfo->MosaicId, pLockInfo->Amount);
+				accountState.Balances.credit(lockInfo.MosaicId, lockInfo.Amount);
 			else
-				accountState.Balances.debit(pLockInfo->MosaicId, pLockInfo->Amount);
-		}
+				accountState.Balances.debit(lockInfo.MosaicId, lockInfo.Amount);
+		});
 	}
 
 	/// On commit, marks lock as used and credits destination account.
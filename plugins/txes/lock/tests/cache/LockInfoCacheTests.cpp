@@ -308,4 +308,56 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region forEachUnusedExpiredLock
+
+	DELTA_LOCK_TYPE_BASED_TEST(ForEachUnusedExpiredLockDoesNotCallActionIfNoLockExpired) {
+		// Arrange:
+		typename DeltaElementsMixinTraits<TLockInfoTraits>::CacheType cache;
+		auto lockInfos = test::CreateLockInfos<TLockInfoTraits>(Num_Default_Entries);
+		PopulateCache<TLockInfoTraits>(cache, lockInfos);
+
+		// Act: no lock expired at height 15 and locks at height 30 are used
+		auto delta = cache.createDelta();
+		auto numCalls = 0u;
+		delta->forEachUnusedExpiredLock(Height(15), [&numCalls](const auto&) { ++numCalls; });
+		delta->forEachUnusedExpiredLock(Height(30), [&numCalls](const auto&) { ++numCalls; });
+
+		// Assert:
+		EXPECT_EQ(0u, numCalls);
+	}
+
+	DELTA_LOCK_TYPE_BASED_TEST(ForEachUnusedExpiredLockCallsActionForOnlyUnusedExpiredLocks) {
+		// Arrange:
+		typename DeltaElementsMixinTraits<TLockInfoTraits>::CacheType cache;
+		auto lockInfos = test::CreateLockInfos<TLockInfoTraits>(Num_Default_Entries);
+		PopulateCache<TLockInfoTraits>(cache, lockInfos);
+
+		// - add another four lock infos that expire at height 40, two of which are used
+		auto delta = cache.createDelta();
+		for (auto i = 0u; i < 4; ++i) {
+			auto lockInfo = TLockInfoTraits::CreateLockInfo(Height(40));
+			if (1 == i % 2)
+				lockInfo.Status = model::LockStatus::Used;
+
+			lockInfos.push_back(lockInfo);
+			delta->insert(lockInfos.back());
+		}
+
+		// Act: notice that uncommitted changes are visited too
+		LockInfoPointers<TLockInfoTraits> expiredLockInfos;
+		delta->forEachUnusedExpiredLock(Height(40), [&expiredLockInfos](const auto& lockInfo) {
+			expiredLockInfos.push_back(&lockInfo);
+		});
+
+		// Assert:
+		LockInfoPointers<TLockInfoTraits> expectedLockInfos{
+			&lockInfos[3],
+			&lockInfos[Num_Default_Entries],
+			&lockInfos[Num_Default_Entries + 2]
+		};
+		AssertEqualLockInfos<TLockInfoTraits>(expectedLockInfos, expiredLockInfos);
+	}
+
+	// endregion
 }}
@@ -0,0 +1,115 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "src/cache/HashLockInfoCache.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS LockInfoCacheExpiryThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Locks = 5'000'000;
+#else
+		constexpr size_t Num_Locks = 1'000'000;
+#endif
+
+		// locks expire within two days of blocks, so half of the checked heights have no expiring locks
+		constexpr uint64_t Max_Lock_Duration = 2 * 24 * 60 * 4;
+		constexpr uint64_t Num_Checked_Heights = 2 * Max_Lock_Duration;
+
+		void SeedCache(HashLockInfoCache& cache) {
+			utils::StackLogger stopwatch("seed hash lock info cache", utils::LogLevel::Info);
+			auto delta = cache.createDelta();
+			for (auto i = 0u; i < Num_Locks; ++i) {
+				auto height = Height(1 + test::Random() % Max_Lock_Duration);
+				model::HashLockInfo lockInfo(Key(), MosaicId(1), Amount(1), height, test::GenerateRandomData<Hash256_Size>());
+
+				// a tenth of the locks have already been used
+				if (0 == i % 10)
+					lockInfo.Status = model::LockStatus::Used;
+
+				delta->insert(lockInfo);
+			}
+
+			cache.commit();
+		}
+
+		template<typename TVisitHeight>
+		void MeasureExpiry(const char* name, TVisitHeight visitHeight) {
+			// Arrange:
+			HashLockInfoCache cache(CacheConfiguration{});
+			SeedCache(cache);
+
+			auto delta = cache.createDelta();
+			Amount totalAmount;
+
+			// Act:
+			uint64_t elapsedMillis;
+			{
+				utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+				for (auto height = Height(1); height <= Height(Num_Checked_Heights); height = height + Height(1))
+					totalAmount = totalAmount + visitHeight(*delta, height);
+
+				elapsedMillis = stopwatch.millis();
+			}
+
+			// Assert:
+			CATAPULT_LOG(info)
+					<< name << " checked " << Num_Checked_Heights << " heights with " << Num_Locks << " outstanding locks in "
+					<< elapsedMillis << "ms";
+			EXPECT_EQ(Amount(Num_Locks - Num_Locks / 10), totalAmount);
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ExpiryThroughput_CollectUnusedExpiredLocks) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureExpiry("collect unused expired locks", [](auto& delta, auto height) {
+			Amount amount;
+			for (const auto* pLockInfo : delta.collectUnusedExpiredLocks(height))
+				amount = amount + pLockInfo->Amount;
+
+			return amount;
+		});
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ExpiryThroughput_ForEachUnusedExpiredLock) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureExpiry("for each unused expired lock", [](auto& delta, auto height) {
+			Amount amount;
+			delta.forEachUnusedExpiredLock(height, [&amount](const auto& lockInfo) {
+				amount = amount + lockInfo.Amount;
+			});
+
+			return amount;
+		});
+	}
+}}
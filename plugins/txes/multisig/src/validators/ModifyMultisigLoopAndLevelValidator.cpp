@@ -37,6 +37,8 @@ namespace catapult { namespace validators {
 
 		public:
 			ValidationResult validate(const Key& topKey, const Key& bottomKey) {
+				// ancestors and descendants are collected for every notification because the observers of a previous
+				// notification could have changed the multisig graph (shared subtrees are only walked once per collection)
 				utils::KeySet ancestorKeys;
 				ancestorKeys.insert(topKey);
 				auto numTopLevels = FindAncestors(m_multisigCache, topKey, ancestorKeys);
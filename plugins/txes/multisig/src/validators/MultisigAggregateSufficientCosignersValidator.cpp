@@ -22,7 +22,9 @@
 #include "src/cache/MultisigCache.h"
 #include "src/model/ModifyMultisigAccountTransaction.h"
 #include "catapult/utils/ArraySet.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/validators/ValidatorContext.h"
+#include <unordered_map>
 
 namespace catapult { namespace validators {
 
@@ -93,18 +95,28 @@ namespace catapult { namespace validators {
 				if (multisigEntry.cosignatories().empty())
 					return m_cosigners.cend() != m_cosigners.find(&publicKey);
 
+				// operation type is fixed for a single check, so results of shared multisig subtrees can be reused
+				// (results are not kept across notifications because observers can modify the multisig cache between them,
+				// even between embedded transactions of the same aggregate, and the cache does not expose such changes)
+				auto iter = m_satisfiedMultisigAccounts.find(publicKey);
+				if (m_satisfiedMultisigAccounts.cend() != iter)
+					return iter->second;
+
 				// if the account is multisig, get the entry and check the number of approvers against the minimum number
 				auto numApprovers = 0u;
 				for (const auto& cosignatoryPublicKey : multisigEntry.cosignatories())
 					numApprovers += isSatisfied(cosignatoryPublicKey, operationType) ? 1 : 0;
 
-				return numApprovers >= GetMinRequiredCosigners(multisigEntry, operationType);
+				auto isAccountSatisfied = numApprovers >= GetMinRequiredCosigners(multisigEntry, operationType);
+				m_satisfiedMultisigAccounts.emplace(publicKey, isAccountSatisfied);
+				return isAccountSatisfied;
 			}
 
 		private:
 			const Notification& m_notification;
 			const cache::MultisigCache::CacheReadOnlyType& m_multisigCache;
 			utils::KeyPointerSet m_cosigners;
+			std::unordered_map<Key, bool, utils::ArrayHasher<Key>> m_satisfiedMultisigAccounts;
 		};
 	}
 
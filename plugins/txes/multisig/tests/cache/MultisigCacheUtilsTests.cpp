@@ -157,4 +157,59 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region shared subtrees
+
+	namespace {
+		template<typename TAction>
+		void RunMultisigDiamondTest(TAction action) {
+			// Arrange: 0 - 1 - 3 - 4 - 5
+			//            \ 2 /
+			auto keys = test::GenerateKeys(6);
+			auto cache = test::MultisigCacheFactory::Create();
+			{
+				auto cacheDelta = cache.createDelta();
+				test::MakeMultisig(cacheDelta, keys[0], { keys[1], keys[2] });
+				test::MakeMultisig(cacheDelta, keys[1], { keys[3] });
+				test::MakeMultisig(cacheDelta, keys[2], { keys[3] });
+				test::MakeMultisig(cacheDelta, keys[3], { keys[4] });
+				test::MakeMultisig(cacheDelta, keys[4], { keys[5] });
+				cache.commit(Height());
+			}
+
+			auto cacheView = cache.createView();
+			auto readOnlyCache = cacheView.toReadOnly();
+
+			// Act:
+			action(readOnlyCache.sub<cache::MultisigCache>(), keys);
+		}
+	}
+
+	TEST(TEST_CLASS, CanFindAllDescendantsWhenSubtreeIsShared) {
+		// Arrange:
+		RunMultisigDiamondTest([](const auto& cache, const auto& keys) {
+			// Act:
+			utils::KeySet descendantKeys;
+			auto numLevels = FindDescendants(cache, keys[0], descendantKeys);
+
+			// Assert:
+			EXPECT_EQ(4u, numLevels);
+			EXPECT_EQ(utils::KeySet({ keys[1], keys[2], keys[3], keys[4], keys[5] }), descendantKeys);
+		});
+	}
+
+	TEST(TEST_CLASS, CanFindAllAncestorsWhenSubtreeIsShared) {
+		// Arrange:
+		RunMultisigDiamondTest([](const auto& cache, const auto& keys) {
+			// Act:
+			utils::KeySet ancestorKeys;
+			auto numLevels = FindAncestors(cache, keys[5], ancestorKeys);
+
+			// Assert:
+			EXPECT_EQ(4u, numLevels);
+			EXPECT_EQ(utils::KeySet({ keys[4], keys[3], keys[2], keys[1], keys[0] }), ancestorKeys);
+		});
+	}
+
+	// endregion
 }}
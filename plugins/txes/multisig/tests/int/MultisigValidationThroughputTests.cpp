@@ -0,0 +1,166 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "src/validators/Validators.h"
+#include "src/cache/MultisigCache.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/MultisigCacheTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/test/plugins/ValidatorTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace validators {
+
+#define TEST_CLASS MultisigValidationThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Aggregates = 10'000;
+#else
+		constexpr size_t Num_Aggregates = 1'000;
+#endif
+
+		// every account on a level is a cosignatory of every account on the level above it,
+		// so the number of paths from the root to the leaves grows exponentially with the number of levels
+		constexpr size_t Num_Levels = 5;
+		constexpr size_t Num_Accounts_Per_Level = 6;
+		constexpr uint8_t Min_Approval = 4;
+		constexpr uint8_t Max_Multisig_Depth = 10;
+
+		class MultisigTree {
+		public:
+			MultisigTree() : m_cache(test::MultisigCacheFactory::Create()) {
+				m_rootKey = test::GenerateRandomData<Key_Size>();
+				std::vector<Key> parentKeys{ m_rootKey };
+				for (auto level = 1u; level < Num_Levels; ++level) {
+					auto levelKeys = test::GenerateRandomDataVector<Key>(Num_Accounts_Per_Level);
+					auto delta = m_cache.createDelta();
+					auto& multisigCache = delta.sub<cache::MultisigCache>();
+					for (const auto& parentKey : parentKeys) {
+						auto& multisigEntry = getOrCreateEntry(multisigCache, parentKey);
+						multisigEntry.setMinApproval(Min_Approval);
+						multisigEntry.setMinRemoval(Min_Approval);
+						for (const auto& key : levelKeys) {
+							multisigEntry.cosignatories().insert(key);
+							getOrCreateEntry(multisigCache, key).multisigAccounts().insert(parentKey);
+						}
+					}
+
+					m_cache.commit(Height());
+					parentKeys = std::move(levelKeys);
+				}
+
+				m_leafKeys = std::move(parentKeys);
+			}
+
+		public:
+			const cache::CatapultCache& cache() const {
+				return m_cache;
+			}
+
+			const Key& rootKey() const {
+				return m_rootKey;
+			}
+
+			const std::vector<Key>& leafKeys() const {
+				return m_leafKeys;
+			}
+
+		private:
+			static state::MultisigEntry& getOrCreateEntry(cache::MultisigCacheDelta& multisigCache, const Key& key) {
+				if (!multisigCache.contains(key))
+					multisigCache.insert(state::MultisigEntry(key));
+
+				return multisigCache.get(key);
+			}
+
+		private:
+			cache::CatapultCache m_cache;
+			Key m_rootKey;
+			std::vector<Key> m_leafKeys;
+		};
+
+		template<typename TValidate>
+		void MeasureValidation(const char* name, const MultisigTree& tree, TValidate validate) {
+			// Arrange:
+			auto cacheView = tree.cache().createView();
+			auto readOnlyCache = cacheView.toReadOnly();
+			auto context = test::CreateValidatorContext(Height(), readOnlyCache);
+
+			// Act:
+			size_t numSuccesses = 0;
+			uint64_t elapsedMillis;
+			{
+				utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+				for (auto i = 0u; i < Num_Aggregates; ++i)
+					numSuccesses += IsValidationResultSuccess(validate(context, i)) ? 1 : 0;
+
+				elapsedMillis = stopwatch.millis();
+			}
+
+			// Assert:
+			CATAPULT_LOG(info)
+					<< name << " validated " << Num_Aggregates << " notifications against " << Num_Levels << " level multisig tree in "
+					<< elapsedMillis << "ms";
+			EXPECT_EQ(Num_Aggregates, numSuccesses);
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ValidationThroughput_SufficientCosigners) {
+		// Arrange: all leaves cosign, so every account in the tree needs to be checked
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		MultisigTree tree;
+
+		auto pTransaction = std::make_unique<model::EmbeddedTransaction>();
+		pTransaction->Size = sizeof(model::EmbeddedTransaction);
+		pTransaction->Signer = tree.rootKey();
+
+		auto aggregateSigner = tree.leafKeys()[0];
+		std::vector<model::Cosignature> cosignatures(tree.leafKeys().size() - 1);
+		for (auto i = 0u; i < cosignatures.size(); ++i)
+			cosignatures[i].Signer = tree.leafKeys()[i + 1];
+
+		auto pValidator = CreateMultisigAggregateSufficientCosignersValidator();
+
+		// Act + Assert:
+		MeasureValidation("sufficient cosigners", tree, [&](const auto& context, auto) {
+			using Notification = model::AggregateEmbeddedTransactionNotification;
+			Notification notification(aggregateSigner, *pTransaction, cosignatures.size(), cosignatures.data());
+			return test::ValidateNotification(*pValidator, notification, context);
+		});
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ValidationThroughput_LoopAndLevel) {
+		// Arrange: add new cosignatories to the leaves, so all ancestors up to the root need to be checked
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		MultisigTree tree;
+
+		auto newCosignatoryKeys = test::GenerateRandomDataVector<Key>(Num_Aggregates);
+		auto pValidator = CreateModifyMultisigLoopAndLevelValidator(Max_Multisig_Depth);
+
+		// Act + Assert:
+		MeasureValidation("loop and level", tree, [&](const auto& context, auto i) {
+			const auto& multisigKey = tree.leafKeys()[i % tree.leafKeys().size()];
+			model::ModifyMultisigNewCosignerNotification notification(multisigKey, newCosignatoryKeys[i]);
+			return test::ValidateNotification(*pValidator, notification, context);
+		});
+	}
+}}
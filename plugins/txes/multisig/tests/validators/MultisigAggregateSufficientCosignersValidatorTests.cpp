@@ -294,6 +294,53 @@ namespace catapult { namespace validators {
 		AssertValidationResult(ValidationResult::Success, cache, aggregateSigner, *pSubTransaction, cosigners);
 	}
 
+	namespace {
+		template<typename TGetCosigners>
+		void AssertSharedMultisigSubtreeResult(ValidationResult expectedResult, TGetCosigners getCosigners) {
+			// Arrange: keys = { embedded signer, M1, M2, S, P, Q, Y }
+			auto aggregateSigner = test::GenerateRandomData<Key_Size>();
+			auto keys = test::GenerateRandomDataVector<Key>(7);
+
+			auto pSubTransaction = CreateEmbeddedTransaction(keys[0]);
+
+			// - create the cache where E is a 2-2 multisig of { M1, M2 }, M1 is a 1-1 multisig of { S },
+			//   M2 is a 2-2 multisig of { S, Y } and S is a 2-2 multisig of { P, Q } (S is reachable from E along two paths)
+			auto cache = test::MultisigCacheFactory::Create();
+			{
+				auto cacheDelta = cache.createDelta();
+				test::MakeMultisig(cacheDelta, keys[0], { keys[1], keys[2] }, 2, 2);
+				test::MakeMultisig(cacheDelta, keys[1], { keys[3] }, 1, 1);
+				test::MakeMultisig(cacheDelta, keys[2], { keys[3], keys[6] }, 2, 2);
+				test::MakeMultisig(cacheDelta, keys[3], { keys[4], keys[5] }, 2, 2);
+				cache.commit(Height());
+			}
+
+			// Assert:
+			AssertValidationResult(expectedResult, cache, aggregateSigner, *pSubTransaction, getCosigners(keys));
+		}
+	}
+
+	TEST(TEST_CLASS, SufficientWhenSharedMultisigSubtreeIsSatisfied) {
+		// Assert: S is satisfied by P and Q, and M2 is additionally satisfied by Y
+		AssertSharedMultisigSubtreeResult(
+				ValidationResult::Success,
+				[](const auto& keys) { return std::vector<Key>{ keys[4], keys[5], keys[6] }; });
+	}
+
+	TEST(TEST_CLASS, InsufficientWhenSharedMultisigSubtreeIsNotSatisfied) {
+		// Assert: S is not satisfied by P alone, so neither M1 nor M2 is satisfied
+		AssertSharedMultisigSubtreeResult(
+				Failure_Aggregate_Missing_Cosigners,
+				[](const auto& keys) { return std::vector<Key>{ keys[4], keys[6] }; });
+	}
+
+	TEST(TEST_CLASS, InsufficientWhenSharedMultisigSubtreeIsSatisfiedButSiblingIsNot) {
+		// Assert: S (and thus M1) is satisfied, but M2 additionally requires Y
+		AssertSharedMultisigSubtreeResult(
+				Failure_Aggregate_Missing_Cosigners,
+				[](const auto& keys) { return std::vector<Key>{ keys[4], keys[5] }; });
+	}
+
 	// endregion
 
 	// region multisig modify account handling
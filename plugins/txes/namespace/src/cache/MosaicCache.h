@@ -22,6 +22,7 @@
 #include "MosaicCacheDelta.h"
 #include "MosaicCacheView.h"
 #include "catapult/cache/BasicCache.h"
+#include "catapult/cache/ValueUndoJournal.h"
 
 namespace catapult { namespace cache {
 
@@ -43,16 +44,55 @@ namespace catapult { namespace cache {
 		{}
 
 	public:
+		/// Returns a locked cache delta based on this cache.
+		/// \note This hides MosaicBasicCache::createDelta.
+		CacheDeltaType createDelta() {
+			if (m_pSizeUndoJournal)
+				m_pSizeUndoJournal->reset();
+
+			return MosaicBasicCache::createDelta();
+		}
+
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides MosaicBasicCache::commit.
 		void commit(const CacheDeltaType& delta) {
+			if (m_pSizeUndoJournal)
+				m_pSizeUndoJournal->record(*m_pDeepSize);
+
 			MosaicBasicCache::commit(delta);
 			*m_pDeepSize = delta.deepSize();
 		}
 
+	public:
+		/// Enables journaling of all subsequent commits so that they can be undone.
+		/// \note This hides MosaicBasicCache::enableUndoJournal.
+		void enableUndoJournal() {
+			MosaicBasicCache::enableUndoJournal();
+			if (!m_pSizeUndoJournal)
+				m_pSizeUndoJournal = std::make_unique<ValueUndoJournal<size_t>>();
+		}
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		/// \note This hides MosaicBasicCache::pruneUndoJournal.
+		void pruneUndoJournal(size_t numRetainedCommits) {
+			MosaicBasicCache::pruneUndoJournal(numRetainedCommits);
+			if (m_pSizeUndoJournal)
+				m_pSizeUndoJournal->prune(numRetainedCommits);
+		}
+
+		/// Reverts the changes of the \a numCommits most recent journaled commits in \a delta.
+		/// \note This hides MosaicBasicCache::undo.
+		void undo(CacheDeltaType& delta, size_t numCommits) {
+			MosaicBasicCache::undo(delta, numCommits);
+
+			// sizes are tracked by the delta, so they need to be restored explicitly
+			delta.resetDeepSize(m_pSizeUndoJournal->undo(numCommits));
+		}
+
 	private:
 		// unique pointer to allow reference to be valid after moves of this cache
 		std::unique_ptr<size_t> m_pDeepSize;
+		std::unique_ptr<ValueUndoJournal<size_t>> m_pSizeUndoJournal;
 	};
 
 	/// Synchronized cache composed of mosaic information.
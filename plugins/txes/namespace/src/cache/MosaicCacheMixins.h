@@ -38,6 +38,12 @@ namespace catapult { namespace cache {
 			return m_deepSize;
 		}
 
+		/// Resets the deep size to \a deepSize.
+		/// \note This is required when journaled commits are undone because the underlying sets are changed directly.
+		void resetDeepSize(size_t deepSize) {
+			m_deepSize = deepSize;
+		}
+
 	protected:
 		/// Increments the deep size.
 		void incrementDeepSize() {
@@ -159,6 +159,24 @@ namespace catapult { namespace cache {
 				NamespaceGrouping.commit();
 				HeightGrouping.commit();
 			}
+
+			void enableUndoJournal() {
+				Primary.enableUndoJournal();
+				NamespaceGrouping.enableUndoJournal();
+				HeightGrouping.enableUndoJournal();
+			}
+
+			void pruneUndoJournal(size_t numRetainedCommits) {
+				Primary.pruneUndoJournal(numRetainedCommits);
+				NamespaceGrouping.pruneUndoJournal(numRetainedCommits);
+				HeightGrouping.pruneUndoJournal(numRetainedCommits);
+			}
+
+			void undo(size_t numCommits) {
+				Primary.undo(numCommits);
+				NamespaceGrouping.undo(numCommits);
+				HeightGrouping.undo(numCommits);
+			}
 		};
 	};
 }}
@@ -22,6 +22,7 @@
 #include "NamespaceCacheDelta.h"
 #include "NamespaceCacheView.h"
 #include "catapult/cache/BasicCache.h"
+#include "catapult/cache/ValueUndoJournal.h"
 
 namespace catapult { namespace cache {
 
@@ -42,16 +43,55 @@ namespace catapult { namespace cache {
 		{}
 
 	public:
+		/// Returns a locked cache delta based on this cache.
+		/// \note This hides NamespaceBasicCache::createDelta.
+		CacheDeltaType createDelta() {
+			if (m_pSizeUndoJournal)
+				m_pSizeUndoJournal->reset();
+
+			return NamespaceBasicCache::createDelta();
+		}
+
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides NamespaceBasicCache::commit.
 		void commit(const CacheDeltaType& delta) {
+			if (m_pSizeUndoJournal)
+				m_pSizeUndoJournal->record(*m_pSizes);
+
 			NamespaceBasicCache::commit(delta);
 			*m_pSizes = { delta.activeSize(), delta.deepSize() };
 		}
 
+	public:
+		/// Enables journaling of all subsequent commits so that they can be undone.
+		/// \note This hides NamespaceBasicCache::enableUndoJournal.
+		void enableUndoJournal() {
+			NamespaceBasicCache::enableUndoJournal();
+			if (!m_pSizeUndoJournal)
+				m_pSizeUndoJournal = std::make_unique<ValueUndoJournal<NamespaceSizes>>();
+		}
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		/// \note This hides NamespaceBasicCache::pruneUndoJournal.
+		void pruneUndoJournal(size_t numRetainedCommits) {
+			NamespaceBasicCache::pruneUndoJournal(numRetainedCommits);
+			if (m_pSizeUndoJournal)
+				m_pSizeUndoJournal->prune(numRetainedCommits);
+		}
+
+		/// Reverts the changes of the \a numCommits most recent journaled commits in \a delta.
+		/// \note This hides NamespaceBasicCache::undo.
+		void undo(CacheDeltaType& delta, size_t numCommits) {
+			NamespaceBasicCache::undo(delta, numCommits);
+
+			// sizes are tracked by the delta, so they need to be restored explicitly
+			delta.resetSizes(m_pSizeUndoJournal->undo(numCommits));
+		}
+
 	private:
 		// unique pointer to allow reference to be valid after moves of this cache
 		std::unique_ptr<NamespaceSizes> m_pSizes;
+		std::unique_ptr<ValueUndoJournal<NamespaceSizes>> m_pSizeUndoJournal;
 	};
 
 	/// Synchronized cache composed of namespace information.
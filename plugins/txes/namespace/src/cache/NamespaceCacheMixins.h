@@ -54,6 +54,12 @@ namespace catapult { namespace cache {
 			return m_sizes.Deep;
 		}
 
+		/// Resets all sizes to \a sizes.
+		/// \note This is required when journaled commits are undone because the underlying sets are changed directly.
+		void resetSizes(const NamespaceSizes& sizes) {
+			m_sizes = sizes;
+		}
+
 	protected:
 		/// Increments the active size by \a delta.
 		void incrementActiveSize(size_t delta = 1) {
@@ -140,6 +140,24 @@ namespace catapult { namespace cache {
 				FlatMap.commit();
 				HeightGrouping.commit();
 			}
+
+			void enableUndoJournal() {
+				Primary.enableUndoJournal();
+				FlatMap.enableUndoJournal();
+				HeightGrouping.enableUndoJournal();
+			}
+
+			void pruneUndoJournal(size_t numRetainedCommits) {
+				Primary.pruneUndoJournal(numRetainedCommits);
+				FlatMap.pruneUndoJournal(numRetainedCommits);
+				HeightGrouping.pruneUndoJournal(numRetainedCommits);
+			}
+
+			void undo(size_t numCommits) {
+				Primary.undo(numCommits);
+				FlatMap.undo(numCommits);
+				HeightGrouping.undo(numCommits);
+			}
 		};
 	};
 }}
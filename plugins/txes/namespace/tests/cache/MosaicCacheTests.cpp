@@ -180,6 +180,33 @@ namespace catapult { namespace cache {
 		test::AssertCacheSizes(*view, 2, 5);
 	}
 
+	TEST(TEST_CLASS, DeepSizeIsRestoredByUndo) {
+		// Arrange:
+		MosaicCacheMixinTraits::CacheType cache;
+		cache.enableUndoJournal();
+		{
+			// - insert two definitions for one mosaic
+			auto delta = cache.createDelta();
+			delta->insert(test::CreateMosaicEntry(MosaicId(234), Amount(1)));
+			delta->insert(test::CreateMosaicEntry(MosaicId(234), Amount(2)));
+			cache.commit();
+
+			// - insert a definition for another mosaic and a third definition for the first mosaic
+			delta->insert(test::CreateMosaicEntry(MosaicId(432), Amount(1)));
+			delta->insert(test::CreateMosaicEntry(MosaicId(234), Amount(3)));
+			cache.commit();
+		}
+
+		auto delta = cache.createDelta();
+
+		// Act:
+		cache.undo(1);
+
+		// Assert: one mosaic, two definitions
+		test::AssertCacheSizes(*delta, 1, 2);
+		test::AssertCacheSizes(*cache.createView(), 2, 5);
+	}
+
 	// endregion
 
 	// region insert
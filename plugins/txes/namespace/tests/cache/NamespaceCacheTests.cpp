@@ -209,6 +209,35 @@ namespace catapult { namespace cache {
 		test::AssertCacheSizes(*view, 1, 3, 3);
 	}
 
+	TEST(TEST_CLASS, DeepSizeIsRestoredByUndo) {
+		// Arrange:
+		NamespaceCacheMixinTraits::CacheType cache;
+		cache.enableUndoJournal();
+		auto owner = test::CreateRandomOwner();
+		{
+			// - insert root with 1 child
+			auto delta = cache.createDelta();
+			delta->insert(state::RootNamespace(NamespaceId(123), owner, test::CreateLifetime(234, 321)));
+			delta->insert(state::Namespace(test::CreatePath({ 123, 127 })));
+			cache.commit();
+
+			// - add another child and renew root
+			delta->insert(state::Namespace(test::CreatePath({ 123, 128 })));
+			delta->insert(state::RootNamespace(NamespaceId(123), owner, test::CreateLifetime(345, 456)));
+			cache.commit();
+		}
+
+		auto delta = cache.createDelta();
+
+		// Act:
+		cache.undo(1);
+
+		// Assert: root + 1 child, no renewal
+		test::AssertCacheSizes(*delta, 1, 2, 2);
+		EXPECT_FALSE(delta->contains(NamespaceId(128)));
+		test::AssertCacheSizes(*cache.createView(), 1, 3, 6);
+	}
+
 	// endregion
 
 	// region DELTA_VIEW_BASED_TEST
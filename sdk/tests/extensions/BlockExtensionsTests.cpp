@@ -19,6 +19,7 @@
 **/
 
 #include "src/extensions/BlockExtensions.h"
+#include "sdk/tests/extensions/test/SignatureTestUtils.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/EntityHasher.h"
@@ -273,6 +274,27 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	REGISTRY_DEPENDENT_TEST(VerifyFullBlockFailsWhenTransactionSignatureHasSmallOrderRComponent) {
+		// Arrange:
+		TTraits::RunExtensionsTest([](const auto& extensions) {
+			auto signer = test::GenerateKeyPair();
+			auto pBlock = CreateValidBlock<TTraits>(signer);
+			auto transactions = pBlock->Transactions();
+			auto iter = ++transactions.begin();
+			auto& transaction = reinterpret_cast<model::Transaction&>(*iter);
+			auto transactionSigner = test::GenerateKeyPair();
+			transaction.Signer = transactionSigner.publicKey();
+			test::SignTransactionWithSmallOrderR(transactionSigner, transaction);
+			extensions.signFullBlock(signer, *pBlock); // fix block transactions hash and block signature
+
+			// Act:
+			auto result = extensions.verifyFullBlock(*pBlock);
+
+			// Assert:
+			EXPECT_EQ(VerifyFullBlockResult::Invalid_Transaction_Signature, result);
+		});
+	}
+
 	REGISTRY_DEPENDENT_TEST(VerifyFullBlockFailsWhenBlockTransactionsHashIsAltered) {
 		// Arrange:
 		TTraits::RunExtensionsTest([](const auto& extensions) {
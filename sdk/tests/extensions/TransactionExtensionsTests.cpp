@@ -19,6 +19,7 @@
 **/
 
 #include "src/extensions/TransactionExtensions.h"
+#include "sdk/tests/extensions/test/SignatureTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -86,6 +87,17 @@ namespace catapult { namespace extensions {
 		EXPECT_FALSE(VerifyTransactionSignature(*pEntity));
 	}
 
+	TRAITS_BASED_TEST(CannotValidateSignedTransactionWithSmallOrderRComponent) {
+		// Arrange:
+		auto pEntity = test::GenerateRandomTransaction(TTraits::Entity_Size);
+		auto signer = test::GenerateKeyPair();
+		(*pEntity).Signer = signer.publicKey();
+		test::SignTransactionWithSmallOrderR(signer, *pEntity);
+
+		// Act + Assert:
+		EXPECT_FALSE(VerifyTransactionSignature(*pEntity));
+	}
+
 	// region Deterministic Entity Sanity
 
 	TEST(TEST_CLASS, DeterministicTransactionIsFullyVerifiable) {
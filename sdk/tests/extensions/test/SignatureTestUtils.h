@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "catapult/crypto/CryptoUtils.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/KeyPair.h"
+#include "catapult/model/Transaction.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+extern "C" {
+#include <ref10/ge.h>
+#include <ref10/sc.h>
+}
+
+namespace catapult { namespace test {
+
+	/// Signs \a dataBuffer with \a keyPair such that R of the resulting \a signature has an order 2 component.
+	/// \note The signature satisfies the cofactored verification equation but not the (cofactorless) one used by crypto::Verify.
+	inline void SignWithSmallOrderR(const crypto::KeyPair& keyPair, const RawBuffer& dataBuffer, Signature& signature) {
+		auto* pEncodedR = signature.data();
+		auto* pEncodedS = signature.data() + Signature_Size / 2;
+
+		// r = random scalar
+		Hash512 r;
+		FillWithRandomData(r);
+		sc_reduce(r.data());
+
+		// R = r * B + T, where T = (0, -1) is the point of order 2
+		uint8_t encodedT[Key_Size];
+		std::fill(encodedT, encodedT + Key_Size, static_cast<uint8_t>(0xFF));
+		encodedT[0] = 0xEC;
+		encodedT[Key_Size - 1] = 0x7F;
+
+		ge_p3 T;
+		ge_frombytes_negate_vartime(&T, encodedT); // -T == T
+		ge_cached cachedT;
+		ge_p3_to_cached(&cachedT, &T);
+
+		ge_p3 rMulBase;
+		ge_scalarmult_base(&rMulBase, r.data());
+		ge_p1p1 sum;
+		ge_add(&sum, &rMulBase, &cachedT);
+		ge_p3 R;
+		ge_p1p1_to_p3(&R, &sum);
+		ge_p3_tobytes(pEncodedR, &R);
+
+		// h = H(encodedR || public || data) mod group order
+		Hash512 h;
+		crypto::Sha3_512_Builder sha3_h;
+		sha3_h.update({ { pEncodedR, Signature_Size / 2 }, keyPair.publicKey(), dataBuffer });
+		sha3_h.final(h);
+		sc_reduce(h.data());
+
+		// a = clamped lower half of H(private)
+		Hash512 privHash;
+		crypto::HashPrivateKey(keyPair.privateKey(), privHash);
+		privHash[0] &= 0xF8;
+		privHash[31] &= 0x7F;
+		privHash[31] |= 0x40;
+
+		// S = (r + h * a) mod group order
+		sc_muladd(pEncodedS, h.data(), privHash.data(), r.data());
+	}
+
+	/// Signs \a transaction with \a keyPair such that R of its signature has an order 2 component.
+	inline void SignTransactionWithSmallOrderR(const crypto::KeyPair& keyPair, model::Transaction& transaction) {
+		auto headerSize = model::VerifiableEntity::Header_Size;
+		SignWithSmallOrderR(
+				keyPair,
+				{ reinterpret_cast<const uint8_t*>(&transaction) + headerSize, transaction.Size - headerSize },
+				transaction.Signature);
+	}
+}}
@@ -64,6 +64,22 @@ namespace catapult { namespace cache {
 			Commit(m_set, delta, ContainerPolicy<TBaseSet>());
 		}
 
+		/// Enables journaling of all subsequent commits so that they can be undone.
+		void enableUndoJournal() {
+			m_set.enableUndoJournal();
+		}
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		void pruneUndoJournal(size_t numRetainedCommits) {
+			m_set.pruneUndoJournal(numRetainedCommits);
+		}
+
+		/// Reverts the changes of the \a numCommits most recent journaled commits in \a delta.
+		void undo(CacheDeltaType&, size_t numCommits) {
+			// the underlying sets revert the changes in their attached deltas, which are shared with the delta
+			m_set.undo(numCommits);
+		}
+
 	private:
 		template<typename TView, typename TSetView>
 		TView createSubView(const TSetView& setView) const {
@@ -55,6 +55,11 @@ namespace catapult { namespace cache {
 		{}
 
 	public:
+		/// Gets the cache height.
+		Height get() const {
+			return m_height;
+		}
+
 		/// Sets the cache height to \a height.
 		void set(Height height) {
 			m_height = height;
@@ -22,6 +22,8 @@
 #include "CacheStorageInclude.h"
 #include <string>
 
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
+
 namespace catapult { namespace cache {
 
 	/// Interface for loading and saving cache data.
@@ -37,7 +39,8 @@ namespace catapult { namespace cache {
 		/// Saves cache data to \a output.
 		virtual void saveAll(io::OutputStream& output) const = 0;
 
-		/// Loads cache data from \a input in batches of \a batchSize.
-		virtual void loadAll(io::InputStream& input, size_t batchSize) = 0;
+		/// Loads cache data from \a input in batches of \a batchSize using \a pool for any parallel processing.
+		/// \note \a pool must not be used to call this function because the call can block waiting for work posted to \a pool.
+		virtual void loadAll(io::InputStream& input, size_t batchSize, thread::IoServiceThreadPool& pool) = 0;
 	};
 }}
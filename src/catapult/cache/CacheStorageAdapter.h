@@ -21,17 +21,34 @@
 #pragma once
 #include "CacheStorage.h"
 #include "ChunkedDataLoader.h"
+#include "ParallelChunkedDataLoader.h"
 
 namespace catapult { namespace cache {
 
+	/// Default number of entries stored in each chunk by storage traits that support chunked data.
+	constexpr size_t Default_Entries_Per_Chunk = 16 * 1024;
+
 	/// A CacheStorage implementation that wraps a cache and associated storage traits.
+	/// \note Storage traits that define StagingType save data in independently loadable chunks that are parsed in parallel
+	///       and committed at once. Chunks are written from a snapshot created by the storage traits, which must not be
+	///       affected by subsequent commits. Data saved as a plain sequence of entries can be loaded by all storage traits.
 	template<typename TCache, typename TStorageTraits>
 	class CacheStorageAdapter : public CacheStorage {
+	private:
+		enum class StorageFormat { Sequential, Chunked };
+		using SequentialStorageFlag = std::integral_constant<StorageFormat, StorageFormat::Sequential>;
+		using ChunkedStorageFlag = std::integral_constant<StorageFormat, StorageFormat::Chunked>;
+
 	public:
 		/// Creates an adapter around \a cache.
-		explicit CacheStorageAdapter(TCache& cache)
+		explicit CacheStorageAdapter(TCache& cache) : CacheStorageAdapter(cache, Default_Entries_Per_Chunk)
+		{}
+
+		/// Creates an adapter around \a cache that stores at most \a numEntriesPerChunk entries in each chunk.
+		CacheStorageAdapter(TCache& cache, size_t numEntriesPerChunk)
 				: m_cache(cache)
 				, m_name(TCache::Name)
+				, m_numEntriesPerChunk(std::max<size_t>(1, numEntriesPerChunk))
 		{}
 
 	public:
@@ -41,28 +58,93 @@ namespace catapult { namespace cache {
 
 	public:
 		void saveAll(io::OutputStream& output) const override {
+			save(output, StorageFormatAccessor<TStorageTraits>());
+			output.flush();
+		}
+
+		void loadAll(io::InputStream& input, size_t batchSize, thread::IoServiceThreadPool& pool) override {
+			auto delta = m_cache.createDelta();
+
+			auto numEntries = io::Read64(input);
+			if (Chunked_Data_Marker == numEntries) {
+				loadChunked(input, *delta, pool, StorageFormatAccessor<TStorageTraits>());
+				m_cache.commit();
+				return;
+			}
+
+			ChunkedDataLoader<TStorageTraits> loader(input, numEntries);
+			while (loader.hasNext()) {
+				loader.next(batchSize, *delta);
+				m_cache.commit();
+			}
+		}
+
+	private:
+		void save(io::OutputStream& output, SequentialStorageFlag) const {
 			auto view = m_cache.createView();
 			io::Write64(output, view->size());
 
 			auto pIterableView = view->tryMakeIterableView();
 			for (const auto& value : *pIterableView)
 				TStorageTraits::Save(value, output);
-
-			output.flush();
 		}
 
-		void loadAll(io::InputStream& input, size_t batchSize) override {
-			auto delta = m_cache.createDelta();
+		void save(io::OutputStream& output, ChunkedStorageFlag) const {
+			// the snapshot is detached from the cache, so the view can be released before any data is written
+			typename TStorageTraits::SnapshotType snapshot;
+			{
+				auto view = m_cache.createView();
+				snapshot = TStorageTraits::CreateSnapshot(*view);
+			}
 
-			ChunkedDataLoader<TStorageTraits> loader(input);
-			while (loader.hasNext()) {
-				loader.next(batchSize, *delta);
-				m_cache.commit();
+			uint64_t numEntries = snapshot.size();
+			io::Write64(output, Chunked_Data_Marker);
+			io::Write64(output, numEntries);
+			io::Write64(output, (numEntries + m_numEntriesPerChunk - 1) / m_numEntriesPerChunk);
+
+			std::vector<uint8_t> chunkBuffer;
+			for (uint64_t startIndex = 0; startIndex < numEntries; startIndex += m_numEntriesPerChunk) {
+				auto numChunkEntries = std::min<uint64_t>(m_numEntriesPerChunk, numEntries - startIndex);
+
+				chunkBuffer.clear();
+				io::BufferOutputStreamAdapter chunkOutput(chunkBuffer);
+				TStorageTraits::SaveChunk(snapshot, startIndex, numChunkEntries, chunkOutput);
+
+				io::Write64(output, numChunkEntries);
+				io::Write64(output, chunkBuffer.size());
+				output.write(chunkBuffer);
 			}
 		}
 
+		void loadChunked(
+				io::InputStream&,
+				typename TStorageTraits::DestinationType&,
+				thread::IoServiceThreadPool&,
+				SequentialStorageFlag) const {
+			CATAPULT_THROW_RUNTIME_ERROR_1("storage does not support chunked data", m_name);
+		}
+
+		void loadChunked(
+				io::InputStream& input,
+				typename TStorageTraits::DestinationType& destination,
+				thread::IoServiceThreadPool& pool,
+				ChunkedStorageFlag) const {
+			ParallelChunkedDataLoader<TStorageTraits> loader(input, pool);
+			loader.loadAll(destination);
+		}
+
+	private:
+		template<typename T, typename = void>
+		struct StorageFormatAccessor : SequentialStorageFlag
+		{};
+
+		template<typename T>
+		struct StorageFormatAccessor<T, typename utils::traits::enable_if_type<typename T::StagingType>::type> : ChunkedStorageFlag
+		{};
+
 	private:
 		TCache& m_cache;
 		std::string m_name;
+		size_t m_numEntriesPerChunk;
 	};
 }}
@@ -25,6 +25,7 @@
 #include "SubCachePluginAdapter.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkInfo.h"
+#include <deque>
 
 namespace catapult { namespace cache {
 
@@ -160,6 +161,35 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	struct CatapultCache::UndoJournal {
+	public:
+		explicit UndoJournal(uint32_t maxRollbackBlocks)
+				: MaxRollbackBlocks(maxRollbackBlocks)
+				, NumUndoneCommits(0)
+				, IsInvalidated(false)
+		{}
+
+	public:
+		/// Maximum number of blocks that can be rolled back.
+		uint32_t MaxRollbackBlocks;
+
+		/// Cache heights before all journaled commits (oldest first).
+		std::deque<Height> Heights;
+
+		/// Number of (most recent) journaled commits that are undone in the outstanding attached delta.
+		size_t NumUndoneCommits;
+
+		/// \c true if changes were undone that are not journaled.
+		bool IsInvalidated;
+
+	public:
+		/// Resets all undo state associated with the outstanding attached delta.
+		void reset() {
+			NumUndoneCommits = 0;
+			IsInvalidated = false;
+		}
+	};
+
 	CatapultCache::CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches)
 			: m_pCacheHeight(std::make_unique<CacheHeight>())
 			, m_subCaches(std::move(subCaches))
@@ -179,6 +209,10 @@ namespace catapult { namespace cache {
 	}
 
 	CatapultCacheDelta CatapultCache::createDelta() {
+		// commits undone in a previous delta were discarded together with that delta
+		if (m_pUndoJournal)
+			m_pUndoJournal->reset();
+
 		// since only one subcache delta is allowed outstanding at a time and an outstanding delta is required for commit,
 		// subcache deltas will always be consistent
 		auto subViews = MapSubCaches<SubCacheView>(m_subCaches, [](const auto& pSubCache) { return pSubCache->createDelta(); });
@@ -203,10 +237,79 @@ namespace catapult { namespace cache {
 				pSubCache->commit();
 		}
 
+		if (m_pUndoJournal)
+			updateUndoJournal(cacheHeightModifier.get(), height);
+
 		// finally, update the cache height
 		cacheHeightModifier.set(height);
 	}
 
+	void CatapultCache::enableUndoJournal(uint32_t maxRollbackBlocks) {
+		for (const auto& pSubCache : m_subCaches) {
+			if (pSubCache)
+				pSubCache->enableUndoJournal();
+		}
+
+		m_pUndoJournal = std::make_unique<UndoJournal>(maxRollbackBlocks);
+	}
+
+	Height CatapultCache::undo(Height height) {
+		if (!m_pUndoJournal)
+			return m_pCacheHeight->view().get();
+
+		auto& journal = *m_pUndoJournal;
+		auto numJournaledCommits = journal.Heights.size() - journal.NumUndoneCommits;
+		auto undoneHeight = 0 == journal.NumUndoneCommits
+				? m_pCacheHeight->view().get()
+				: journal.Heights[numJournaledCommits];
+
+		// undo all commits that started at or above height
+		size_t numCommits = 0;
+		while (numCommits < numJournaledCommits && journal.Heights[numJournaledCommits - numCommits - 1] >= height) {
+			undoneHeight = journal.Heights[numJournaledCommits - numCommits - 1];
+			++numCommits;
+		}
+
+		if (0 != numCommits) {
+			for (const auto& pSubCache : m_subCaches) {
+				if (pSubCache)
+					pSubCache->undo(numCommits);
+			}
+		}
+
+		journal.NumUndoneCommits += numCommits;
+		if (height != undoneHeight)
+			journal.IsInvalidated = true;
+
+		return undoneHeight;
+	}
+
+	void CatapultCache::updateUndoJournal(Height previousHeight, Height height) {
+		auto& journal = *m_pUndoJournal;
+		if (journal.IsInvalidated) {
+			// some committed changes were reverted outside of the journal, so no journaled commit can be undone anymore
+			journal.Heights.clear();
+		} else {
+			// the subcaches merged all undone commits into the latest commit
+			for (auto i = 0u; i < journal.NumUndoneCommits; ++i) {
+				previousHeight = journal.Heights.back();
+				journal.Heights.pop_back();
+			}
+
+			journal.Heights.push_back(previousHeight);
+
+			// drop all commits that started below the lowest height that can be rolled back to
+			while (!journal.Heights.empty() && journal.Heights.front().unwrap() + journal.MaxRollbackBlocks + 1 < height.unwrap())
+				journal.Heights.pop_front();
+		}
+
+		journal.reset();
+		for (const auto& pSubCache : m_subCaches) {
+			if (pSubCache)
+				pSubCache->pruneUndoJournal(journal.Heights.size());
+		}
+	}
+
 	std::vector<std::unique_ptr<const CacheStorage>> CatapultCache::storages() const {
 		return MapSubCaches<const CacheStorage>(
 				m_subCaches,
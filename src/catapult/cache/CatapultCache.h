@@ -71,6 +71,16 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
 		void commit(Height height);
 
+	public:
+		/// Enables journaling of all subsequent commits so that the changes of the most recent \a maxRollbackBlocks blocks
+		/// can be undone.
+		void enableUndoJournal(uint32_t maxRollbackBlocks);
+
+		/// Reverts the changes of all journaled commits that were made at or above \a height in the outstanding attached delta.
+		/// Returns the height of the reverted state, which is greater than \a height when not all changes are journaled.
+		/// \note In that case, the caller is expected to revert the remaining changes and the journal is discarded by the next commit.
+		Height undo(Height height);
+
 	public:
 		/// Gets cache storages for all subcaches.
 		std::vector<std::unique_ptr<const CacheStorage>> storages() const;
@@ -78,8 +88,14 @@ namespace catapult { namespace cache {
 		/// Gets cache storages for all subcaches.
 		std::vector<std::unique_ptr<CacheStorage>> storages();
 
+	private:
+		struct UndoJournal;
+
+		void updateUndoJournal(Height previousHeight, Height height);
+
 	private:
 		std::unique_ptr<CacheHeight> m_pCacheHeight; // use a unique_ptr to allow fwd declare
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		std::unique_ptr<UndoJournal> m_pUndoJournal; // only set when commits are journaled
 	};
 }}
@@ -37,11 +37,16 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a chunked loader around \a input.
-		explicit ChunkedDataLoader(io::InputStream& input)
+		explicit ChunkedDataLoader(io::InputStream& input) : ChunkedDataLoader(input, io::Read64(input))
+		{}
+
+		/// Creates a chunked loader around \a input containing \a numEntries entries.
+		/// \note The entry count is expected to have been consumed from \a input already.
+		ChunkedDataLoader(io::InputStream& input, uint64_t numEntries)
 				: m_input(input)
-				, m_loader(CreateLoader(LoadStateAccessor<TStorageTraits>())) {
-			m_numRemainingEntries = io::Read64(input);
-		}
+				, m_numRemainingEntries(numEntries)
+				, m_loader(CreateLoader(LoadStateAccessor<TStorageTraits>()))
+		{}
 
 	public:
 		/// Returns \c true if there are more entries in the input.
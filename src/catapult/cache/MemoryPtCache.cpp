@@ -23,10 +23,17 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/model/Cosignature.h"
 #include "catapult/state/TimestampedHash.h"
+#include <algorithm>
 #include <set>
 
 namespace catapult { namespace cache {
 
+	namespace {
+		bool IsSignerLess(const model::Cosignature& cosignature, const Key& signer) {
+			return cosignature.Signer < signer;
+		}
+	}
+
 	class PtData {
 	public:
 		explicit PtData(const model::DetachedTransactionInfo& transactionInfo)
@@ -65,27 +72,27 @@ namespace catapult { namespace cache {
 
 	public:
 		bool add(const Key& signer, const Signature& signature) {
-			if (weakCosignedTransactionInfo().hasCosigner(signer))
+			// cosignatures are sorted by signer, so the insertion point can be used to check for an existing cosigner
+			auto iter = std::lower_bound(m_cosignatures.begin(), m_cosignatures.end(), signer, IsSignerLess);
+			if (m_cosignatures.end() != iter && signer == iter->Signer)
 				return false;
 
-			// insert cosignature into sorted vector
-			auto iter = m_cosignatures.begin();
-			while (m_cosignatures.end() != iter && iter->Signer < signer)
-				++iter;
+			model::Cosignature cosignature{ signer, signature };
+			m_cosignatures.insert(iter, cosignature);
 
-			m_cosignatures.insert(iter, { signer, signature });
+			// fold the new cosignature into the cosignatures hash instead of rehashing all cosignatures
+			Hash256 cosignatureHash;
+			crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&cosignature), sizeof(model::Cosignature) }, cosignatureHash);
+			for (auto i = 0u; i < Hash256_Size; ++i)
+				m_cosignaturesHash[i] ^= cosignatureHash[i];
 
-			// recalculate the cosignatures hash
-			crypto::Sha3_256(
-					{ reinterpret_cast<const uint8_t*>(m_cosignatures.data()), m_cosignatures.size() * sizeof(model::Cosignature) },
-					m_cosignaturesHash);
 			return true;
 		}
 
 	private:
 		model::DetachedTransactionInfo m_transactionInfo;
-		Hash256 m_cosignaturesHash;
-		std::vector<model::Cosignature> m_cosignatures; // sorted by signer so that sets of cosignatures added in different order match
+		Hash256 m_cosignaturesHash; // xor of the hashes of all cosignatures so that it is independent of the order of adds
+		std::vector<model::Cosignature> m_cosignatures; // sorted by signer
 	};
 
 	// region MemoryPtCacheView
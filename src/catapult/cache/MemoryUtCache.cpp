@@ -22,6 +22,8 @@
 #include "AccountCounters.h"
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
+#include <algorithm>
+#include <unordered_set>
 
 namespace catapult { namespace cache {
 
@@ -46,15 +48,81 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	struct TransactionFeeDensityKey {
+	public:
+		explicit TransactionFeeDensityKey(const TransactionData& data)
+				: Fee(data.pEntity->Fee)
+				, Size(data.pEntity->Size)
+				, Id(data.Id)
+				, pData(&data)
+		{}
+
+	public:
+		bool operator<(const TransactionFeeDensityKey& rhs) const {
+			// order by decreasing fee / size, which is equivalent to comparing fee * rhs.size and rhs.fee * size
+			// (products can overflow 64 bits, so compare them as 96 bit values split into high and low parts)
+			auto lhsProduct = Multiply(Fee, rhs.Size);
+			auto rhsProduct = Multiply(rhs.Fee, Size);
+			if (lhsProduct != rhsProduct)
+				return lhsProduct > rhsProduct;
+
+			// order by increasing arrival
+			return Id < rhs.Id;
+		}
+
+	private:
+		static std::pair<uint64_t, uint64_t> Multiply(Amount fee, uint32_t size) {
+			auto low = (fee.unwrap() & 0xFFFF'FFFF) * size;
+			auto high = (fee.unwrap() >> 32) * size + (low >> 32);
+			return std::make_pair(high, low & 0xFFFF'FFFF);
+		}
+
+	public:
+		Amount Fee;
+		uint32_t Size;
+		size_t Id;
+		const TransactionData* pData;
+	};
+
+	struct TransactionSignerKey {
+	public:
+		explicit TransactionSignerKey(const TransactionData& data)
+				: Signer(data.pEntity->Signer)
+				, Id(data.Id)
+				, pData(&data)
+		{}
+
+		TransactionSignerKey(const Key& signer, size_t id)
+				: Signer(signer)
+				, Id(id)
+				, pData(nullptr)
+		{}
+
+	public:
+		bool operator<(const TransactionSignerKey& rhs) const {
+			// order by signer and then by increasing arrival
+			return Signer != rhs.Signer ? Signer < rhs.Signer : Id < rhs.Id;
+		}
+
+	public:
+		Key Signer;
+		size_t Id;
+		const TransactionData* pData;
+	};
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
+			const TransactionFeeDensityIndex& feeDensityIndex,
+			const TransactionSignerIndex& signerIndex,
 			const IdLookup& idLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
+			, m_feeDensityIndex(feeDensityIndex)
+			, m_signerIndex(signerIndex)
 			, m_idLookup(idLookup)
 			, m_readLock(std::move(readLock))
 	{}
@@ -74,6 +142,61 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void MemoryUtCacheView::forEachByFeeDensity(const TransactionInfoConsumer& consumer) const {
+		for (const auto& key : m_feeDensityIndex) {
+			if (!consumer(*key.pData))
+				return;
+		}
+	}
+
+	std::vector<const model::TransactionInfo*> MemoryUtCacheView::selectByFeeDensity(size_t count) const {
+		// each signer's next unselected transaction is tracked along with all of its later transactions that were visited first
+		struct SignerState {
+			TransactionSignerIndex::const_iterator NextIter;
+			std::unordered_set<size_t> DeferredIds;
+		};
+
+		std::vector<const TransactionData*> selectedData;
+		std::unordered_map<Key, SignerState, utils::ArrayHasher<Key>> signerStates;
+		for (const auto& key : m_feeDensityIndex) {
+			if (count <= selectedData.size())
+				break;
+
+			const auto& signer = key.pData->pEntity->Signer;
+			auto stateIter = signerStates.find(signer);
+			if (signerStates.cend() == stateIter) {
+				auto nextIter = m_signerIndex.lower_bound(TransactionSignerKey(signer, 0));
+				stateIter = signerStates.emplace(signer, SignerState{ nextIter, {} }).first;
+			}
+
+			// defer the transaction until all earlier transactions of the same signer are selected
+			auto& state = stateIter->second;
+			if (key.Id != state.NextIter->Id) {
+				state.DeferredIds.insert(key.Id);
+				continue;
+			}
+
+			// select the transaction followed by all of the signer's deferred transactions that no longer need to wait
+			for (;;) {
+				selectedData.push_back(state.NextIter->pData);
+				++state.NextIter;
+
+				if (count <= selectedData.size() || m_signerIndex.cend() == state.NextIter || signer != state.NextIter->Signer)
+					break;
+
+				if (0 == state.DeferredIds.erase(state.NextIter->Id))
+					break;
+			}
+		}
+
+		// transactions were validated in arrival order, so they need to be added to a block in the same order
+		std::sort(selectedData.begin(), selectedData.end(), [](const auto* pLhs, const auto* pRhs) {
+			return pLhs->Id < pRhs->Id;
+		});
+
+		return std::vector<const model::TransactionInfo*>(selectedData.cbegin(), selectedData.cend());
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -116,12 +239,16 @@ namespace catapult { namespace cache {
 					uint64_t maxCacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
+					TransactionFeeDensityIndex& feeDensityIndex,
+					TransactionSignerIndex& signerIndex,
 					IdLookup& idLookup,
 					AccountCounters& counters,
 					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
+					, m_feeDensityIndex(feeDensityIndex)
+					, m_signerIndex(signerIndex)
 					, m_idLookup(idLookup)
 					, m_counters(counters)
 					, m_readLock(std::move(readLock))
@@ -141,7 +268,9 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_feeDensityIndex.emplace(*dataIter);
+				m_signerIndex.emplace(*dataIter);
 
 				m_counters.increment(transactionInfo.pEntity->Signer);
 
@@ -159,6 +288,8 @@ namespace catapult { namespace cache {
 
 				m_counters.decrement(dataIter->pEntity->Signer);
 
+				m_feeDensityIndex.erase(TransactionFeeDensityKey(*dataIter));
+				m_signerIndex.erase(TransactionSignerKey(*dataIter));
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -179,6 +310,8 @@ namespace catapult { namespace cache {
 				for (const auto& data : m_transactionDataContainer)
 					transactionInfosCopy.emplace_back(data.copy());
 
+				m_feeDensityIndex.clear();
+				m_signerIndex.clear();
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
 				m_counters.reset();
@@ -189,6 +322,8 @@ namespace catapult { namespace cache {
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
+			TransactionFeeDensityIndex& m_feeDensityIndex;
+			TransactionSignerIndex& m_signerIndex;
 			IdLookup& m_idLookup;
 			AccountCounters& m_counters;
 			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
@@ -202,6 +337,8 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
+		cache::TransactionFeeDensityIndex FeeDensityIndex;
+		cache::TransactionSignerIndex SignerIndex;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
 		AccountCounters Counters;
 	};
@@ -215,7 +352,13 @@ namespace catapult { namespace cache {
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, m_lock.acquireReader());
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->FeeDensityIndex,
+				m_pImpl->SignerIndex,
+				m_pImpl->IdLookup,
+				m_lock.acquireReader());
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -223,6 +366,8 @@ namespace catapult { namespace cache {
 				m_options.MaxCacheSize,
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->FeeDensityIndex,
+				m_pImpl->SignerIndex,
 				m_pImpl->IdLookup,
 				m_pImpl->Counters,
 				m_lock.acquireReader()));
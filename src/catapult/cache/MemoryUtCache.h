@@ -28,7 +28,13 @@
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		struct TransactionData;
+		struct TransactionFeeDensityKey;
+		struct TransactionSignerKey;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -36,6 +42,14 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Internal index of transaction data ordered by decreasing fee per byte wrapped by MemoryUtCache.
+	/// \note std::set is used to allow incomplete type.
+	using TransactionFeeDensityIndex = std::set<TransactionFeeDensityKey>;
+
+	/// Internal index of transaction data ordered by signer and arrival wrapped by MemoryUtCache.
+	/// \note std::set is used to allow incomplete type.
+	using TransactionSignerIndex = std::set<TransactionSignerKey>;
+
 	/// A read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
@@ -45,10 +59,13 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), a fee density index (\a feeDensityIndex), a signer index (\a signerIndex)
+		/// and an id lookup (\a idLookup) with lock context \a readLock.
 		explicit MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
+				const TransactionFeeDensityIndex& feeDensityIndex,
+				const TransactionSignerIndex& signerIndex,
 				const IdLookup& idLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
@@ -62,6 +79,16 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos ordered by decreasing fee per byte until all are consumed
+		/// or \c false is returned by consumer.
+		/// \note Transaction infos with equal fees per byte are ordered by arrival.
+		void forEachByFeeDensity(const TransactionInfoConsumer& consumer) const;
+
+		/// Selects at most \a count transaction infos paying the highest fees per byte and returns them ordered by arrival.
+		/// \note A transaction info is only selected when all transaction infos with the same signer that arrived before it
+		///       are selected too because it might depend on them.
+		std::vector<const model::TransactionInfo*> selectByFeeDensity(size_t count) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// A short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -72,6 +99,8 @@ namespace catapult { namespace cache {
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
+		const TransactionFeeDensityIndex& m_feeDensityIndex;
+		const TransactionSignerIndex& m_signerIndex;
 		const IdLookup& m_idLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
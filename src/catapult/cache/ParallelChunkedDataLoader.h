@@ -0,0 +1,131 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/io/BufferStreamAdapters.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/thread/Future.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/exceptions.h"
+#include <boost/asio/io_service.hpp>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Marker that replaces the entry count at the start of data stored in independently loadable chunks.
+	constexpr uint64_t Chunked_Data_Marker = std::numeric_limits<uint64_t>::max();
+
+	/// Loads data stored in independently loadable chunks from an input stream by parsing multiple chunks in parallel.
+	/// \note Chunked data starts with a header composed of Chunked_Data_Marker, the number of entries and the number of chunks.
+	///       Each chunk is prefixed by its number of entries and its size in bytes.
+	template<typename TStorageTraits>
+	class ParallelChunkedDataLoader {
+	private:
+		using StagingType = typename TStorageTraits::StagingType;
+		using DestinationType = typename TStorageTraits::DestinationType;
+
+	public:
+		/// Creates a loader around \a input that parses chunks using \a pool.
+		/// \note The leading Chunked_Data_Marker is expected to have been consumed already.
+		/// \note At most one chunk per worker thread in \a pool is buffered at once.
+		ParallelChunkedDataLoader(io::InputStream& input, thread::IoServiceThreadPool& pool)
+				: m_input(input)
+				, m_pool(pool)
+				, m_maxParallelChunks(std::max<size_t>(1, pool.numWorkerThreads())) {
+			m_numEntries = io::Read64(input);
+			m_numChunks = io::Read64(input);
+		}
+
+	public:
+		/// Returns the number of entries in the input.
+		uint64_t numEntries() const {
+			return m_numEntries;
+		}
+
+		/// Returns the number of chunks in the input.
+		uint64_t numChunks() const {
+			return m_numChunks;
+		}
+
+	public:
+		/// Loads all chunks into \a destination.
+		/// \note Chunks are read sequentially, parsed in parallel and merged into \a destination in input order.
+		void loadAll(DestinationType& destination) {
+			uint64_t numLoadedEntries = 0;
+			std::deque<thread::future<StagingType>> pendingChunks;
+			auto mergeNextChunk = [&pendingChunks, &destination]() {
+				TStorageTraits::MergeStaged(pendingChunks.front().get(), destination);
+				pendingChunks.pop_front();
+			};
+
+			for (auto i = 0u; i < m_numChunks; ++i) {
+				auto numChunkEntries = io::Read64(m_input);
+				auto pBuffer = std::make_shared<std::vector<uint8_t>>(io::Read64(m_input));
+				m_input.read(*pBuffer);
+
+				numLoadedEntries += numChunkEntries;
+				if (numLoadedEntries > m_numEntries)
+					CATAPULT_THROW_RUNTIME_ERROR_1("chunked data contains too many entries", numLoadedEntries);
+
+				// tasks only reference data they share ownership of, so they can safely outlive this function if it throws
+				auto pPromise = std::make_shared<thread::promise<StagingType>>();
+				pendingChunks.push_back(pPromise->get_future());
+				m_pool.service().post([numChunkEntries, pBuffer, pPromise]() {
+					try {
+						pPromise->set_value(LoadChunk(*pBuffer, numChunkEntries));
+					} catch (...) {
+						pPromise->set_exception(std::current_exception());
+					}
+				});
+
+				if (m_maxParallelChunks == pendingChunks.size())
+					mergeNextChunk();
+			}
+
+			while (!pendingChunks.empty())
+				mergeNextChunk();
+
+			if (numLoadedEntries != m_numEntries)
+				CATAPULT_THROW_RUNTIME_ERROR_2("chunked data contains unexpected number of entries", numLoadedEntries, m_numEntries);
+		}
+
+	private:
+		static StagingType LoadChunk(const std::vector<uint8_t>& buffer, uint64_t numEntries) {
+			StagingType staging;
+			io::BufferInputStreamAdapter input(buffer);
+			TStorageTraits::LoadChunk(input, numEntries, staging);
+
+			if (!input.eof())
+				CATAPULT_THROW_RUNTIME_ERROR_1("chunk contains unexpected trailing data", buffer.size() - input.position());
+
+			return staging;
+		}
+
+	private:
+		io::InputStream& m_input;
+		thread::IoServiceThreadPool& m_pool;
+		size_t m_maxParallelChunks;
+		uint64_t m_numEntries;
+		uint64_t m_numChunks;
+	};
+}}
@@ -71,6 +71,21 @@ namespace catapult { namespace cache {
 			void commit(TArgs&&... args) {
 				Primary.commit(std::forward<TArgs>(args)...);
 			}
+
+			/// Enables journaling of all subsequent commits so that they can be undone.
+			void enableUndoJournal() {
+				Primary.enableUndoJournal();
+			}
+
+			/// Discards all but the \a numRetainedCommits most recent journaled commits.
+			void pruneUndoJournal(size_t numRetainedCommits) {
+				Primary.pruneUndoJournal(numRetainedCommits);
+			}
+
+			/// Reverts the changes of the \a numCommits most recent journaled commits in the rebased cache.
+			void undo(size_t numCommits) {
+				Primary.undo(numCommits);
+			}
 		};
 	};
 }}
@@ -82,6 +82,16 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage.
 		virtual void commit() = 0;
 
+	public:
+		/// Enables journaling of all subsequent commits so that they can be undone.
+		virtual void enableUndoJournal() = 0;
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		virtual void pruneUndoJournal(size_t numRetainedCommits) = 0;
+
+		/// Reverts the changes of the \a numCommits most recent journaled commits in the outstanding attached delta.
+		virtual void undo(size_t numCommits) = 0;
+
 	public:
 		/// Returns a const pointer to the underlying cache.
 		virtual const void* get() const = 0;
@@ -60,6 +60,19 @@ namespace catapult { namespace cache {
 			m_pCache->commit();
 		}
 
+	public:
+		void enableUndoJournal() override {
+			m_pCache->enableUndoJournal();
+		}
+
+		void pruneUndoJournal(size_t numRetainedCommits) override {
+			m_pCache->pruneUndoJournal(numRetainedCommits);
+		}
+
+		void undo(size_t numCommits) override {
+			m_pCache->undo(numCommits);
+		}
+
 	public:
 		const void* get() const override {
 			return m_pCache.get();
@@ -254,6 +254,30 @@ namespace catapult { namespace cache {
 			++m_commitCounter;
 		}
 
+	public:
+		/// Enables journaling of all subsequent commits so that they can be undone.
+		void enableUndoJournal() {
+			auto readLock = m_lock.acquireReader();
+			auto writeLock = readLock.promoteToWriter();
+			m_cache.enableUndoJournal();
+		}
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		/// \note The undo journal is only accessed by the committing thread.
+		void pruneUndoJournal(size_t numRetainedCommits) {
+			m_cache.pruneUndoJournal(numRetainedCommits);
+		}
+
+		/// Reverts the changes of the \a numCommits most recent journaled commits in the outstanding attached delta.
+		/// \note The undone commits are replaced by the next commit.
+		void undo(size_t numCommits) {
+			auto pDeltaPair = m_pWeakDeltaPair.lock();
+			if (!pDeltaPair)
+				CATAPULT_THROW_RUNTIME_ERROR("attempting to undo commits of a cache without any outstanding attached deltas");
+
+			m_cache.undo(pDeltaPair->CacheView, numCommits);
+		}
+
 	private:
 		TCache m_cache;
 		size_t m_commitCounter;
@@ -0,0 +1,82 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "catapult/exceptions.h"
+#include <deque>
+
+namespace catapult { namespace cache {
+
+	/// A journal of values captured before each commit that allows the values to be restored when commits are undone.
+	/// \note Like the changes in a base set undo journal, undone commits are replaced by the next commit.
+	template<typename TValue>
+	class ValueUndoJournal {
+	public:
+		/// Creates an empty journal.
+		ValueUndoJournal() : m_numUndoneCommits(0)
+		{}
+
+	public:
+		/// Gets the number of journaled commits that have not been undone.
+		size_t size() const {
+			return m_values.size() - m_numUndoneCommits;
+		}
+
+	public:
+		/// Journals \a value as the value before a commit.
+		void record(const TValue& value) {
+			// the commit replaces all undone commits, so it starts with the value before the oldest undone commit
+			auto previousValue = value;
+			for (auto i = 0u; i < m_numUndoneCommits; ++i) {
+				previousValue = m_values.back();
+				m_values.pop_back();
+			}
+
+			m_numUndoneCommits = 0;
+			m_values.push_back(previousValue);
+		}
+
+		/// Undoes the \a numCommits most recent journaled commits that have not been undone
+		/// and returns the value before the oldest undone commit.
+		const TValue& undo(size_t numCommits) {
+			if (0 == numCommits || numCommits > size())
+				CATAPULT_THROW_INVALID_ARGUMENT_2("cannot undo requested number of commits", numCommits, size());
+
+			m_numUndoneCommits += numCommits;
+			return m_values[m_values.size() - m_numUndoneCommits];
+		}
+
+		/// Discards all undone commits that were not followed by a commit.
+		void reset() {
+			m_numUndoneCommits = 0;
+		}
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		void prune(size_t numRetainedCommits) {
+			while (m_values.size() > numRetainedCommits)
+				m_values.pop_front();
+		}
+
+	private:
+		std::deque<TValue> m_values;
+		size_t m_numUndoneCommits;
+	};
+}}
@@ -104,7 +104,14 @@ namespace catapult { namespace cache {
 		if (pCurrentState)
 			return *pCurrentState;
 
-		auto pAccountState = std::make_shared<state::AccountState>(state::ToAccountState(accountInfo));
+		return addAccount(std::make_shared<state::AccountState>(state::ToAccountState(accountInfo)));
+	}
+
+	state::AccountState& BasicAccountStateCacheDelta::addAccount(const std::shared_ptr<state::AccountState>& pAccountState) {
+		auto* pCurrentState = this->tryGet(pAccountState->Address);
+		if (pCurrentState)
+			return *pCurrentState;
+
 		if (Height(0) != pAccountState->PublicKeyHeight)
 			m_pKeyToAddress->emplace(pAccountState->PublicKey, pAccountState->Address);
 
@@ -116,6 +116,10 @@ namespace catapult { namespace cache {
 		/// Returns an account state.
 		state::AccountState& addAccount(const model::AccountInfo& accountInfo);
 
+		/// If not present, adds \a pAccountState to the cache.
+		/// Returns an account state.
+		state::AccountState& addAccount(const std::shared_ptr<state::AccountState>& pAccountState);
+
 	public:
 		/// If \a height matches the height at which account was added, queues removal of account's \a address
 		/// information from the cache, therefore queuing complete removal of the account from the cache.
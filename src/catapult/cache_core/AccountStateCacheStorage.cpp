@@ -21,13 +21,62 @@
 #include "AccountStateCacheStorage.h"
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
-#include "catapult/state/AccountStateAdapter.h"
+#include "catapult/model/AccountInfo.h"
+#include "catapult/utils/Casting.h"
 #include "catapult/utils/MemoryUtils.h"
 #include <vector>
 
 namespace catapult { namespace cache {
 
 	namespace {
+#pragma pack(push, 1)
+
+		// fixed size account state header stored in a chunk (mosaics are stored separately in columns)
+		struct AccountStateHeader {
+			catapult::Address Address;
+			Height AddressHeight;
+			Key PublicKey;
+			Height PublicKeyHeight;
+			Importance Importances[Importance_History_Size];
+			model::ImportanceHeight ImportanceHeights[Importance_History_Size];
+			uint16_t MosaicsCount;
+		};
+
+#pragma pack(pop)
+
+		template<typename THeader>
+		void CopyToHeader(const state::AccountState& accountState, THeader& header) {
+			header.Address = accountState.Address;
+			header.AddressHeight = accountState.AddressHeight;
+			header.PublicKey = accountState.PublicKey;
+			header.PublicKeyHeight = accountState.PublicKeyHeight;
+
+			auto i = 0u;
+			for (const auto& pair : accountState.ImportanceInfo) {
+				header.Importances[i] = pair.Importance;
+				header.ImportanceHeights[i] = pair.Height;
+				++i;
+			}
+
+			header.MosaicsCount = utils::checked_cast<size_t, uint16_t>(accountState.Balances.size());
+		}
+
+		std::shared_ptr<state::AccountState> CreateFromHeader(const AccountStateHeader& header) {
+			auto pAccountState = std::make_shared<state::AccountState>(header.Address, header.AddressHeight);
+			pAccountState->PublicKey = header.PublicKey;
+			pAccountState->PublicKeyHeight = header.PublicKeyHeight;
+
+			for (auto i = Importance_History_Size; i > 0; --i) {
+				auto importanceHeight = header.ImportanceHeights[i - 1];
+				if (model::ImportanceHeight() == importanceHeight)
+					continue;
+
+				pAccountState->ImportanceInfo.set(header.Importances[i - 1], importanceHeight);
+			}
+
+			return pAccountState;
+		}
+
 		uint32_t ReadAccountInfoSize(io::InputStream& input) {
 			auto accountInfoSize = io::Read32(input);
 			if (accountInfoSize > model::AccountInfo_Max_Size)
@@ -44,12 +93,29 @@ namespace catapult { namespace cache {
 			auto* pAccountInfoBytes = reinterpret_cast<uint8_t*>(&accountInfo);
 			input.read({ pAccountInfoBytes + Header_Size, accountInfoSize - Header_Size });
 		}
+
+		const model::AccountInfo& ReadAccountInfo(io::InputStream& input, std::vector<uint8_t>& state) {
+			auto accountInfoSize = ReadAccountInfoSize(input);
+			state.resize(accountInfoSize);
+
+			auto& accountInfo = reinterpret_cast<model::AccountInfo&>(*state.data());
+			ReadAccountInfo(input, accountInfoSize, accountInfo);
+			return accountInfo;
+		}
 	}
 
 	void AccountStateCacheStorage::Save(const StorageType& element, io::OutputStream& output) {
-		const auto& pAccountState = element.second;
-		auto pAccountInfo = state::ToAccountInfo(*pAccountState);
-		output.write({ reinterpret_cast<const uint8_t*>(pAccountInfo.get()), pAccountInfo->Size });
+		// write the account info layout directly to avoid allocating an intermediate account info
+		const auto& accountState = *element.second;
+		model::AccountInfo accountInfo;
+		CopyToHeader(accountState, accountInfo);
+		accountInfo.Size = static_cast<uint32_t>(model::AccountInfo::CalculateRealSize(accountInfo));
+		output.write({ reinterpret_cast<const uint8_t*>(&accountInfo), sizeof(model::AccountInfo) });
+
+		for (const auto& pair : accountState.Balances) {
+			io::Write(output, pair.first);
+			io::Write(output, pair.second);
+		}
 	}
 
 	std::unique_ptr<model::AccountInfo> AccountStateCacheStorage::Load(io::InputStream& input) {
@@ -60,11 +126,70 @@ namespace catapult { namespace cache {
 	}
 
 	void AccountStateCacheStorage::LoadInto(io::InputStream& input, DestinationType& cacheDelta, LoadStateType& state) {
-		auto accountInfoSize = ReadAccountInfoSize(input);
-		state.resize(accountInfoSize);
+		cacheDelta.addAccount(ReadAccountInfo(input, state));
+	}
+
+	AccountStateCacheStorage::SnapshotType AccountStateCacheStorage::CreateSnapshot(const SourceType& view) {
+		// committed account states are replaced instead of modified, so sharing them detaches the snapshot from the cache
+		SnapshotType snapshot;
+		snapshot.reserve(view.size());
+
+		auto pIterableView = view.tryMakeIterableView();
+		for (const auto& pair : *pIterableView)
+			snapshot.push_back(pair.second);
+
+		return snapshot;
+	}
+
+	void AccountStateCacheStorage::SaveChunk(const SnapshotType& snapshot, size_t startIndex, size_t count, io::OutputStream& output) {
+		auto beginIter = snapshot.cbegin() + static_cast<std::ptrdiff_t>(startIndex);
+		auto endIter = beginIter + static_cast<std::ptrdiff_t>(count);
+
+		for (auto iter = beginIter; endIter != iter; ++iter) {
+			AccountStateHeader header;
+			CopyToHeader(**iter, header);
+			output.write({ reinterpret_cast<const uint8_t*>(&header), sizeof(AccountStateHeader) });
+		}
+
+		for (auto iter = beginIter; endIter != iter; ++iter) {
+			for (const auto& pair : (*iter)->Balances)
+				io::Write(output, pair.first);
+		}
+
+		for (auto iter = beginIter; endIter != iter; ++iter) {
+			for (const auto& pair : (*iter)->Balances)
+				io::Write(output, pair.second);
+		}
+	}
+
+	void AccountStateCacheStorage::LoadChunk(io::InputStream& input, uint64_t numEntries, StagingType& staging) {
+		// note that staging grows while headers are read, so a corrupt entry count cannot trigger a huge allocation
+		auto firstIndex = staging.size();
+		size_t numMosaics = 0;
+		std::vector<uint16_t> mosaicsCounts;
+		for (auto i = 0u; i < numEntries; ++i) {
+			AccountStateHeader header;
+			input.read({ reinterpret_cast<uint8_t*>(&header), sizeof(AccountStateHeader) });
+			staging.push_back(CreateFromHeader(header));
+			mosaicsCounts.push_back(header.MosaicsCount);
+			numMosaics += header.MosaicsCount;
+		}
+
+		std::vector<MosaicId> mosaicIds(numMosaics);
+		std::vector<Amount> amounts(numMosaics);
+		input.read({ reinterpret_cast<uint8_t*>(mosaicIds.data()), numMosaics * sizeof(MosaicId) });
+		input.read({ reinterpret_cast<uint8_t*>(amounts.data()), numMosaics * sizeof(Amount) });
+
+		auto mosaicIndex = 0u;
+		for (auto i = 0u; i < mosaicsCounts.size(); ++i) {
+			auto& balances = staging[firstIndex + i]->Balances;
+			for (auto j = 0u; j < mosaicsCounts[i]; ++j, ++mosaicIndex)
+				balances.credit(mosaicIds[mosaicIndex], amounts[mosaicIndex]);
+		}
+	}
 
-		auto& accountInfo = reinterpret_cast<model::AccountInfo&>(*state.data());
-		ReadAccountInfo(input, accountInfoSize, accountInfo);
-		cacheDelta.addAccount(accountInfo);
+	void AccountStateCacheStorage::MergeStaged(StagingType&& staging, DestinationType& cacheDelta) {
+		for (const auto& pAccountState : staging)
+			cacheDelta.addAccount(pAccountState);
 	}
 }}
@@ -26,8 +26,12 @@
 namespace catapult { namespace cache {
 
 	/// Policy for saving and loading account state cache data.
+	/// \note Each chunk is composed of fixed size account state headers followed by a columnar balances section
+	///       (all mosaic ids followed by all amounts).
 	struct AccountStateCacheStorage : public MapCacheStorageFromDescriptor<AccountStateCacheDescriptor> {
 		using LoadStateType = std::vector<uint8_t>;
+		using SnapshotType = std::vector<std::shared_ptr<const state::AccountState>>;
+		using StagingType = std::vector<std::shared_ptr<state::AccountState>>;
 
 		/// Saves \a element to \a output.
 		static void Save(const StorageType& element, io::OutputStream& output);
@@ -37,5 +41,17 @@ namespace catapult { namespace cache {
 
 		/// Loads a single value from \a input into \a cacheDelta using \a state.
 		static void LoadInto(io::InputStream& input, DestinationType& cacheDelta, LoadStateType& state);
+
+		/// Creates a snapshot of all values in \a view that is not affected by subsequent commits.
+		static SnapshotType CreateSnapshot(const SourceType& view);
+
+		/// Saves \a count values in \a snapshot starting at \a startIndex to \a output as a single chunk.
+		static void SaveChunk(const SnapshotType& snapshot, size_t startIndex, size_t count, io::OutputStream& output);
+
+		/// Loads a single chunk of \a numEntries values from \a input into \a staging.
+		static void LoadChunk(io::InputStream& input, uint64_t numEntries, StagingType& staging);
+
+		/// Adds all values in \a staging to \a cacheDelta.
+		static void MergeStaged(StagingType&& staging, DestinationType& cacheDelta);
 	};
 }}
@@ -210,6 +210,21 @@ namespace catapult { namespace cache {
 				Primary.commit();
 				KeyLookupMap.commit();
 			}
+
+			void enableUndoJournal() {
+				Primary.enableUndoJournal();
+				KeyLookupMap.enableUndoJournal();
+			}
+
+			void pruneUndoJournal(size_t numRetainedCommits) {
+				Primary.pruneUndoJournal(numRetainedCommits);
+				KeyLookupMap.pruneUndoJournal(numRetainedCommits);
+			}
+
+			void undo(size_t numCommits) {
+				Primary.undo(numCommits);
+				KeyLookupMap.undo(numCommits);
+			}
 		};
 	};
 }}
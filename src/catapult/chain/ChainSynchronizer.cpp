@@ -24,6 +24,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/SpinLock.h"
+#include <map>
 #include <queue>
 
 namespace catapult { namespace chain {
@@ -37,38 +38,59 @@ namespace catapult { namespace chain {
 			size_t NumBytes;
 		};
 
+		// inclusive range of heights requested by a single blocks-from request
+		struct PullWindow {
+			Height StartHeight;
+			Height EndHeight;
+		};
+
+		enum class SyncMode { None, Compare_Chains, Extend_Chain };
+
 		class UnprocessedElements : public std::enable_shared_from_this<UnprocessedElements> {
 		public:
-			explicit UnprocessedElements(const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer, size_t maxSize)
+			UnprocessedElements(
+					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer,
+					size_t maxSize,
+					uint32_t numBlocksPerPull,
+					uint32_t maxPendingPulls)
 					: m_blockRangeConsumer(blockRangeConsumer)
 					, m_maxSize(maxSize)
+					, m_numBlocksPerPull(std::max<uint32_t>(1, numBlocksPerPull))
+					, m_maxPendingPulls(std::max<uint32_t>(1, maxPendingPulls))
 					, m_numBytes(0)
-					, m_hasPendingSync(false)
+					, m_numBufferedBytes(0)
+					, m_numPendingSyncs(0)
 					, m_dirty(false)
 			{}
 
 		public:
-			bool empty() {
-				return 0 == numBytes();
-			}
-
-			size_t numBytes() {
+			SyncMode startSync(std::vector<PullWindow>& windows) {
 				utils::SpinLockGuard guard(m_spinLock);
-				return m_numBytes;
-			}
+				if (m_numBytes + m_numBufferedBytes >= m_maxSize || m_dirty)
+					return SyncMode::None;
 
-			bool shouldStartSync() {
-				utils::SpinLockGuard guard(m_spinLock);
-				if (m_numBytes >= m_maxSize || m_hasPendingSync || m_dirty)
-					return false;
+				if (!isExtendingChain()) {
+					// a chain comparison cannot run concurrently with any other sync
+					if (0 != m_numPendingSyncs)
+						return SyncMode::None;
 
-				m_hasPendingSync = true;
-				return true;
-			}
+					resetPipeline();
+					++m_numPendingSyncs;
+					return SyncMode::Compare_Chains;
+				}
 
-			Height maxHeight() {
-				utils::SpinLockGuard guard(m_spinLock);
-				return m_elements.empty() ? Height(0) : m_elements.back().EndHeight;
+				if (m_pendingWindows.size() >= m_maxPendingPulls)
+					return SyncMode::None;
+
+				// fill all free pull slots so that multiple requests are on the wire at once
+				while (m_pendingWindows.size() < m_maxPendingPulls) {
+					auto window = reserveNextWindow();
+					m_pendingWindows.emplace(window.StartHeight, window.EndHeight);
+					windows.push_back(window);
+				}
+
+				++m_numPendingSyncs;
+				return SyncMode::Extend_Chain;
 			}
 
 			bool add(model::BlockRange&& range) {
@@ -76,23 +98,53 @@ namespace catapult { namespace chain {
 				if (m_dirty)
 					return false;
 
+				auto nextHeight = (--range.cend())->Height + Height(1);
+				if (!dispatch(std::move(range)))
+					return false;
+
+				m_nextPullHeight = nextHeight;
+				return true;
+			}
+
+			NodeInteractionResult completePull(const PullWindow& window, model::BlockRange&& range) {
+				utils::SpinLockGuard guard(m_spinLock);
+				if (!tryRemovePendingWindow(window) || m_dirty)
+					return NodeInteractionResult::Neutral;
+
+				// if the range is empty, all speculative pulls above the window are useless
+				if (range.empty()) {
+					CATAPULT_LOG(info) << "peer returned 0 blocks";
+					discardFrom(window.StartHeight);
+					return NodeInteractionResult::Neutral;
+				}
+
 				auto endHeight = (--range.cend())->Height;
-				auto bufferSize = range.totalSize();
+				CATAPULT_LOG(info)
+						<< "peer returned " << range.size()
+						<< " blocks (heights " << range.cbegin()->Height << " - " << endHeight << ")";
+
+				// only the last window can be extended beyond its requested end height
+				auto isLastWindow = window.EndHeight + Height(1) == m_nextPullHeight;
+				if (window.StartHeight != range.cbegin()->Height || (endHeight > window.EndHeight && !isLastWindow)) {
+					CATAPULT_LOG(warning) << "peer returned unexpected blocks for window starting at " << window.StartHeight;
+					discardFrom(window.StartHeight);
+					return NodeInteractionResult::Failure;
+				}
 
-				// need to use shared_from_this because dispatcher can finish processing a block after
-				// scheduler is stopped (and owning DefaultChainSynchronizer is destroyed)
-				auto newId = m_blockRangeConsumer(std::move(range), [pThis = shared_from_this()](auto id, auto result) {
-					pThis->remove(id, result.CompletionStatus);
-				});
+				if (isLastWindow)
+					m_nextPullHeight = endHeight + Height(1);
+				else if (endHeight < window.EndHeight)
+					m_missingWindows.emplace(endHeight + Height(1), window.EndHeight);
 
-				// if the disruptor is full, abort processing
-				if (0 == newId)
-					return false;
+				m_numBufferedBytes += range.totalSize();
+				m_completedRanges.emplace(window.StartHeight, std::move(range));
+				return dispatchCompletedRanges() ? NodeInteractionResult::Success : NodeInteractionResult::Neutral;
+			}
 
-				auto info = ElementInfo{ newId, endHeight, bufferSize };
-				m_numBytes += info.NumBytes;
-				m_elements.emplace(info);
-				return true;
+			void failPull(const PullWindow& window) {
+				utils::SpinLockGuard guard(m_spinLock);
+				if (tryRemovePendingWindow(window))
+					discardFrom(window.StartHeight);
 			}
 
 			void remove(disruptor::DisruptorElementId id, disruptor::CompletionStatus status) {
@@ -104,11 +156,15 @@ namespace catapult { namespace chain {
 				m_numBytes -= info.NumBytes;
 				m_elements.pop();
 				m_dirty = hasPendingOperation() && disruptor::CompletionStatus::Normal != status;
+
+				// all blocks above an unsuccessfully processed range are useless
+				if (disruptor::CompletionStatus::Normal != status)
+					resetPipeline();
 			}
 
 			void clearPendingSync() {
 				utils::SpinLockGuard guard(m_spinLock);
-				m_hasPendingSync = false;
+				--m_numPendingSyncs;
 
 				if (m_dirty)
 					m_dirty = hasPendingOperation();
@@ -116,7 +172,95 @@ namespace catapult { namespace chain {
 
 		private:
 			bool hasPendingOperation() const {
-				return 0 != m_numBytes || m_hasPendingSync;
+				return 0 != m_numBytes || 0 != m_numPendingSyncs;
+			}
+
+			bool isExtendingChain() const {
+				return Height(0) != m_nextPullHeight
+						&& (0 != m_numBytes || !m_pendingWindows.empty() || !m_completedRanges.empty());
+			}
+
+			PullWindow reserveNextWindow() {
+				// fill holes left by short responses before pulling further ahead
+				if (!m_missingWindows.empty()) {
+					auto iter = m_missingWindows.cbegin();
+					auto window = PullWindow{ iter->first, iter->second };
+					m_missingWindows.erase(iter);
+					return window;
+				}
+
+				auto window = PullWindow{ m_nextPullHeight, m_nextPullHeight + Height(m_numBlocksPerPull - 1) };
+				m_nextPullHeight = window.EndHeight + Height(1);
+				return window;
+			}
+
+			bool tryRemovePendingWindow(const PullWindow& window) {
+				auto iter = m_pendingWindows.find(window.StartHeight);
+				if (m_pendingWindows.cend() == iter || window.EndHeight != iter->second)
+					return false;
+
+				m_pendingWindows.erase(iter);
+				return true;
+			}
+
+			void discardFrom(Height height) {
+				m_nextPullHeight = std::min(m_nextPullHeight, height);
+				m_pendingWindows.erase(m_pendingWindows.lower_bound(height), m_pendingWindows.end());
+				m_missingWindows.erase(m_missingWindows.lower_bound(height), m_missingWindows.end());
+
+				auto iter = m_completedRanges.lower_bound(height);
+				for (auto discardIter = iter; m_completedRanges.cend() != discardIter; ++discardIter)
+					m_numBufferedBytes -= discardIter->second.totalSize();
+
+				m_completedRanges.erase(iter, m_completedRanges.end());
+			}
+
+			void resetPipeline() {
+				m_nextPullHeight = Height(0);
+				m_nextDispatchHeight = Height(0);
+				m_pendingWindows.clear();
+				m_missingWindows.clear();
+				m_completedRanges.clear();
+				m_numBufferedBytes = 0;
+			}
+
+			bool dispatchCompletedRanges() {
+				// ranges are forwarded to the consumer in order while the following ones might still be on the wire
+				while (!m_completedRanges.empty() && m_nextDispatchHeight == m_completedRanges.cbegin()->first) {
+					auto iter = m_completedRanges.begin();
+					auto startHeight = iter->first;
+					auto range = std::move(iter->second);
+					m_numBufferedBytes -= range.totalSize();
+					m_completedRanges.erase(iter);
+
+					if (!dispatch(std::move(range))) {
+						discardFrom(startHeight);
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			bool dispatch(model::BlockRange&& range) {
+				auto endHeight = (--range.cend())->Height;
+				auto bufferSize = range.totalSize();
+
+				// need to use shared_from_this because dispatcher can finish processing a block after
+				// scheduler is stopped (and owning DefaultChainSynchronizer is destroyed)
+				auto newId = m_blockRangeConsumer(std::move(range), [pThis = shared_from_this()](auto id, auto result) {
+					pThis->remove(id, result.CompletionStatus);
+				});
+
+				// if the disruptor is full, abort processing
+				if (0 == newId)
+					return false;
+
+				auto info = ElementInfo{ newId, endHeight, bufferSize };
+				m_numBytes += info.NumBytes;
+				m_elements.emplace(info);
+				m_nextDispatchHeight = endHeight + Height(1);
+				return true;
 			}
 
 		private:
@@ -124,11 +268,34 @@ namespace catapult { namespace chain {
 			CompletionAwareBlockRangeConsumerFunc m_blockRangeConsumer;
 			std::queue<ElementInfo> m_elements;
 			size_t m_maxSize;
+			uint32_t m_numBlocksPerPull;
+			uint32_t m_maxPendingPulls;
 			size_t m_numBytes;
-			bool m_hasPendingSync;
+			size_t m_numBufferedBytes;
+			size_t m_numPendingSyncs;
 			bool m_dirty;
+
+			Height m_nextPullHeight;
+			Height m_nextDispatchHeight;
+			std::map<Height, Height> m_pendingWindows; // start height to end height
+			std::map<Height, Height> m_missingWindows; // start height to end height
+			std::map<Height, model::BlockRange> m_completedRanges; // start height to range
 		};
 
+		NodeInteractionResult AggregateResults(std::vector<NodeInteractionFuture>&& resultFutures) {
+			auto aggregateResult = NodeInteractionResult::Neutral;
+			for (auto& resultFuture : resultFutures) {
+				auto result = resultFuture.get();
+				if (NodeInteractionResult::Failure == result)
+					return NodeInteractionResult::Failure;
+
+				if (NodeInteractionResult::Success == result)
+					aggregateResult = NodeInteractionResult::Success;
+			}
+
+			return aggregateResult;
+		}
+
 		NodeInteractionResult ToNodeInteractionResult(ChainComparisonCode code) {
 			switch (code) {
 			case ChainComparisonCode::Remote_Reported_Equal_Chain_Score:
@@ -233,24 +400,28 @@ namespace catapult { namespace chain {
 					, m_blocksFromOptions(config.MaxRollbackBlocks, config.MaxChainBytesPerSyncAttempt)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
-							3 * config.MaxChainBytesPerSyncAttempt))
+							3 * config.MaxChainBytesPerSyncAttempt,
+							config.MaxRollbackBlocks,
+							config.MaxPendingBlockRequests))
 			{}
 
 		public:
 			NodeInteractionFuture operator()(const RemoteApiType& remoteChainApi) {
-				if (!m_pUnprocessedElements->shouldStartSync())
+				std::vector<PullWindow> windows;
+				NodeInteractionFuture syncFuture;
+				switch (m_pUnprocessedElements->startSync(windows)) {
+				case SyncMode::Compare_Chains:
+					syncFuture = compareChainsAndSync(remoteChainApi);
+					break;
+
+				case SyncMode::Extend_Chain:
+					syncFuture = extendChain(remoteChainApi, windows);
+					break;
+
+				default:
 					return thread::make_ready_future(NodeInteractionResult::Neutral);
+				}
 
-				auto syncFuture = thread::compose(
-						compareChains(remoteChainApi),
-						[this, &remoteChainApi](auto&& compareChainsFuture) {
-							try {
-								return this->syncWithPeer(remoteChainApi, compareChainsFuture.get());
-							} catch (const catapult_runtime_error& e) {
-								CATAPULT_LOG(warning) << "exception thrown while comparing chains: " << e.what();
-								return thread::make_ready_future(NodeInteractionResult::Failure);
-							}
-						});
 				return thread::compose(
 						std::move(syncFuture),
 						[&unprocessedElements = *m_pUnprocessedElements](auto&& nodeInteractionFuture) {
@@ -262,16 +433,44 @@ namespace catapult { namespace chain {
 
 		private:
 			// in case that there are no unprocessed elements in the disruptor, we do a normal synchronization round
-			// else we bypass chain comparison and expand the existing chain part by pulling more blocks
-			thread::future<CompareChainsResult> compareChains(const RemoteApiType& remoteChainApi) {
-				if (m_pUnprocessedElements->empty())
-					return CompareChains(*m_pLocalChainApi, remoteChainApi, m_compareChainOptions);
-
-				CompareChainsResult result;
-				result.Code = ChainComparisonCode::Remote_Is_Not_Synced;
-				result.CommonBlockHeight = m_pUnprocessedElements->maxHeight();
-				result.ForkDepth = 0;
-				return thread::make_ready_future(std::move(result));
+			NodeInteractionFuture compareChainsAndSync(const RemoteApiType& remoteChainApi) {
+				return thread::compose(
+						CompareChains(*m_pLocalChainApi, remoteChainApi, m_compareChainOptions),
+						[this, &remoteChainApi](auto&& compareChainsFuture) {
+							try {
+								return this->syncWithPeer(remoteChainApi, compareChainsFuture.get());
+							} catch (const catapult_runtime_error& e) {
+								CATAPULT_LOG(warning) << "exception thrown while comparing chains: " << e.what();
+								return thread::make_ready_future(NodeInteractionResult::Failure);
+							}
+						});
+			}
+
+			// else we bypass chain comparison and expand the existing chain part by pulling (possibly multiple) block ranges
+			NodeInteractionFuture extendChain(const RemoteApiType& remoteChainApi, const std::vector<PullWindow>& windows) {
+				CATAPULT_LOG(debug)
+						<< "pulling " << windows.size() << " block range(s) from remote starting at height "
+						<< windows.front().StartHeight;
+
+				std::vector<NodeInteractionFuture> futures;
+				for (const auto& window : windows) {
+					auto numBlocks = static_cast<uint32_t>((window.EndHeight - window.StartHeight).unwrap() + 1);
+					auto options = api::BlocksFromOptions(numBlocks, m_blocksFromOptions.NumBytes);
+					auto blocksFuture = remoteChainApi.blocksFrom(window.StartHeight, options);
+					futures.push_back(blocksFuture.then([&unprocessedElements = *m_pUnprocessedElements, window](auto&& rangeFuture) {
+						try {
+							return unprocessedElements.completePull(window, rangeFuture.get());
+						} catch (const catapult_runtime_error& e) {
+							CATAPULT_LOG(warning) << "exception thrown while requesting blocks: " << e.what();
+							unprocessedElements.failPull(window);
+							return NodeInteractionResult::Failure;
+						}
+					}));
+				}
+
+				return thread::when_all(std::move(futures)).then([](auto&& resultsFuture) {
+					return AggregateResults(resultsFuture.get());
+				});
 			}
 
 			NodeInteractionFuture syncWithPeer(const RemoteApiType& remoteChainApi, const CompareChainsResult& compareResult) const {
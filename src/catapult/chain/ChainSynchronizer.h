@@ -51,6 +51,9 @@ namespace catapult { namespace chain {
 
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
+
+		/// Maximum number of pending (pipelined) block requests when extending a chain part that is already being processed.
+		uint32_t MaxPendingBlockRequests;
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config and
@@ -0,0 +1,76 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "NotificationUndoLog.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/exceptions.h"
+#include <cstddef>
+#include <cstring>
+
+namespace catapult { namespace chain {
+
+	namespace {
+		constexpr size_t Entry_Alignment = alignof(std::max_align_t);
+
+		constexpr size_t AlignEntrySize(size_t size) {
+			return (size + Entry_Alignment - 1) / Entry_Alignment * Entry_Alignment;
+		}
+	}
+
+	size_t NotificationUndoLog::size() const {
+		return m_offsets.size();
+	}
+
+	NotificationUndoLog::Savepoint NotificationUndoLog::savepoint() const {
+		return m_offsets.size();
+	}
+
+	void NotificationUndoLog::record(const model::Notification& notification) {
+		// pad each entry so that all copied notifications are suitably aligned
+		auto offset = m_buffer.size();
+		m_buffer.resize(offset + AlignEntrySize(notification.Size));
+		std::memcpy(&m_buffer[offset], &notification, notification.Size);
+		m_offsets.push_back(offset);
+	}
+
+	void NotificationUndoLog::rollback(
+			Savepoint savepoint,
+			const observers::NotificationObserver& observer,
+			const observers::ObserverContext& context) {
+		if (savepoint > m_offsets.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot rollback to savepoint beyond end of log", savepoint);
+
+		for (auto i = m_offsets.size(); i > savepoint; --i) {
+			const auto* pNotification = reinterpret_cast<const model::Notification*>(&m_buffer[m_offsets[i - 1]]);
+			observer.notify(*pNotification, context);
+		}
+
+		if (savepoint < m_offsets.size())
+			m_buffer.resize(m_offsets[savepoint]);
+
+		m_offsets.resize(savepoint);
+	}
+
+	void NotificationUndoLog::clear() {
+		m_buffer.clear();
+		m_offsets.clear();
+	}
+}}
@@ -0,0 +1,59 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "catapult/observers/ObserverTypes.h"
+#include <vector>
+
+namespace catapult { namespace model { struct Notification; } }
+
+namespace catapult { namespace chain {
+
+	/// Log of observed notifications that can be undone.
+	/// \note Notifications are copied into a single buffer that is reused after the log is rolled back or cleared.
+	class NotificationUndoLog {
+	public:
+		/// Position in the log that can be rolled back to.
+		using Savepoint = size_t;
+
+	public:
+		/// Gets the number of recorded notifications.
+		size_t size() const;
+
+		/// Gets a savepoint corresponding to the current end of the log.
+		Savepoint savepoint() const;
+
+	public:
+		/// Appends a copy of \a notification to the log.
+		void record(const model::Notification& notification);
+
+		/// Undoes all notifications recorded after \a savepoint by passing them in reverse order to \a observer
+		/// with \a context and removes them from the log.
+		void rollback(Savepoint savepoint, const observers::NotificationObserver& observer, const observers::ObserverContext& context);
+
+		/// Removes all notifications from the log without undoing them.
+		void clear();
+
+	private:
+		std::vector<uint8_t> m_buffer;
+		std::vector<size_t> m_offsets;
+	};
+}}
@@ -33,7 +33,8 @@ namespace catapult { namespace chain {
 			, m_observer(observer)
 			, m_observerContext(observerContext)
 			, m_aggregateResult(validators::ValidationResult::Success)
-			, m_isUndoEnabled(false)
+			, m_pUndoLog(nullptr)
+			, m_undoSavepoint(0)
 	{}
 
 	validators::ValidationResult ProcessingNotificationSubscriber::result() const {
@@ -41,11 +42,19 @@ namespace catapult { namespace chain {
 	}
 
 	void ProcessingNotificationSubscriber::enableUndo() {
-		m_isUndoEnabled = true;
+		enableUndo(m_undoLog);
+	}
+
+	void ProcessingNotificationSubscriber::enableUndo(NotificationUndoLog& undoLog) {
+		if (m_pUndoLog)
+			return;
+
+		m_pUndoLog = &undoLog;
+		m_undoSavepoint = undoLog.savepoint();
 	}
 
 	void ProcessingNotificationSubscriber::undo() {
-		if (!m_isUndoEnabled)
+		if (!m_pUndoLog)
 			CATAPULT_THROW_RUNTIME_ERROR("cannot undo because undo is not enabled");
 
 		auto undoMode = observers::NotifyMode::Commit == m_observerContext.Mode
@@ -56,12 +65,7 @@ namespace catapult { namespace chain {
 				m_observerContext.State,
 				m_observerContext.Height,
 				undoMode);
-		for (auto iter = m_notificationBuffers.crbegin(); m_notificationBuffers.crend() != iter; ++iter) {
-			const auto* pNotification = reinterpret_cast<const model::Notification*>(iter->data());
-			m_observer.notify(*pNotification, undoObserverContext);
-		}
-
-		m_notificationBuffers.clear();
+		m_pUndoLog->rollback(m_undoSavepoint, m_observer, undoObserverContext);
 	}
 
 	void ProcessingNotificationSubscriber::notify(const model::Notification& notification) {
@@ -92,11 +96,9 @@ namespace catapult { namespace chain {
 
 		m_observer.notify(notification, m_observerContext);
 
-		if (!m_isUndoEnabled)
+		if (!m_pUndoLog)
 			return;
 
-		// store a copy of the notification buffer
-		const auto* pData = reinterpret_cast<const uint8_t*>(&notification);
-		m_notificationBuffers.emplace_back(pData, pData + notification.Size);
+		m_pUndoLog->record(notification);
 	}
 }}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "NotificationUndoLog.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/validators/ValidatorContext.h"
@@ -44,6 +45,10 @@ namespace catapult { namespace chain {
 		/// Enables subsequent notifications to be undone.
 		void enableUndo();
 
+		/// Enables subsequent notifications to be undone by recording them in (external) \a undoLog.
+		/// \note \a undoLog must outlive this subscriber and allows its storage to be reused across subscribers.
+		void enableUndo(NotificationUndoLog& undoLog);
+
 		/// Undoes all executions since enableUndo was first called.
 		void undo();
 
@@ -61,7 +66,8 @@ namespace catapult { namespace chain {
 		const observers::ObserverContext& m_observerContext;
 
 		validators::ValidationResult m_aggregateResult;
-		bool m_isUndoEnabled;
-		std::vector<std::vector<uint8_t>> m_notificationBuffers;
+		NotificationUndoLog m_undoLog;
+		NotificationUndoLog* m_pUndoLog;
+		NotificationUndoLog::Savepoint m_undoSavepoint;
 	};
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "NodeInteractionResult.h"
+#include "catapult/ionet/MeteredPacketIo.h"
 #include "catapult/model/TransactionPlugin.h"
 #include "catapult/net/PacketIoPicker.h"
 #include "catapult/thread/Future.h"
@@ -31,18 +32,25 @@ namespace catapult { namespace chain {
 
 	/// Simplifies interacting with remote nodes via apis.
 	class RemoteApiForwarder {
+	public:
+		/// Consumer of the measurements of an interaction with a remote node.
+		using InteractionMetricsConsumer = consumer<const ionet::Node&, const ionet::PacketIoMetrics&>;
+
 	public:
 		/// Creates a forwarder around a peer selector (\a packetIoPicker) with a connection \a timeout
 		/// given a transaction registry (\a transactionRegistry) and a friendly name (\a operationName).
+		/// When \a metricsConsumer is set, all interactions are measured and the measurements are forwarded to it.
 		RemoteApiForwarder(
 				net::PacketIoPicker& packetIoPicker,
 				const model::TransactionRegistry& transactionRegistry,
 				const utils::TimeSpan& timeout,
-				const std::string& operationName)
+				const std::string& operationName,
+				const InteractionMetricsConsumer& metricsConsumer = InteractionMetricsConsumer())
 				: m_packetIoPicker(packetIoPicker)
 				, m_transactionRegistry(transactionRegistry)
 				, m_timeout(timeout)
 				, m_operationName(operationName)
+				, m_metricsConsumer(metricsConsumer)
 		{}
 
 	public:
@@ -55,15 +63,35 @@ namespace catapult { namespace chain {
 				return thread::make_ready_future(NodeInteractionResult::None);
 			}
 
+			// measure the interaction when requested
+			auto pIo = packetIoPair.io();
+			std::shared_ptr<ionet::MeteredPacketIo> pMeteredIo;
+			if (m_metricsConsumer) {
+				pMeteredIo = std::make_shared<ionet::MeteredPacketIo>(pIo);
+				pIo = pMeteredIo;
+			}
+
 			// pass in a non-owning pointer to the registry
-			auto pRemoteApi = utils::UniqueToShared(apiFactory(*packetIoPair.io(), m_transactionRegistry));
+			auto pRemoteApi = utils::UniqueToShared(apiFactory(*pIo, m_transactionRegistry));
 
-			// extend the lifetimes of pRemoteApi and packetIoPair until the completion of the action
+			// extend the lifetimes of pRemoteApi, pMeteredIo and packetIoPair until the completion of the action
 			// (pRemoteApi is a pointer so that the reference taken by action is valid throughout the entire asynchronous action)
-			return action(*pRemoteApi).then([pRemoteApi, packetIoPair, operationName = m_operationName](auto&& resultFuture) {
+			return action(*pRemoteApi).then([
+					pRemoteApi,
+					pMeteredIo,
+					packetIoPair,
+					operationName = m_operationName,
+					metricsConsumer = m_metricsConsumer](auto&& resultFuture) {
 				auto result = resultFuture.get();
 				CATAPULT_LOG_LEVEL(NodeInteractionResult::Neutral == result ? utils::LogLevel::Trace : utils::LogLevel::Info)
 						<< "completed '" << operationName << "' (" << packetIoPair.node() << ") with result " << result;
+
+				if (pMeteredIo) {
+					auto metrics = pMeteredIo->metrics();
+					if (0 != metrics.NumRoundTrips)
+						metricsConsumer(packetIoPair.node(), metrics);
+				}
+
 				return result;
 			});
 		}
@@ -73,5 +101,6 @@ namespace catapult { namespace chain {
 		const model::TransactionRegistry& m_transactionRegistry;
 		utils::TimeSpan m_timeout;
 		std::string m_operationName;
+		InteractionMetricsConsumer m_metricsConsumer;
 	};
 }}
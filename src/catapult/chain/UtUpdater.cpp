@@ -25,7 +25,12 @@
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/cache/RelockableDetachedCatapultCache.h"
 #include "catapult/cache/UtCache.h"
+#include "catapult/model/TransactionUtils.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/HexFormatter.h"
+#include "catapult/validators/AggregateValidationResult.h"
+#include <algorithm>
 
 namespace catapult { namespace chain {
 
@@ -39,6 +44,70 @@ namespace catapult { namespace chain {
 			cache::UtCacheModifierProxy& Modifier;
 			cache::CatapultCacheDelta& UnconfirmedCatapultCache;
 		};
+
+		// region PrevalidatingNotificationSubscriber
+
+		/// Validates the notifications raised by a transaction that precede its first state changing notification.
+		/// Results of these validations do not depend on any observations made while processing the transaction itself.
+		class PrevalidatingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			PrevalidatingNotificationSubscriber(
+					const validators::stateful::NotificationValidator& validator,
+					const validators::ValidatorContext& validatorContext)
+					: m_validator(validator)
+					, m_validatorContext(validatorContext)
+					, m_aggregateResult(validators::ValidationResult::Success)
+					, m_isComplete(false)
+			{}
+
+		public:
+			validators::ValidationResult result() const {
+				return m_aggregateResult;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (m_isComplete || !IsValidationResultSuccess(m_aggregateResult))
+					return;
+
+				if (IsSet(notification.Type, model::NotificationChannel::Validator)) {
+					auto result = m_validator.validate(notification, m_validatorContext);
+					AggregateValidationResult(m_aggregateResult, result);
+				}
+
+				// account registrations only add empty accounts, so validations can continue past them
+				if (IsSet(notification.Type, model::NotificationChannel::Observer) && !IsAccountRegistration(notification.Type))
+					m_isComplete = true;
+			}
+
+		private:
+			static bool IsAccountRegistration(model::NotificationType type) {
+				return model::Core_Register_Account_Address_Notification == type
+						|| model::Core_Register_Account_Public_Key_Notification == type;
+			}
+
+		private:
+			const validators::stateful::NotificationValidator& m_validator;
+			const validators::ValidatorContext& m_validatorContext;
+			validators::ValidationResult m_aggregateResult;
+			bool m_isComplete;
+		};
+
+		// endregion
+
+		struct PrevalidationResult {
+			/// Result of validating the transaction against the unconfirmed state at the start of the batch.
+			validators::ValidationResult Result = validators::ValidationResult::Success;
+
+			/// Addresses involved in the transaction.
+			std::shared_ptr<const model::AddressSet> pAddresses;
+		};
+
+		bool HasAnyAddress(const model::AddressSet& addresses, const model::AddressSet& candidateAddresses) {
+			return std::any_of(candidateAddresses.cbegin(), candidateAddresses.cend(), [&addresses](const auto& address) {
+				return addresses.cend() != addresses.find(address);
+			});
+		}
 	}
 
 	class UtUpdater::Impl final {
@@ -49,13 +118,15 @@ namespace catapult { namespace chain {
 				const ExecutionConfiguration& config,
 				const TimeSupplier& timeSupplier,
 				const FailedTransactionSink& failedTransactionSink,
-				const Throttle& throttle)
+				const Throttle& throttle,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
 				: m_transactionsCache(transactionsCache)
 				, m_detachedCatapultCache(confirmedCatapultCache)
 				, m_config(config)
 				, m_timeSupplier(timeSupplier)
 				, m_failedTransactionSink(failedTransactionSink)
 				, m_throttle(throttle)
+				, m_pPool(pPool)
 		{}
 
 	public:
@@ -121,7 +192,16 @@ namespace catapult { namespace chain {
 			auto& cache = applyState.UnconfirmedCatapultCache;
 			state::CatapultState dummyState;
 			auto observerContext = observers::ObserverContext(cache, dummyState, effectiveHeight, observers::NotifyMode::Commit);
-			for (const auto& utInfo : utInfos) {
+
+			// 1. pre-validate all transactions in parallel against the (unmodified) unconfirmed state
+			auto prevalidationResults = prevalidate(utInfos, filter, validatorContext);
+
+			// 2. apply all transactions sequentially
+			//    (a pre-validation failure is only trusted when no previously applied transaction involves the same addresses)
+			model::AddressSet appliedAddresses;
+			NotificationUndoLog undoLog;
+			for (auto i = 0u; i < utInfos.size(); ++i) {
+				const auto& utInfo = utInfos[i];
 				const auto& entity = *utInfo.pEntity;
 				const auto& entityHash = utInfo.EntityHash;
 
@@ -137,26 +217,75 @@ namespace catapult { namespace chain {
 				if (!applyState.Modifier.add(utInfo))
 					continue;
 
+				const auto* pPrevalidationResult = prevalidationResults.empty() ? nullptr : &prevalidationResults[i];
+				if (pPrevalidationResult
+						&& IsValidationResultFailure(pPrevalidationResult->Result)
+						&& !HasAnyAddress(appliedAddresses, *pPrevalidationResult->pAddresses)) {
+					drop(utInfo, pPrevalidationResult->Result);
+					applyState.Modifier.remove(entityHash);
+					continue;
+				}
+
 				// notice that subscriber is created within loop because aggregate result needs to be reset each iteration
+				// (but the undo log is shared so that its storage is reused)
 				ProcessingNotificationSubscriber sub(*m_config.pValidator, validatorContext, *m_config.pObserver, observerContext);
-				sub.enableUndo();
+				sub.enableUndo(undoLog);
 				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
 				m_config.pNotificationPublisher->publish(entityInfo, sub);
 				if (!IsValidationResultSuccess(sub.result())) {
-					CATAPULT_LOG_LEVEL(validators::MapToLogLevel(sub.result()))
-							<< "dropping transaction " << utils::HexFormat(entityHash) << ": " << sub.result();
-
-					// only forward failure (not neutral) results
-					if (IsValidationResultFailure(sub.result()))
-						m_failedTransactionSink(entity, entityHash, sub.result());
-
+					drop(utInfo, sub.result());
 					sub.undo();
 					applyState.Modifier.remove(entityHash);
 					continue;
 				}
+
+				undoLog.clear();
+				if (pPrevalidationResult)
+					appliedAddresses.insert(pPrevalidationResult->pAddresses->cbegin(), pPrevalidationResult->pAddresses->cend());
 			}
 		}
 
+		std::vector<PrevalidationResult> prevalidate(
+				const std::vector<model::TransactionInfo>& utInfos,
+				const predicate<const model::TransactionInfo&>& filter,
+				const validators::ValidatorContext& validatorContext) const {
+			std::vector<PrevalidationResult> prevalidationResults;
+			if (!m_pPool || utInfos.empty())
+				return prevalidationResults;
+
+			// notice that the unconfirmed state is not modified until all pre-validations complete
+			prevalidationResults.resize(utInfos.size());
+			const auto& config = m_config;
+			auto numPartitions = m_pPool->numWorkerThreads();
+			thread::ParallelFor(m_pPool->service(), utInfos, numPartitions, [&config, &filter, &validatorContext, &prevalidationResults](
+					const auto& utInfo,
+					auto index) {
+				if (!filter(utInfo))
+					return true;
+
+				auto& prevalidationResult = prevalidationResults[index];
+				prevalidationResult.pAddresses = utInfo.OptionalExtractedAddresses
+						? utInfo.OptionalExtractedAddresses
+						: std::make_shared<model::AddressSet>(model::ExtractAddresses(*utInfo.pEntity, *config.pNotificationPublisher));
+
+				PrevalidatingNotificationSubscriber sub(*config.pValidator, validatorContext);
+				config.pNotificationPublisher->publish(model::WeakEntityInfo(*utInfo.pEntity, utInfo.EntityHash), sub);
+				prevalidationResult.Result = sub.result();
+				return true;
+			}).get();
+
+			return prevalidationResults;
+		}
+
+		void drop(const model::TransactionInfo& utInfo, validators::ValidationResult result) const {
+			CATAPULT_LOG_LEVEL(validators::MapToLogLevel(result))
+					<< "dropping transaction " << utils::HexFormat(utInfo.EntityHash) << ": " << result;
+
+			// only forward failure (not neutral) results
+			if (IsValidationResultFailure(result))
+				m_failedTransactionSink(*utInfo.pEntity, utInfo.EntityHash, result);
+		}
+
 		bool throttle(
 				const model::TransactionInfo& utInfo,
 				TransactionSource transactionSource,
@@ -177,6 +306,7 @@ namespace catapult { namespace chain {
 		TimeSupplier m_timeSupplier;
 		FailedTransactionSink m_failedTransactionSink;
 		UtUpdater::Throttle m_throttle;
+		std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
 	};
 
 	UtUpdater::UtUpdater(
@@ -186,13 +316,25 @@ namespace catapult { namespace chain {
 			const TimeSupplier& timeSupplier,
 			const FailedTransactionSink& failedTransactionSink,
 			const Throttle& throttle)
+			: UtUpdater(transactionsCache, confirmedCatapultCache, config, timeSupplier, failedTransactionSink, throttle, nullptr)
+	{}
+
+	UtUpdater::UtUpdater(
+			cache::UtCache& transactionsCache,
+			const cache::CatapultCache& confirmedCatapultCache,
+			const ExecutionConfiguration& config,
+			const TimeSupplier& timeSupplier,
+			const FailedTransactionSink& failedTransactionSink,
+			const Throttle& throttle,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
 			: m_pImpl(std::make_unique<Impl>(
 					transactionsCache,
 					confirmedCatapultCache,
 					config,
 					timeSupplier,
 					failedTransactionSink,
-					throttle))
+					throttle,
+					pPool))
 	{}
 
 	UtUpdater::~UtUpdater() = default;
@@ -31,6 +31,7 @@ namespace catapult {
 		class UtCache;
 		class UtCacheModifierProxy;
 	}
+	namespace thread { class IoServiceThreadPool; }
 }
 
 namespace catapult { namespace chain {
@@ -79,6 +80,20 @@ namespace catapult { namespace chain {
 				const FailedTransactionSink& failedTransactionSink,
 				const Throttle& throttle);
 
+		/// Creates an updater around \a transactionsCache with execution configuration (\a config),
+		/// current time supplier (\a timeSupplier) and failed transaction sink (\a failedTransactionSink).
+		/// \a confirmedCatapultCache is the real (confirmed) catapult cache.
+		/// \a throttle allows throttling (rejection) of transactions.
+		/// \a pPool is used to pre-validate transactions in parallel before they are applied sequentially.
+		UtUpdater(
+				cache::UtCache& transactionsCache,
+				const cache::CatapultCache& confirmedCatapultCache,
+				const ExecutionConfiguration& config,
+				const TimeSupplier& timeSupplier,
+				const FailedTransactionSink& failedTransactionSink,
+				const Throttle& throttle,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pPool);
+
 		/// Destroys the updater.
 		~UtUpdater();
 
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/disruptor/ConsumerWaitStrategy.h"
 #include "catapult/ionet/ConnectionSecurityMode.h"
 #include "catapult/ionet/NodeRoles.h"
 #include "catapult/utils/FileSize.h"
@@ -47,6 +48,13 @@ namespace catapult { namespace config {
 		/// \c true if cache data should be saved in a database.
 		bool ShouldUseCacheDatabaseStorage;
 
+		/// \c true if blocks should be read from memory mapped block files, \c false if they should be copied into memory.
+		bool ShouldUseMemoryMappedBlockStorage;
+
+		/// \c true if blocks should be stored in segment files, \c false if each block should be stored in its own file.
+		/// \note Existing block files need to be migrated (e.g. with the block migration tool) before enabling this.
+		bool ShouldUseSegmentedBlockStorage;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool ShouldEnableTransactionSpamThrottling;
 
@@ -59,6 +67,9 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of pending (pipelined) block requests when extending the chain during sync.
+		uint32_t MaxPendingBlockRequests;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -99,12 +110,18 @@ namespace catapult { namespace config {
 		/// Multiple of elements at which a block element should be traced through queue and completion.
 		uint32_t BlockElementTraceInterval;
 
+		/// Strategy used by block consumers waiting for elements.
+		disruptor::ConsumerWaitStrategy BlockDisruptorWaitStrategy;
+
 		/// Size of the transaction disruptor circular buffer.
 		uint32_t TransactionDisruptorSize;
 
 		/// Multiple of elements at which a transaction element should be traced through queue and completion.
 		uint32_t TransactionElementTraceInterval;
 
+		/// Strategy used by transaction consumers waiting for elements.
+		disruptor::ConsumerWaitStrategy TransactionDisruptorWaitStrategy;
+
 		/// \c true if the process should terminate when any dispatcher is full.
 		bool ShouldAbortWhenDispatcherIsFull;
 
@@ -21,23 +21,29 @@
 #include "BlockConsumers.h"
 #include "ConsumerResultFactory.h"
 #include "TransactionConsumers.h"
+#include "catapult/model/ExtractedAddressesCache.h"
 #include "catapult/model/TransactionUtils.h"
 
 namespace catapult { namespace consumers {
 
 	namespace {
+		using ExtractAddressesFunc = std::function<std::shared_ptr<model::AddressSet> (const model::TransactionElement&)>;
+
+		ExtractAddressesFunc CreateUncachedExtractor(const model::NotificationPublisher& notificationPublisher) {
+			return [&notificationPublisher](const auto& element) {
+				return std::make_shared<model::AddressSet>(ExtractAddresses(element.Transaction, notificationPublisher));
+			};
+		}
+
 		template<typename TTransactionElements>
-		void UpdateAddresses(TTransactionElements& elements, const model::NotificationPublisher& notificationPublisher) {
-			for (auto& element : elements) {
-				auto addresses = ExtractAddresses(element.Transaction, notificationPublisher);
-				element.OptionalExtractedAddresses = std::make_shared<decltype(addresses)>(std::move(addresses));
-			}
+		void UpdateAddresses(TTransactionElements& elements, const ExtractAddressesFunc& extractAddresses) {
+			for (auto& element : elements)
+				element.OptionalExtractedAddresses = extractAddresses(element);
 		}
 
 		class BlockAddressExtractionConsumer {
 		public:
-			explicit BlockAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher)
-					: m_notificationPublisher(notificationPublisher)
+			explicit BlockAddressExtractionConsumer(const ExtractAddressesFunc& extractAddresses) : m_extractAddresses(extractAddresses)
 			{}
 
 		public:
@@ -46,25 +52,33 @@ namespace catapult { namespace consumers {
 					return Abort(Failure_Consumer_Empty_Input);
 
 				for (auto& element : elements)
-					UpdateAddresses(element.Transactions, m_notificationPublisher);
+					UpdateAddresses(element.Transactions, m_extractAddresses);
 
 				return Continue();
 			}
 
 		private:
-			const model::NotificationPublisher& m_notificationPublisher;
+			ExtractAddressesFunc m_extractAddresses;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher) {
-		return BlockAddressExtractionConsumer(notificationPublisher);
+		return BlockAddressExtractionConsumer(CreateUncachedExtractor(notificationPublisher));
+	}
+
+	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(model::ExtractedAddressesCache& addressesCache) {
+		// confirmed transactions are not expected to be seen again, so their cached addresses can be released
+		// (merkle component hashes are used because, unlike entity hashes, they cover aggregate cosigners)
+		return BlockAddressExtractionConsumer([&addressesCache](const auto& element) {
+			return addressesCache.extractAndRemove(element.Transaction, element.MerkleComponentHash);
+		});
 	}
 
 	namespace {
 		class TransactionAddressExtractionConsumer {
 		public:
-			explicit TransactionAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher)
-					: m_notificationPublisher(notificationPublisher)
+			explicit TransactionAddressExtractionConsumer(const ExtractAddressesFunc& extractAddresses)
+					: m_extractAddresses(extractAddresses)
 			{}
 
 		public:
@@ -72,17 +86,23 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				UpdateAddresses(elements, m_notificationPublisher);
+				UpdateAddresses(elements, m_extractAddresses);
 
 				return Continue();
 			}
 
 		private:
-			const model::NotificationPublisher& m_notificationPublisher;
+			ExtractAddressesFunc m_extractAddresses;
 		};
 	}
 
 	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher) {
-		return TransactionAddressExtractionConsumer(notificationPublisher);
+		return TransactionAddressExtractionConsumer(CreateUncachedExtractor(notificationPublisher));
+	}
+
+	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(model::ExtractedAddressesCache& addressesCache) {
+		return TransactionAddressExtractionConsumer([&addressesCache](const auto& element) {
+			return addressesCache.extract(element.Transaction, element.MerkleComponentHash);
+		});
 	}
 }}
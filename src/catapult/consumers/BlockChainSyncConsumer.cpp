@@ -27,6 +27,7 @@
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/utils/Casting.h"
+#include <map>
 
 namespace catapult { namespace consumers {
 
@@ -38,9 +39,14 @@ namespace catapult { namespace consumers {
 		}
 
 		struct UnwindResult {
+		public:
+			UnwindResult() : IsJournaled(true)
+			{}
+
 		public:
 			model::ChainScore Score;
 			consumers::TransactionInfos TransactionInfos;
+			bool IsJournaled; // true if all unwound changes were reverted using the undo journal
 
 		public:
 			void addBlockTransactionInfos(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
@@ -57,6 +63,7 @@ namespace catapult { namespace consumers {
 					, m_pOriginalState(&state)
 					, m_pCacheDelta(std::make_unique<cache::CatapultCacheDelta>(cache.createDelta()))
 					, m_stateCopy(state)
+					, m_isJournaled(true)
 			{}
 
 		public:
@@ -76,6 +83,10 @@ namespace catapult { namespace consumers {
 				return *m_pCacheDelta;
 			}
 
+			bool isJournaled() const {
+				return m_isJournaled;
+			}
+
 		public:
 			TransactionInfos detachRemovedTransactionInfos() {
 				return std::move(m_removedTransactionInfos);
@@ -85,13 +96,19 @@ namespace catapult { namespace consumers {
 				return observers::ObserverState(*m_pCacheDelta, m_stateCopy);
 			}
 
+			void resetState(const state::CatapultState& state) {
+				m_stateCopy = state;
+			}
+
 			void update(
 					std::shared_ptr<const model::BlockElement>&& pCommonBlockElement,
 					model::ChainScore&& scoreDelta,
-					TransactionInfos&& removedTransactionInfos) {
+					TransactionInfos&& removedTransactionInfos,
+					bool isJournaled) {
 				m_pCommonBlockElement = std::move(pCommonBlockElement);
 				m_scoreDelta = std::move(scoreDelta);
 				m_removedTransactionInfos = std::move(removedTransactionInfos);
+				m_isJournaled = isJournaled;
 			}
 
 			void commit(Height height) {
@@ -109,8 +126,12 @@ namespace catapult { namespace consumers {
 			std::shared_ptr<const model::BlockElement> m_pCommonBlockElement;
 			model::ChainScore m_scoreDelta;
 			TransactionInfos m_removedTransactionInfos;
+			bool m_isJournaled;
 		};
 
+		// catapult states before all journaled commits keyed by the cache height before each commit
+		using StateJournal = std::map<Height, state::CatapultState>;
+
 		class BlockChainSyncConsumer {
 		public:
 			explicit BlockChainSyncConsumer(
@@ -124,7 +145,10 @@ namespace catapult { namespace consumers {
 					, m_storage(storage)
 					, m_maxRollbackBlocks(maxRollbackBlocks)
 					, m_handlers(handlers)
-			{}
+					, m_pStateJournal(std::make_shared<StateJournal>()) {
+				// journal all commits so that rollbacks do not need to execute the unwound blocks in reverse
+				m_cache.enableUndoJournal(m_maxRollbackBlocks);
+			}
 
 		public:
 			ConsumerResult operator()(disruptor::ConsumerInput& input) const {
@@ -173,7 +197,7 @@ namespace catapult { namespace consumers {
 				// 4. unwind to the common block height and calculate the local chain score
 				syncState = SyncState(m_cache, m_state);
 				auto commonBlockHeight = peerStartHeight - Height(1);
-				auto unwindResult = unwindLocalChain(localChainHeight, commonBlockHeight, storageView, syncState.observerState());
+				auto unwindResult = unwindLocalChain(localChainHeight, commonBlockHeight, storageView, syncState);
 				const auto& localScore = unwindResult.Score;
 
 				// 5. calculate the remote chain score
@@ -188,7 +212,11 @@ namespace catapult { namespace consumers {
 				}
 
 				peerScore -= localScore; // calculate the score delta
-				syncState.update(std::move(pCommonBlockElement), std::move(peerScore), std::move(unwindResult.TransactionInfos));
+				syncState.update(
+						std::move(pCommonBlockElement),
+						std::move(peerScore),
+						std::move(unwindResult.TransactionInfos),
+						unwindResult.IsJournaled);
 				return Continue();
 			}
 
@@ -206,11 +234,18 @@ namespace catapult { namespace consumers {
 					Height localChainHeight,
 					Height commonBlockHeight,
 					const io::BlockStorageView& storage,
-					const observers::ObserverState& observerState) const {
+					SyncState& syncState) const {
 				UnwindResult result;
 				if (localChainHeight == commonBlockHeight)
 					return result;
 
+				// 1. revert the changes of all journaled blocks
+				auto undoHeight = undoJournaledCommits(localChainHeight, commonBlockHeight, syncState);
+				result.IsJournaled = commonBlockHeight == undoHeight;
+
+				// 2. revert the changes of all remaining blocks by executing them in reverse
+				//    (blocks still need to be loaded in order to calculate the score and collect the transactions)
+				auto observerState = syncState.observerState();
 				auto height = localChainHeight;
 				std::shared_ptr<const model::BlockElement> pChildBlockElement;
 				while (true) {
@@ -225,7 +260,9 @@ namespace catapult { namespace consumers {
 					if (height == commonBlockHeight)
 						break;
 
-					m_handlers.UndoBlock(*pParentBlockElement, observerState);
+					if (height <= undoHeight)
+						m_handlers.UndoBlock(*pParentBlockElement, observerState);
+
 					pChildBlockElement = std::move(pParentBlockElement);
 					height = height - Height(1);
 				}
@@ -233,6 +270,22 @@ namespace catapult { namespace consumers {
 				return result;
 			}
 
+			Height undoJournaledCommits(Height localChainHeight, Height commonBlockHeight, SyncState& syncState) const {
+				auto cacheHeight = m_cache.createView().height();
+				auto undoHeight = m_cache.undo(commonBlockHeight);
+				if (cacheHeight == undoHeight)
+					return localChainHeight;
+
+				// the cache was reverted to undoHeight, so the catapult state needs to be reverted too
+				auto iter = m_pStateJournal->find(undoHeight);
+				if (m_pStateJournal->cend() == iter)
+					CATAPULT_THROW_RUNTIME_ERROR_1("catapult state is not journaled at undo height", undoHeight);
+
+				CATAPULT_LOG(debug) << "reverted cache from height " << localChainHeight << " to " << undoHeight << " using undo journal";
+				syncState.resetState(iter->second);
+				return undoHeight;
+			}
+
 			ConsumerResult process(BlockElements& elements, SyncState& syncState) const {
 				auto processResult = m_handlers.Processor(syncState.commonBlockInfo(), elements, syncState.observerState());
 				if (!validators::IsValidationResultSuccess(processResult)) {
@@ -253,7 +306,9 @@ namespace catapult { namespace consumers {
 				m_handlers.StateChange(StateChangeInfo(syncState.cacheDelta(), syncState.scoreDelta(), newHeight));
 
 				// 3. commit changes to the in-memory cache
+				auto originalState = m_state;
 				syncState.commit(newHeight);
+				updateStateJournal(syncState.commonBlockHeight(), newHeight, originalState, syncState.isJournaled());
 
 				// 4. update the unconfirmed transactions
 				auto peerTransactionHashes = ExtractTransactionHashes(elements);
@@ -269,12 +324,34 @@ namespace catapult { namespace consumers {
 				storageModifier.saveBlocks(elements);
 			}
 
+			void updateStateJournal(
+					Height commonBlockHeight,
+					Height newHeight,
+					const state::CatapultState& originalState,
+					bool isJournaled) const {
+				// mirror the cache undo journal, which is discarded when unwound blocks were executed in reverse
+				auto& stateJournal = *m_pStateJournal;
+				if (!isJournaled) {
+					stateJournal.clear();
+					return;
+				}
+
+				// the commit replaces all undone commits, so it starts at the common block height
+				stateJournal.erase(stateJournal.upper_bound(commonBlockHeight), stateJournal.end());
+				stateJournal.emplace(commonBlockHeight, originalState);
+
+				// drop all states below the lowest height that can be rolled back to
+				auto minHeight = newHeight.unwrap() > m_maxRollbackBlocks + 1u ? newHeight.unwrap() - m_maxRollbackBlocks - 1 : 0u;
+				stateJournal.erase(stateJournal.cbegin(), stateJournal.lower_bound(Height(minHeight)));
+			}
+
 		private:
 			cache::CatapultCache& m_cache;
 			state::CatapultState& m_state;
 			io::BlockStorageCache& m_storage;
 			uint32_t m_maxRollbackBlocks;
 			BlockChainSyncHandlers m_handlers;
+			std::shared_ptr<StateJournal> m_pStateJournal; // shared because the consumer is copied into a disruptor consumer
 		};
 	}
 
@@ -30,7 +30,10 @@
 namespace catapult {
 	namespace chain { struct CatapultState; }
 	namespace io { class BlockStorageCache; }
-	namespace model { class TransactionRegistry; }
+	namespace model {
+		class ExtractedAddressesCache;
+		class TransactionRegistry;
+	}
 	namespace utils { class TimeSpan; }
 }
 
@@ -46,6 +49,10 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that extracts all addresses affected by transactions using \a notificationPublisher.
 	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher);
 
+	/// Creates a consumer that extracts all addresses affected by transactions using \a addressesCache.
+	/// \note Addresses of transactions that have already been extracted (e.g. when unconfirmed) are reused.
+	disruptor::BlockConsumer CreateBlockAddressExtractionConsumer(model::ExtractedAddressesCache& addressesCache);
+
 	/// Creates a consumer that checks a block chain for internal integrity.
 	/// A valid chain must have no more than \a maxChainSize blocks and end no more than \a maxBlockFutureTime past the current time
 	/// supplied by \a timeSupplier.
@@ -26,7 +26,12 @@
 #include "catapult/model/EntityInfo.h"
 #include "catapult/validators/ParallelValidationPolicy.h"
 
-namespace catapult { namespace model { class NotificationPublisher; } }
+namespace catapult {
+	namespace model {
+		class ExtractedAddressesCache;
+		class NotificationPublisher;
+	}
+}
 
 namespace catapult { namespace consumers {
 
@@ -44,6 +49,10 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that extracts all addresses affected by transactions using \a notificationPublisher.
 	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(const model::NotificationPublisher& notificationPublisher);
 
+	/// Creates a consumer that extracts all addresses affected by transactions using \a addressesCache.
+	/// \note Extracted addresses are cached so that they can be reused when the transactions are confirmed.
+	disruptor::TransactionConsumer CreateTransactionAddressExtractionConsumer(model::ExtractedAddressesCache& addressesCache);
+
 	/// Creates a consumer that runs stateless validation using \a pValidator and the specified policy
 	/// (\a pValidationPolicy) and calls \a failedTransactionSink for each failure.
 	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
@@ -22,7 +22,10 @@
 #include "CryptoUtils.h"
 #include "Hashes.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <random>
 #include <ref10/crypto_verify_32.h>
 
 extern "C" {
@@ -131,41 +134,414 @@ namespace catapult { namespace crypto {
 		return Verify(publicKey, { dataBuffer }, signature);
 	}
 
+	namespace {
+		struct PreparedSignature {
+			const uint8_t* pEncodedR;
+			const uint8_t* pEncodedS;
+			Hash512 h;
+			ge_p3 NegativeA;
+		};
+
+		bool PrepareSignature(
+				const Key& publicKey,
+				std::initializer_list<const RawBuffer> buffersList,
+				const Signature& signature,
+				PreparedSignature& prepared) {
+			prepared.pEncodedR = signature.data();
+			prepared.pEncodedS = signature.data() + Encoded_Size;
+
+			// reject if not canonical
+			if (!IsCanonicalS(prepared.pEncodedS))
+				return false;
+
+			// reject zero public key, which is known weak key
+			const Key Zero_Key{};
+			if (Zero_Key == publicKey)
+				return false;
+
+			// h = H(encodedR || public || data)
+			Sha3_512_Builder sha3_h;
+			sha3_h.update({ { prepared.pEncodedR, Encoded_Size }, publicKey });
+			sha3_h.update(buffersList);
+			sha3_h.final(prepared.h);
+
+			// h = h mod group order
+			sc_reduce(prepared.h.data());
+
+			// A = -pub
+			return 0 == ge_frombytes_negate_vartime(&prepared.NegativeA, publicKey.data());
+		}
+
+		bool VerifyPrepared(const PreparedSignature& prepared) {
+			// R = encodedS * B - h * A
+			ge_p2 R;
+			ge_double_scalarmult_vartime(&R, prepared.h.data(), &prepared.NegativeA, prepared.pEncodedS);
+
+			// Compare calculated R to given R.
+			unsigned char checkr[Encoded_Size];
+			ge_tobytes(checkr, &R);
+			return 0 == crypto_verify_32(checkr, prepared.pEncodedR);
+		}
+	}
+
 	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature) {
-		const uint8_t *RESTRICT encodedR = signature.data();
-		const uint8_t *RESTRICT encodedS = signature.data() + Encoded_Size;
+		PreparedSignature prepared;
+		return PrepareSignature(publicKey, buffersList, signature, prepared) && VerifyPrepared(prepared);
+	}
 
-		// reject if not canonical
-		if (!IsCanonicalS(encodedS))
-			return false;
+	// region batch verification
 
-		// reject zero public key, which is known weak key
-		const Key Zero_Key{};
-		if (Zero_Key == publicKey)
-			return false;
+	namespace {
+		/// Size of the random coefficient applied to each verification equation in a batch (128 bits).
+		constexpr size_t Coefficient_Size = 16;
 
-		// h = H(encodedR || public || data)
-		Hash512 h;
-		Sha3_512_Builder sha3_h;
-		sha3_h.update({ { encodedR, Encoded_Size }, publicKey });
-		sha3_h.update(buffersList);
-		sha3_h.final(h);
+		/// Batches with fewer signatures are verified individually.
+		constexpr size_t Min_Batch_Size = 4;
 
-		// h = h mod group order
-		sc_reduce(h.data());
+		struct BatchSignature {
+			PreparedSignature Prepared;
+			ge_p3 NegativeR;
+		};
+
+		bool IsCanonicalEncodedPoint(const uint8_t* encodedPoint) {
+			// y (with sign bit cleared) must be less than 2^255 - 19
+			if (0x7F != (encodedPoint[Encoded_Size - 1] & 0x7F) || encodedPoint[0] < 0xED)
+				return true;
+
+			for (auto i = 1u; i < Encoded_Size - 1; ++i) {
+				if (0xFF != encodedPoint[i])
+					return true;
+			}
 
-		// A = -pub
-		ge_p3 A;
-		if (0 != ge_frombytes_negate_vartime(&A, publicKey.data()))
 			return false;
+		}
+
+		bool PrepareBatchSignature(const SignatureInput& signatureInput, BatchSignature& batchSignature) {
+			if (!PrepareSignature(signatureInput.Signer, { signatureInput.Data }, signatureInput.Signature, batchSignature.Prepared))
+				return false;
+
+			// Verify compares encodings, so reject any R that does not have a unique encoding
+			const auto* pEncodedR = batchSignature.Prepared.pEncodedR;
+			if (!IsCanonicalEncodedPoint(pEncodedR) || 0 != ge_frombytes_negate_vartime(&batchSignature.NegativeR, pEncodedR))
+				return false;
+
+			// a point with x == 0 has a unique encoding only when the sign bit is cleared
+			return 0 != fe_isnonzero(batchSignature.NegativeR.X) || 0 == (pEncodedR[Encoded_Size - 1] >> 7);
+		}
+
+		void AddCached(ge_p3& sum, const ge_cached& point) {
+			ge_p1p1 result;
+			ge_add(&result, &sum, &point);
+			ge_p1p1_to_p3(&sum, &result);
+		}
+
+		void AddPoint(ge_p3& sum, const ge_p3& point) {
+			ge_cached cachedPoint;
+			ge_p3_to_cached(&cachedPoint, &point);
+			AddCached(sum, cachedPoint);
+		}
+
+		void DoublePoint(ge_p3& point) {
+			ge_p1p1 result;
+			ge_p3_dbl(&result, &point);
+			ge_p1p1_to_p3(&point, &result);
+		}
+
+		// region Straus
+
+		constexpr size_t Scalar_Bits = 8 * Encoded_Size;
+
+		/// Number of precomputed odd multiples (P, 3P, ..., 15P) per point.
+		constexpr size_t Num_Odd_Multiples = 8;
+
+		/// Recodes \a scalar into signed odd digits in the range [-15, 15] (same as ref10 slide).
+		void Slide(int8_t* digits, const uint8_t* scalar) {
+			for (auto i = 0u; i < Scalar_Bits; ++i)
+				digits[i] = 1 & (scalar[i >> 3] >> (i & 7));
+
+			for (auto i = 0u; i < Scalar_Bits; ++i) {
+				if (!digits[i])
+					continue;
+
+				for (auto b = 1u; b <= 6 && i + b < Scalar_Bits; ++b) {
+					if (!digits[i + b])
+						continue;
+
+					if (digits[i] + (digits[i + b] << b) <= 15) {
+						digits[i] = static_cast<int8_t>(digits[i] + (digits[i + b] << b));
+						digits[i + b] = 0;
+					} else if (digits[i] - (digits[i + b] << b) >= -15) {
+						digits[i] = static_cast<int8_t>(digits[i] - (digits[i + b] << b));
+						for (auto k = i + b; k < Scalar_Bits; ++k) {
+							if (!digits[k]) {
+								digits[k] = 1;
+								break;
+							}
+
+							digits[k] = 0;
+						}
+					} else {
+						break;
+					}
+				}
+			}
+		}
+
+		/// Calculates sum(scalars[i] * points[i]) using Straus' method with interleaved sliding windows.
+		void StrausMultiply(ge_p3& result, const std::vector<const uint8_t*>& scalars, const std::vector<const ge_p3*>& points) {
+			std::vector<ge_cached> oddMultiples(points.size() * Num_Odd_Multiples);
+			std::vector<int8_t> digits(points.size() * Scalar_Bits);
+			size_t numBits = 0;
+			for (auto i = 0u; i < points.size(); ++i) {
+				auto* pMultiples = &oddMultiples[i * Num_Odd_Multiples];
+				ge_p3 doublePoint = *points[i];
+				DoublePoint(doublePoint);
+
+				ge_p3 multiple = *points[i];
+				ge_p3_to_cached(&pMultiples[0], &multiple);
+				for (auto j = 1u; j < Num_Odd_Multiples; ++j) {
+					AddPoint(multiple, doublePoint);
+					ge_p3_to_cached(&pMultiples[j], &multiple);
+				}
+
+				auto* pDigits = &digits[i * Scalar_Bits];
+				Slide(pDigits, scalars[i]);
+				for (auto bit = Scalar_Bits; bit > numBits; --bit) {
+					if (pDigits[bit - 1]) {
+						numBits = bit;
+						break;
+					}
+				}
+			}
+
+			ge_p3_0(&result);
+			for (auto bit = numBits; bit > 0; --bit) {
+				DoublePoint(result);
+
+				for (auto i = 0u; i < points.size(); ++i) {
+					auto digit = digits[i * Scalar_Bits + bit - 1];
+					if (0 == digit)
+						continue;
+
+					ge_p1p1 sum;
+					const auto& multiple = oddMultiples[i * Num_Odd_Multiples + static_cast<size_t>(std::abs(digit) / 2)];
+					if (digit > 0)
+						ge_add(&sum, &result, &multiple);
+					else
+						ge_sub(&sum, &result, &multiple);
+
+					ge_p1p1_to_p3(&result, &sum);
+				}
+			}
+		}
+
+		// endregion
+
+		// region Pippenger
+
+		uint32_t GetScalarWindow(const uint8_t* scalar, size_t bitOffset, size_t windowSize) {
+			auto byteOffset = bitOffset / 8;
+			uint32_t value = 0;
+			for (auto i = 0u; i < 3 && byteOffset + i < Encoded_Size; ++i)
+				value |= static_cast<uint32_t>(scalar[byteOffset + i]) << (8 * i);
+
+			return (value >> (bitOffset % 8)) & ((1u << windowSize) - 1);
+		}
+
+		size_t CalculateWindowSize(size_t numPoints) {
+			size_t log2 = 0;
+			while (numPoints >>= 1)
+				++log2;
+
+			return std::min<size_t>(std::max<size_t>(log2, 3) - 1, 12);
+		}
+
+		/// Calculates sum(scalars[i] * points[i]) using Pippenger's bucket method.
+		void PippengerMultiply(ge_p3& result, const std::vector<const uint8_t*>& scalars, const std::vector<const ge_p3*>& points) {
+			std::vector<ge_cached> cachedPoints(points.size());
+			for (auto i = 0u; i < points.size(); ++i)
+				ge_p3_to_cached(&cachedPoints[i], points[i]);
+
+			auto windowSize = CalculateWindowSize(points.size());
+			auto numBuckets = (1u << windowSize) - 1;
+			std::vector<ge_p3> buckets(numBuckets);
+			std::vector<bool> isBucketUsed(numBuckets);
+
+			ge_p3_0(&result);
+			auto numWindows = (Scalar_Bits + windowSize - 1) / windowSize;
+			for (auto window = numWindows; window > 0; --window) {
+				for (auto i = 0u; i < windowSize; ++i)
+					DoublePoint(result);
+
+				// distribute points into buckets by the value of their scalar window
+				std::fill(isBucketUsed.begin(), isBucketUsed.end(), false);
+				for (auto i = 0u; i < points.size(); ++i) {
+					auto bucketIndex = GetScalarWindow(scalars[i], (window - 1) * windowSize, windowSize);
+					if (0 == bucketIndex)
+						continue;
+
+					if (isBucketUsed[bucketIndex - 1]) {
+						AddCached(buckets[bucketIndex - 1], cachedPoints[i]);
+					} else {
+						buckets[bucketIndex - 1] = *points[i];
+						isBucketUsed[bucketIndex - 1] = true;
+					}
+				}
+
+				// sum(j * buckets[j]) == sum of running sums from the highest bucket down
+				ge_p3 runningSum;
+				ge_p3 windowSum;
+				ge_p3_0(&runningSum);
+				ge_p3_0(&windowSum);
+				for (auto j = numBuckets; j > 0; --j) {
+					if (isBucketUsed[j - 1])
+						AddPoint(runningSum, buckets[j - 1]);
+
+					AddPoint(windowSum, runningSum);
+				}
+
+				AddPoint(result, windowSum);
+			}
+		}
+
+		// endregion
+
+		/// Straus' method is faster for (relatively) small numbers of points, where bucket overhead dominates.
+		constexpr size_t Min_Pippenger_Points = 512;
+
+		/// Calculates sum(scalars[i] * points[i]).
+		void MultiScalarMultiply(ge_p3& result, const std::vector<const uint8_t*>& scalars, const std::vector<const ge_p3*>& points) {
+			if (points.size() < Min_Pippenger_Points)
+				StrausMultiply(result, scalars, points);
+			else
+				PippengerMultiply(result, scalars, points);
+		}
+
+		bool IsIdentity(const ge_p3& point) {
+			unsigned char encodedPoint[Encoded_Size];
+			ge_p3_tobytes(encodedPoint, &point);
+
+			unsigned char encodedIdentity[Encoded_Size]{};
+			encodedIdentity[0] = 1;
+			return 0 == std::memcmp(encodedPoint, encodedIdentity, Encoded_Size);
+		}
+
+		bool VerifyBatch(const RandomFiller& randomFiller, const BatchSignature* const* ppBatchSignatures, size_t count) {
+			if (count < Min_Batch_Size) {
+				for (auto i = 0u; i < count; ++i) {
+					if (!VerifyPrepared(ppBatchSignatures[i]->Prepared))
+						return false;
+				}
+
+				return true;
+			}
+
+			// every signature satisfies S * B - R - h * A == 0, so, for random z:
+			// sum(z * S) * B + sum(z * -R) + sum((z * h) * -A) == 0
+			std::vector<uint8_t> coefficients(count * Coefficient_Size);
+			randomFiller(coefficients.data(), coefficients.size());
+
+			std::vector<uint8_t> scalars(2 * count * Encoded_Size, 0);
+			std::vector<const uint8_t*> scalarPointers;
+			std::vector<const ge_p3*> points;
+			scalarPointers.reserve(2 * count);
+			points.reserve(2 * count);
+
+			const uint8_t Zero_Scalar[Encoded_Size]{};
+			uint8_t sumS[Encoded_Size]{};
+			for (auto i = 0u; i < count; ++i) {
+				const auto& batchSignature = *ppBatchSignatures[i];
+				auto* z = &scalars[2 * i * Encoded_Size];
+				auto* zh = z + Encoded_Size;
+				std::memcpy(z, &coefficients[i * Coefficient_Size], Coefficient_Size);
+
+				sc_muladd(sumS, z, batchSignature.Prepared.pEncodedS, sumS);
+				sc_muladd(zh, z, batchSignature.Prepared.h.data(), Zero_Scalar);
+
+				scalarPointers.push_back(z);
+				points.push_back(&batchSignature.NegativeR);
+				scalarPointers.push_back(zh);
+				points.push_back(&batchSignature.Prepared.NegativeA);
+			}
+
+			ge_p3 result;
+			MultiScalarMultiply(result, scalarPointers, points);
+
+			ge_p3 sumSMulBase;
+			ge_scalarmult_base(&sumSMulBase, sumS);
+			AddPoint(result, sumSMulBase);
+			return IsIdentity(result);
+		}
 
-		// R = encodedS * B - h * A
-		ge_p2 R;
-		ge_double_scalarmult_vartime(&R, h.data(), &A, encodedS);
+		void VerifyBatchAll(
+				const RandomFiller& randomFiller,
+				const BatchSignature* const* ppBatchSignatures,
+				const size_t* pIndexes,
+				size_t count,
+				std::vector<bool>& results) {
+			if (count < Min_Batch_Size) {
+				for (auto i = 0u; i < count; ++i)
+					results[pIndexes[i]] = VerifyPrepared(ppBatchSignatures[i]->Prepared);
+
+				return;
+			}
+
+			if (VerifyBatch(randomFiller, ppBatchSignatures, count)) {
+				for (auto i = 0u; i < count; ++i)
+					results[pIndexes[i]] = true;
+
+				return;
+			}
+
+			// split the failing batch in order to isolate the invalid signatures
+			auto leftCount = count / 2;
+			VerifyBatchAll(randomFiller, ppBatchSignatures, pIndexes, leftCount, results);
+			VerifyBatchAll(randomFiller, ppBatchSignatures + leftCount, pIndexes + leftCount, count - leftCount, results);
+		}
+	}
 
-		// Compare calculated R to given R.
-		unsigned char checkr[Encoded_Size];
-		ge_tobytes(checkr, &R);
-		return 0 == crypto_verify_32(checkr, encodedR);
+	bool VerifyMulti(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count) {
+		std::vector<BatchSignature> batchSignatures(count);
+		std::vector<const BatchSignature*> batchSignaturePointers(count);
+		for (auto i = 0u; i < count; ++i) {
+			if (!PrepareBatchSignature(pSignatureInputs[i], batchSignatures[i]))
+				return false;
+
+			batchSignaturePointers[i] = &batchSignatures[i];
+		}
+
+		return VerifyBatch(randomFiller, batchSignaturePointers.data(), count);
+	}
+
+	std::vector<bool> VerifyMultiAll(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count) {
+		std::vector<bool> results(count, false);
+		std::vector<BatchSignature> batchSignatures(count);
+		std::vector<const BatchSignature*> batchSignaturePointers;
+		std::vector<size_t> indexes;
+		for (auto i = 0u; i < count; ++i) {
+			// malformed signatures are invalid and are excluded from the batch
+			if (!PrepareBatchSignature(pSignatureInputs[i], batchSignatures[i]))
+				continue;
+
+			batchSignaturePointers.push_back(&batchSignatures[i]);
+			indexes.push_back(i);
+		}
+
+		VerifyBatchAll(randomFiller, batchSignaturePointers.data(), indexes.data(), indexes.size(), results);
+		return results;
+	}
+
+	// endregion
+
+	void SecureRandomFill(uint8_t* pData, size_t size) {
+		std::random_device generator;
+		while (0 != size) {
+			auto value = generator();
+			auto numBytes = std::min(size, sizeof(value));
+			std::memcpy(pData, &value, numBytes);
+
+			pData += numBytes;
+			size -= numBytes;
+		}
 	}
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "KeyPair.h"
+#include "catapult/functions.h"
 #include <vector>
 
 namespace catapult { namespace crypto {
@@ -39,4 +40,37 @@ namespace catapult { namespace crypto {
 	/// Verifies that \a signature of data in \a buffersList is valid, using public key \a publicKey.
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature);
+
+	/// Input to batch signature verification.
+	struct SignatureInput {
+		/// Public key of the signer.
+		const Key& Signer;
+
+		/// Signed data.
+		RawBuffer Data;
+
+		/// Signature of the data.
+		const catapult::Signature& Signature;
+	};
+
+	/// Fills a buffer with (cryptographically secure) random data.
+	using RandomFiller = consumer<uint8_t*, size_t>;
+
+	/// Fills \a size bytes pointed to by \a pData with random data from the system entropy source.
+	/// \note This function is compatible with RandomFiller.
+	void SecureRandomFill(uint8_t* pData, size_t size);
+
+	/// Verifies all \a count signatures in \a pSignatureInputs with a single randomized batch check
+	/// using coefficients generated by \a randomFiller.
+	/// Returns \c true if all signatures are valid.
+	/// \note A batch is accepted when a random linear combination of all verification equations holds, so, unlike Verify,
+	///       it can accept signatures with adversarially crafted small order components. Otherwise, the outcomes are equal
+	///       except with negligible (2^-128) probability.
+	bool VerifyMulti(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count);
+
+	/// Verifies all \a count signatures in \a pSignatureInputs with randomized batch checks
+	/// using coefficients generated by \a randomFiller.
+	/// Returns the validity of each signature.
+	/// \note Failing batches are split until the invalid signatures are isolated and checked individually.
+	std::vector<bool> VerifyMultiAll(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count);
 }}
@@ -21,6 +21,7 @@
 #pragma once
 #include "BaseSetCommitPolicy.h"
 #include "BaseSetDefaultTraits.h"
+#include "BaseSetUndoJournal.h"
 #include <memory>
 
 namespace catapult {
@@ -55,6 +56,7 @@ namespace catapult { namespace deltaset {
 		using KeyType = typename TSetTraits::KeyType;
 		using FindTraits = FindTraitsT<ElementType, TSetTraits::AllowsNativeValueModification>;
 		using DeltaType = BaseSetDelta<TElementTraits, TSetTraits>;
+		using UndoJournalType = BaseSetUndoJournal<TElementTraits, TSetTraits>;
 
 	public:
 		/// Creates a base set.
@@ -95,6 +97,11 @@ namespace catapult { namespace deltaset {
 
 			auto pDelta = std::make_shared<DeltaType>(m_elements);
 			m_pWeakDelta = pDelta;
+
+			// commits undone in a previous delta were discarded together with that delta
+			if (m_pUndoJournal)
+				m_pUndoJournal->reset();
+
 			return pDelta;
 		}
 
@@ -114,13 +121,48 @@ namespace catapult { namespace deltaset {
 				CATAPULT_THROW_RUNTIME_ERROR("attempting to commit changes to a set without any outstanding attached deltas");
 
 			auto deltas = pDelta->deltas();
+			if (m_pUndoJournal)
+				m_pUndoJournal->record(m_elements, deltas);
+
 			TCommitPolicy::Update(m_elements, deltas, std::forward<TArgs>(args)...);
 			pDelta->reset();
 		}
 
+	public:
+		/// Enables journaling of all subsequent commits so that they can be undone.
+		void enableUndoJournal() {
+			if (!m_pUndoJournal)
+				m_pUndoJournal = std::make_unique<UndoJournalType>();
+		}
+
+		/// Gets the number of journaled commits that can be undone.
+		size_t undoJournalSize() const {
+			return m_pUndoJournal ? m_pUndoJournal->size() : 0;
+		}
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		void pruneUndoJournal(size_t numRetainedCommits) {
+			if (m_pUndoJournal)
+				m_pUndoJournal->prune(numRetainedCommits);
+		}
+
+		/// Reverts the changes of the \a numCommits most recent journaled commits in the attached delta.
+		/// \note The undone commits are replaced by the next commit.
+		void undo(size_t numCommits) {
+			auto pDelta = m_pWeakDelta.lock();
+			if (!pDelta)
+				CATAPULT_THROW_RUNTIME_ERROR("attempting to undo commits of a set without any outstanding attached deltas");
+
+			if (!m_pUndoJournal)
+				CATAPULT_THROW_RUNTIME_ERROR("attempting to undo commits of a set without an undo journal");
+
+			m_pUndoJournal->undo(*pDelta, numCommits);
+		}
+
 	private:
 		SetType m_elements;
 		std::weak_ptr<DeltaType> m_pWeakDelta;
+		std::unique_ptr<UndoJournalType> m_pUndoJournal;
 
 	private:
 		template<typename TElementTraits2, typename TSetTraits2, typename TCommitPolicy2>
@@ -0,0 +1,151 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "BaseSetDelta.h"
+#include <deque>
+#include <vector>
+
+namespace catapult { namespace deltaset {
+
+	/// A journal of the changes committed to a base set that allows the most recent commits to be undone.
+	/// \tparam TElementTraits Traits describing the type of element.
+	/// \tparam TSetTraits Traits describing the underlying set.
+	///
+	/// \note: 1) this class is not thread safe.
+	///        2) immutable elements are assumed to never change for a given key.
+	template<typename TElementTraits, typename TSetTraits>
+	class BaseSetUndoJournal {
+	public:
+		using SetType = typename TSetTraits::SetType;
+		using MemorySetType = typename TSetTraits::MemorySetType;
+		using KeyType = typename TSetTraits::KeyType;
+		using DeltaType = BaseSetDelta<TElementTraits, TSetTraits>;
+
+	private:
+		using FindTraits = FindTraitsT<typename TElementTraits::ElementType, TSetTraits::AllowsNativeValueModification>;
+
+		// changes of a single commit, expressed as the keys of all added elements
+		// and the original values of all modified or removed elements
+		struct Entry {
+			std::vector<KeyType> AddedKeys;
+			MemorySetType OriginalElements;
+		};
+
+	public:
+		/// Creates an empty journal.
+		BaseSetUndoJournal() : m_numUndoneCommits(0)
+		{}
+
+	public:
+		/// Gets the number of journaled commits that have not been undone.
+		size_t size() const {
+			return m_entries.size() - m_numUndoneCommits;
+		}
+
+	public:
+		/// Journals the changes in \a deltas that are about to be committed to \a elements.
+		/// \note Any undone commits are merged into the new journal entry because their reversal is part of \a deltas.
+		void record(const SetType& elements, const DeltaElements<MemorySetType>& deltas) {
+			Entry entry;
+			for (const auto& element : deltas.Added)
+				entry.AddedKeys.push_back(TSetTraits::KeyTraits::ToKey(element));
+
+			AddOriginalElements(entry, elements, deltas.Copied);
+			AddOriginalElements(entry, elements, deltas.Removed);
+
+			// merge from newest to oldest so that the original elements of the oldest undone commit take precedence
+			for (auto i = 0u; i < m_numUndoneCommits; ++i) {
+				Merge(entry, m_entries.back());
+				m_entries.pop_back();
+			}
+
+			m_numUndoneCommits = 0;
+			m_entries.push_back(std::move(entry));
+		}
+
+		/// Reverts the changes of the \a numCommits most recent journaled commits that have not been undone in \a delta.
+		void undo(DeltaType& delta, size_t numCommits) {
+			if (numCommits > size())
+				CATAPULT_THROW_INVALID_ARGUMENT_2("cannot undo more commits than are journaled", numCommits, size());
+
+			for (auto i = 0u; i < numCommits; ++i) {
+				const auto& entry = m_entries[m_entries.size() - m_numUndoneCommits - 1];
+
+				// remove before inserting because a merged entry can both add and modify the same key
+				for (const auto& key : entry.AddedKeys)
+					delta.remove(key);
+
+				for (const auto& element : entry.OriginalElements)
+					Insert(delta, element, typename TElementTraits::MutabilityTag());
+
+				++m_numUndoneCommits;
+			}
+		}
+
+		/// Discards all undone commits that were not followed by a commit.
+		void reset() {
+			m_numUndoneCommits = 0;
+		}
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		void prune(size_t numRetainedCommits) {
+			while (m_entries.size() > numRetainedCommits)
+				m_entries.pop_front();
+		}
+
+	private:
+		static void AddOriginalElements(Entry& entry, const SetType& elements, const MemorySetType& changedElements) {
+			// look up original elements because removed elements can contain modified copies
+			for (const auto& element : changedElements) {
+				auto iter = elements.find(TSetTraits::KeyTraits::ToKey(element));
+				if (elements.cend() != iter)
+					entry.OriginalElements.insert(*iter);
+			}
+		}
+
+		static void Merge(Entry& entry, const Entry& olderEntry) {
+			for (const auto& key : olderEntry.AddedKeys) {
+				entry.OriginalElements.erase(key);
+				entry.AddedKeys.push_back(key);
+			}
+
+			for (const auto& element : olderEntry.OriginalElements) {
+				entry.OriginalElements.erase(TSetTraits::KeyTraits::ToKey(element));
+				entry.OriginalElements.insert(element);
+			}
+		}
+
+		static void Insert(DeltaType& delta, const typename TSetTraits::StorageType& element, MutableTypeTag) {
+			// insert a (deep) copy so that changes to the delta cannot modify the journaled element
+			typename FindTraits::ConstResultType pOriginal = FindTraits::ToResult(TSetTraits::ToValue(element));
+			delta.insert(TElementTraits::Copy(pOriginal));
+		}
+
+		static void Insert(DeltaType& delta, const typename TSetTraits::StorageType& element, ImmutableTypeTag) {
+			delta.insert(TSetTraits::ToValue(element));
+		}
+
+	private:
+		std::deque<Entry> m_entries;
+		size_t m_numUndoneCommits;
+	};
+}}
@@ -74,10 +74,17 @@ namespace catapult { namespace disruptor {
 				rangesMap = std::move(m_rangesMap);
 			}
 
+			if (rangesMap.empty())
+				return;
+
+			std::vector<ConsumerInput> inputs;
+			inputs.reserve(rangesMap.size());
 			for (auto& pair : rangesMap) {
 				auto mergedRange = EntityRange::MergeRanges(std::move(pair.second));
-				m_dispatcher.processElement(ConsumerInput({ std::move(mergedRange), pair.first.SourcePublicKey }, pair.first.Source));
+				inputs.emplace_back(TAnnotatedEntityRange(std::move(mergedRange), pair.first.SourcePublicKey), pair.first.Source);
 			}
+
+			m_dispatcher.processElements(std::move(inputs));
 		}
 
 	public:
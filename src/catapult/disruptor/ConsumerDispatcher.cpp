@@ -23,7 +23,7 @@
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/ExceptionLogging.h"
 #include "catapult/utils/Functional.h"
-#include <thread>
+#include <algorithm>
 
 namespace catapult { namespace disruptor {
 
@@ -59,6 +59,7 @@ namespace catapult { namespace disruptor {
 			, m_elementTraceInterval(options.ElementTraceInterval)
 			, m_shouldThrowIfFull(options.ShouldThrowIfFull)
 			, m_keepRunning(true)
+			, m_pWaiter(CreateConsumerWaiter(options.WaitStrategy))
 			, m_barriers(consumers.size() + 1)
 			, m_disruptor(options.DisruptorSize, options.ElementTraceInterval)
 			, m_inspector(inspector)
@@ -68,11 +69,15 @@ namespace catapult { namespace disruptor {
 			ConsumerEntry consumerEntry(currentLevel++);
 			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
 				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+				auto isReady = [pThis, &consumerEntry]() {
+					return !pThis->m_keepRunning || pThis->hasPendingElement(consumerEntry);
+				};
+
 				while (pThis->m_keepRunning) {
 					try {
 						auto* pDisruptorElement = pThis->tryNext(consumerEntry);
 						if (!pDisruptorElement) {
-							std::this_thread::sleep_for(std::chrono::milliseconds(10));
+							pThis->m_pWaiter->wait(isReady);
 							continue;
 						}
 
@@ -92,7 +97,9 @@ namespace catapult { namespace disruptor {
 			});
 		}
 
-		CATAPULT_LOG(info) << options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size() << " workers";
+		CATAPULT_LOG(info)
+				<< options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size() << " workers"
+				<< " (wait strategy " << options.WaitStrategy << ")";
 	}
 
 	ConsumerDispatcher::~ConsumerDispatcher() {
@@ -101,6 +108,7 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+		m_pWaiter->signal();
 		m_threads.join_all();
 	}
 
@@ -140,8 +148,11 @@ namespace catapult { namespace disruptor {
 		m_barriers[consumerEntry.level() + 1].advance();
 
 		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
-		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
+		// otherwise, wake up the next consumer (the last barrier is only observed by producers)
+		if (consumerEntry.level() + 1 != m_barriers.size() - 1) {
+			m_pWaiter->signal();
 			return;
+		}
 
 		auto& element = m_disruptor.elementAt(consumerPosition);
 		LogCompletion(element, m_barriers, m_elementTraceInterval);
@@ -149,16 +160,22 @@ namespace catapult { namespace disruptor {
 		element.markProcessingComplete();
 	}
 
-	bool ConsumerDispatcher::canProcessNextElement() const {
+	bool ConsumerDispatcher::hasPendingElement(const ConsumerEntry& consumerEntry) const {
+		return m_barriers[consumerEntry.level()].position() != consumerEntry.position();
+	}
+
+	bool ConsumerDispatcher::canProcessNextElements(size_t count) const {
 		auto minPosition = m_barriers[m_barriers.size() - 1].position();
 		auto maxPosition = m_barriers[0].position();
-		auto requiredCapacity = maxPosition - minPosition + 1 + 1; // check for space for *next* element
+		auto requiredCapacity = maxPosition - minPosition + 1 + count; // check for space for *next* elements
 		auto totalCapacity = m_disruptor.capacity();
 
 		if (requiredCapacity < totalCapacity)
 			return true;
 
-		CATAPULT_LOG(warning) << "disruptor is full (minPosition = " << minPosition << ", maxPosition = " << maxPosition << ")";
+		CATAPULT_LOG(warning)
+				<< "disruptor is full (minPosition = " << minPosition << ", maxPosition = " << maxPosition
+				<< ", count = " << count << ")";
 		return requiredCapacity == totalCapacity;
 	}
 
@@ -177,7 +194,7 @@ namespace catapult { namespace disruptor {
 
 		// need to atomically check spare capacity AND add element
 		utils::SpinLockGuard guard(m_addSpinLock);
-		if (!canProcessNextElement()) {
+		if (!canProcessNextElements(1)) {
 			if (m_shouldThrowIfFull)
 				CATAPULT_THROW_RUNTIME_ERROR("consumer is too far behind");
 
@@ -187,10 +204,51 @@ namespace catapult { namespace disruptor {
 		++m_numActiveElements;
 		auto id = m_disruptor.add(std::move(input), wrap(processingComplete));
 		m_barriers[0].advance();
+		m_pWaiter->signal();
 		return id;
 	}
 
 	DisruptorElementId ConsumerDispatcher::processElement(ConsumerInput&& input) {
 		return processElement(std::move(input), [](auto, auto) {});
 	}
+
+	std::vector<DisruptorElementId> ConsumerDispatcher::processElements(
+			std::vector<ConsumerInput>&& inputs,
+			const ProcessingCompleteFunc& processingComplete) {
+		std::vector<DisruptorElementId> ids(inputs.size(), 0);
+		auto numNonEmptyInputs = static_cast<size_t>(std::count_if(inputs.cbegin(), inputs.cend(), [](const auto& input) {
+			return !input.empty();
+		}));
+
+		if (0 == numNonEmptyInputs) {
+			CATAPULT_LOG(trace) << "dispatcher is ignoring " << inputs.size() << " empty inputs";
+			return ids;
+		}
+
+		auto wrappedProcessingComplete = wrap(processingComplete);
+
+		// need to atomically check spare capacity for AND add all elements so that they occupy a contiguous range
+		utils::SpinLockGuard guard(m_addSpinLock);
+		if (!canProcessNextElements(numNonEmptyInputs)) {
+			if (m_shouldThrowIfFull)
+				CATAPULT_THROW_RUNTIME_ERROR_1("consumer is too far behind to accept inputs", numNonEmptyInputs);
+
+			return ids;
+		}
+
+		m_numActiveElements += numNonEmptyInputs;
+		for (auto i = 0u; i < inputs.size(); ++i) {
+			if (!inputs[i].empty())
+				ids[i] = m_disruptor.add(std::move(inputs[i]), wrappedProcessingComplete);
+		}
+
+		// publish all elements with a single barrier advance
+		m_barriers[0].advance(numNonEmptyInputs);
+		m_pWaiter->signal();
+		return ids;
+	}
+
+	std::vector<DisruptorElementId> ConsumerDispatcher::processElements(std::vector<ConsumerInput>&& inputs) {
+		return processElements(std::move(inputs), [](auto, auto) {});
+	}
 }}
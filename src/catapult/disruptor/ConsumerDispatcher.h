@@ -20,6 +20,7 @@
 
 #pragma once
 #include "ConsumerDispatcherOptions.h"
+#include "ConsumerWaitStrategy.h"
 #include "Disruptor.h"
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
@@ -64,6 +65,16 @@ namespace catapult { namespace disruptor {
 		/// Pushes the \a input into underlying disruptor and returns the assigned element id.
 		DisruptorElementId processElement(ConsumerInput&& input);
 
+		/// Pushes all \a inputs into underlying disruptor as a single contiguous range and returns the assigned element ids.
+		/// Once the processing of each input is complete, \a processingComplete will be called.
+		/// \note Empty inputs are ignored and are assigned an element id of zero.
+		std::vector<DisruptorElementId> processElements(
+				std::vector<ConsumerInput>&& inputs,
+				const ProcessingCompleteFunc& processingComplete);
+
+		/// Pushes all \a inputs into underlying disruptor as a single contiguous range and returns the assigned element ids.
+		std::vector<DisruptorElementId> processElements(std::vector<ConsumerInput>&& inputs);
+
 		/// Returns the total number of elements added to the disruptor.
 		size_t numAddedElements() const;
 
@@ -75,7 +86,9 @@ namespace catapult { namespace disruptor {
 
 		void advance(ConsumerEntry& consumerEntry);
 
-		bool canProcessNextElement() const;
+		bool hasPendingElement(const ConsumerEntry& consumerEntry) const;
+
+		bool canProcessNextElements(size_t count) const;
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete);
 
@@ -83,12 +96,13 @@ namespace catapult { namespace disruptor {
 		size_t m_elementTraceInterval;
 		bool m_shouldThrowIfFull;
 		std::atomic_bool m_keepRunning;
+		std::unique_ptr<ConsumerWaiter> m_pWaiter;
 		DisruptorBarriers m_barriers;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
 		boost::thread_group m_threads;
 		std::atomic<size_t> m_numActiveElements;
 
-		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
+		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add and reserve contiguous positions
 	};
 }}
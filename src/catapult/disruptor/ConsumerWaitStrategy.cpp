@@ -0,0 +1,149 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "ConsumerWaitStrategy.h"
+#include "catapult/utils/ConfigurationValueParsers.h"
+#include "catapult/utils/MacroBasedEnumIncludes.h"
+#include "catapult/exceptions.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define DEFINE_ENUM ConsumerWaitStrategy
+#define ENUM_LIST CONSUMER_WAIT_STRATEGY_LIST
+#include "catapult/utils/MacroBasedEnum.h"
+#undef ENUM_LIST
+#undef DEFINE_ENUM
+
+	namespace {
+		const std::array<std::pair<const char*, ConsumerWaitStrategy>, 4> String_To_Consumer_Wait_Strategy_Pairs{{
+			{ "Sleep", ConsumerWaitStrategy::Sleep },
+			{ "Busy_Spin", ConsumerWaitStrategy::Busy_Spin },
+			{ "Spin_Then_Yield", ConsumerWaitStrategy::Spin_Then_Yield },
+			{ "Blocking", ConsumerWaitStrategy::Blocking }
+		}};
+	}
+
+	bool TryParseValue(const std::string& str, ConsumerWaitStrategy& strategy) {
+		return utils::TryParseEnumValue(String_To_Consumer_Wait_Strategy_Pairs, str, strategy);
+	}
+
+	namespace {
+		constexpr auto Sleep_Interval = std::chrono::milliseconds(10);
+		constexpr uint32_t Num_Spins_Before_Yield = 1000;
+		constexpr auto Max_Blocking_Wait_Interval = std::chrono::milliseconds(100);
+
+		class SleepingConsumerWaiter : public ConsumerWaiter {
+		public:
+			void wait(const predicate<>& isReady) override {
+				while (!isReady())
+					std::this_thread::sleep_for(Sleep_Interval);
+			}
+
+			void signal() override
+			{}
+		};
+
+		class BusySpinConsumerWaiter : public ConsumerWaiter {
+		public:
+			void wait(const predicate<>& isReady) override {
+				while (!isReady())
+				{}
+			}
+
+			void signal() override
+			{}
+		};
+
+		class SpinThenYieldConsumerWaiter : public ConsumerWaiter {
+		public:
+			void wait(const predicate<>& isReady) override {
+				for (auto i = 0u; !isReady(); ++i) {
+					if (i >= Num_Spins_Before_Yield)
+						std::this_thread::yield();
+				}
+			}
+
+			void signal() override
+			{}
+		};
+
+		class BlockingConsumerWaiter : public ConsumerWaiter {
+		public:
+			BlockingConsumerWaiter() : m_numWaiters(0)
+			{}
+
+		public:
+			void wait(const predicate<>& isReady) override {
+				if (isReady())
+					return;
+
+				// waiter registration happens-before the predicate is rechecked under the lock, so a signaler that advances a
+				// barrier either makes the predicate pass or observes a nonzero waiter count and acquires the lock to notify
+				std::unique_lock<std::mutex> lock(m_mutex);
+				++m_numWaiters;
+				while (!isReady())
+					m_condition.wait_for(lock, Max_Blocking_Wait_Interval);
+
+				--m_numWaiters;
+			}
+
+			void signal() override {
+				// avoid the lock (and the syscall) when there are no blocked consumers
+				if (0 == m_numWaiters)
+					return;
+
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+				}
+
+				m_condition.notify_all();
+			}
+
+		private:
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+			std::atomic<uint32_t> m_numWaiters;
+		};
+	}
+
+	std::unique_ptr<ConsumerWaiter> CreateConsumerWaiter(ConsumerWaitStrategy strategy) {
+		switch (strategy) {
+		case ConsumerWaitStrategy::Sleep:
+			return std::make_unique<SleepingConsumerWaiter>();
+
+		case ConsumerWaitStrategy::Busy_Spin:
+			return std::make_unique<BusySpinConsumerWaiter>();
+
+		case ConsumerWaitStrategy::Spin_Then_Yield:
+			return std::make_unique<SpinThenYieldConsumerWaiter>();
+
+		case ConsumerWaitStrategy::Blocking:
+			return std::make_unique<BlockingConsumerWaiter>();
+		}
+
+		CATAPULT_THROW_INVALID_ARGUMENT_1("cannot create consumer waiter for unknown strategy", strategy);
+	}
+}}
@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "catapult/functions.h"
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <stdint.h>
+
+namespace catapult { namespace disruptor {
+
+#define CONSUMER_WAIT_STRATEGY_LIST \
+	/* Consumer sleeps for a fixed interval whenever no element is available. */ \
+	ENUM_VALUE(Sleep) \
+	\
+	/* Consumer continuously polls its barrier. */ \
+	ENUM_VALUE(Busy_Spin) \
+	\
+	/* Consumer polls its barrier for a bounded number of iterations and then yields its time slice between polls. */ \
+	ENUM_VALUE(Spin_Then_Yield) \
+	\
+	/* Consumer blocks until it is signaled by a producer or a preceding consumer. */ \
+	ENUM_VALUE(Blocking)
+
+#define ENUM_VALUE(LABEL) LABEL,
+	/// Possible strategies used by consumers waiting for elements.
+	enum class ConsumerWaitStrategy : uint8_t {
+		CONSUMER_WAIT_STRATEGY_LIST
+	};
+#undef ENUM_VALUE
+
+	/// Insertion operator for outputting \a value to \a out.
+	std::ostream& operator<<(std::ostream& out, ConsumerWaitStrategy value);
+
+	/// Tries to parse \a str into a consumer wait \a strategy.
+	bool TryParseValue(const std::string& str, ConsumerWaitStrategy& strategy);
+
+	/// Waits for consumer barriers to advance.
+	class ConsumerWaiter {
+	public:
+		virtual ~ConsumerWaiter() {}
+
+	public:
+		/// Blocks the calling consumer until \a isReady returns \c true.
+		virtual void wait(const predicate<>& isReady) = 0;
+
+		/// Signals all consumers blocked in wait that a barrier has advanced.
+		virtual void signal() = 0;
+	};
+
+	/// Creates a consumer waiter implementing \a strategy.
+	std::unique_ptr<ConsumerWaiter> CreateConsumerWaiter(ConsumerWaitStrategy strategy);
+}}
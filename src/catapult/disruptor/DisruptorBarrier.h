@@ -43,6 +43,11 @@ namespace catapult { namespace disruptor {
 			++m_position;
 		}
 
+		/// Advances the barrier by \a count positions.
+		CATAPULT_INLINE void advance(PositionType count) {
+			m_position += count;
+		}
+
 		/// Returns level of the barrier.
 		CATAPULT_INLINE size_t level() const {
 			return m_level;
@@ -20,6 +20,7 @@
 
 #include "NodeSelector.h"
 #include "catapult/ionet/NodeContainer.h"
+#include <limits>
 #include <random>
 
 namespace catapult { namespace extensions {
@@ -38,6 +39,51 @@ namespace catapult { namespace extensions {
 			};
 		}
 
+		constexpr uint32_t Fast_Round_Trip_Millis = 100;
+		constexpr uint32_t Slow_Round_Trip_Millis = 500;
+		constexpr uint64_t High_Bytes_Per_Second = 1024 * 1024;
+		constexpr uint64_t Low_Bytes_Per_Second = 64 * 1024;
+		constexpr uint64_t Min_Throughput_Sample_Bytes = 64 * 1024;
+		constexpr uint32_t Neutral_Performance_Multiplier = 4;
+
+		uint32_t CalculateConnectionWeight(const ionet::ConnectionState& connectionState) {
+			// return a weight in range of 1..10'000
+			if (0 == connectionState.NumAttempts)
+				return 5'000;
+
+			if (0 == connectionState.NumFailures)
+				return 10'000;
+
+			auto weight = connectionState.NumSuccesses * 10'000 / connectionState.NumAttempts;
+			return std::max<uint32_t>({ 1, weight, 1'000 / connectionState.NumFailures });
+		}
+
+		uint32_t CalculatePerformanceMultiplier(const ionet::ConnectionState& connectionState) {
+			// return a multiplier in range of 1..16 (nodes without measurements are given the neutral multiplier)
+			if (0 == connectionState.NumMeasuredInteractions)
+				return Neutral_Performance_Multiplier;
+
+			auto numRoundTripPoints = 0u;
+			if (connectionState.RoundTripMillis <= Slow_Round_Trip_Millis)
+				numRoundTripPoints += connectionState.RoundTripMillis <= Fast_Round_Trip_Millis ? 2 : 1;
+
+			// score on round trip time alone when no interaction has been large enough to sample throughput
+			if (0 == connectionState.BytesPerSecond)
+				return 1u << (2 * numRoundTripPoints);
+
+			auto numThroughputPoints = 0u;
+			if (connectionState.BytesPerSecond >= Low_Bytes_Per_Second)
+				numThroughputPoints += connectionState.BytesPerSecond >= High_Bytes_Per_Second ? 2 : 1;
+
+			return 1u << (numRoundTripPoints + numThroughputPoints);
+		}
+
+		template<typename T>
+		T Smooth(T value, T measurement) {
+			// each new measurement has a weight of 1/4
+			return static_cast<T>((3 * static_cast<uint64_t>(value) + measurement) / 4);
+		}
+
 		using NodeScorePairs = std::vector<std::pair<ionet::Node, uint32_t>>;
 
 		struct ServiceNodesInfo {
@@ -105,15 +151,35 @@ namespace catapult { namespace extensions {
 	}
 
 	uint32_t CalculateWeight(const ionet::ConnectionState& connectionState) {
-		// return a weight in range of 1..10'000
-		if (0 == connectionState.NumAttempts)
-			return 5'000;
-
-		if (0 == connectionState.NumFailures)
-			return 10'000;
+		// return a weight in range of 1..40'000 (neutral performance leaves the connection weight unchanged)
+		auto performanceMultiplier = CalculatePerformanceMultiplier(connectionState);
+		auto weight = CalculateConnectionWeight(connectionState) * performanceMultiplier / Neutral_Performance_Multiplier;
+		return std::max<uint32_t>(1, weight);
+	}
 
-		auto weight = connectionState.NumSuccesses * 10'000 / connectionState.NumAttempts;
-		return std::max<uint32_t>({ 1, weight, 1'000 / connectionState.NumFailures });
+	void UpdateInteractionMetrics(ionet::ConnectionState& connectionState, const ionet::PacketIoMetrics& metrics) {
+		if (0 == metrics.NumRoundTrips)
+			return;
+
+		// first measurement is used as is, subsequent measurements are smoothed
+		auto roundTripMillis = static_cast<uint32_t>(std::min<uint64_t>(
+				std::numeric_limits<uint32_t>::max(),
+				metrics.TotalRoundTripMillis / metrics.NumRoundTrips));
+		connectionState.RoundTripMillis = 0 == connectionState.NumMeasuredInteractions
+				? roundTripMillis
+				: Smooth(connectionState.RoundTripMillis, roundTripMillis);
+		if (std::numeric_limits<uint32_t>::max() != connectionState.NumMeasuredInteractions)
+			++connectionState.NumMeasuredInteractions;
+
+		// throughput of small interactions (e.g. chain info requests of synced nodes) is dominated by round trip time,
+		// so it is only sampled when enough data (e.g. pulled blocks) is read
+		if (metrics.NumBytesRead < Min_Throughput_Sample_Bytes)
+			return;
+
+		auto bytesPerSecond = std::max<uint64_t>(1, metrics.NumBytesRead * 1000 / std::max<uint64_t>(1, metrics.ElapsedMillis));
+		connectionState.BytesPerSecond = 0 == connectionState.BytesPerSecond
+				? bytesPerSecond
+				: Smooth(connectionState.BytesPerSecond, bytesPerSecond);
 	}
 
 	ionet::NodeSet SelectCandidatesBasedOnWeight(
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/ionet/MeteredPacketIo.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/NodeInfo.h"
 #include "catapult/utils/ArraySet.h"
@@ -83,8 +84,12 @@ namespace catapult { namespace extensions {
 	};
 
 	/// Calculates the weight for \a connectionState.
+	/// \note The weight is based on connection successes and failures and is scaled by the measured interaction performance.
 	uint32_t CalculateWeight(const ionet::ConnectionState& connectionState);
 
+	/// Updates the (smoothed) interaction measurements in \a connectionState with \a metrics.
+	void UpdateInteractionMetrics(ionet::ConnectionState& connectionState, const ionet::PacketIoMetrics& metrics);
+
 	/// Finds at most \a maxCandidates add candidates from container \a candidates given a
 	/// total candidate weight (\a totalCandidateWeight).
 	ionet::NodeSet SelectCandidatesBasedOnWeight(
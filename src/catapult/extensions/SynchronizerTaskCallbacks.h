@@ -19,26 +19,48 @@
 **/
 
 #pragma once
+#include "NodeSelector.h"
 #include "ServiceState.h"
 #include "catapult/chain/RemoteApiForwarder.h"
 #include "catapult/chain/RemoteNodeSynchronizer.h"
 #include "catapult/config/LocalNodeConfiguration.h"
+#include "catapult/ionet/NodeContainer.h"
 #include "catapult/plugins/PluginManager.h"
 
 namespace catapult { namespace extensions {
 
+	/// Creates a consumer that stores interaction measurements in the \a serviceId connection states of \a nodes.
+	inline chain::RemoteApiForwarder::InteractionMetricsConsumer CreateInteractionMetricsConsumer(
+			ionet::NodeContainer& nodes,
+			ionet::ServiceIdentifier serviceId) {
+		return [&nodes, serviceId](const auto& node, const auto& metrics) {
+			if (!nodes.view().contains(node.identityKey()))
+				return;
+
+			auto modifier = nodes.modifier();
+			UpdateInteractionMetrics(modifier.provisionConnectionState(serviceId, node.identityKey()), metrics);
+		};
+	}
+
 	/// Creates a synchronizer task callback for \a synchronizer named \a taskName that does not require the local chain to be synced.
 	/// \a packetIoPicker is used to select peers and \a remoteApiFactory wraps an api around peers.
-	/// \a state provides additional service information.
+	/// \a state provides additional service information and interaction measurements are stored in its \a serviceId connection states.
 	template<typename TRemoteApi, typename TRemoteApiFactory>
 	thread::TaskCallback CreateSynchronizerTaskCallback(
 			chain::RemoteNodeSynchronizer<TRemoteApi>&& synchronizer,
 			TRemoteApiFactory remoteApiFactory,
 			net::PacketIoPicker& packetIoPicker,
+			ionet::ServiceIdentifier serviceId,
 			const extensions::ServiceState& state,
 			const std::string& taskName) {
 		auto syncTimeout = state.config().Node.SyncTimeout;
-		chain:: RemoteApiForwarder forwarder(packetIoPicker, state.pluginManager().transactionRegistry(), syncTimeout, taskName);
+		auto metricsConsumer = CreateInteractionMetricsConsumer(state.nodes(), serviceId);
+		chain::RemoteApiForwarder forwarder(
+				packetIoPicker,
+				state.pluginManager().transactionRegistry(),
+				syncTimeout,
+				taskName,
+				metricsConsumer);
 		return [forwarder, synchronizer, remoteApiFactory]() {
 			return forwarder.processSync(synchronizer, remoteApiFactory).then([](auto&&) { return thread::TaskResult::Continue; });
 		};
@@ -46,16 +68,23 @@ namespace catapult { namespace extensions {
 
 	/// Creates a synchronizer task callback for \a synchronizer named \a taskName that requires the local chain to be synced.
 	/// \a packetIoPicker is used to select peers and \a remoteApiFactory wraps an api around peers.
-	/// \a state provides additional service information.
+	/// \a state provides additional service information and interaction measurements are stored in its \a serviceId connection states.
 	template<typename TRemoteApi, typename TRemoteApiFactory>
 	thread::TaskCallback CreateChainSyncAwareSynchronizerTaskCallback(
 			chain::RemoteNodeSynchronizer<TRemoteApi>&& synchronizer,
 			TRemoteApiFactory remoteApiFactory,
 			net::PacketIoPicker& packetIoPicker,
+			ionet::ServiceIdentifier serviceId,
 			const extensions::ServiceState& state,
 			const std::string& taskName) {
 		const auto& chainSynced = state.hooks().chainSyncedPredicate();
-		auto synchronize = CreateSynchronizerTaskCallback(std::move(synchronizer), remoteApiFactory, packetIoPicker, state, taskName);
+		auto synchronize = CreateSynchronizerTaskCallback(
+				std::move(synchronizer),
+				remoteApiFactory,
+				packetIoPicker,
+				serviceId,
+				state,
+				taskName);
 		return [chainSynced, synchronize]() {
 			if (!chainSynced())
 				return thread::make_ready_future(thread::TaskResult::Continue);
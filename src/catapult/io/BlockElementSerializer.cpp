@@ -0,0 +1,65 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "BlockElementSerializer.h"
+#include "catapult/utils/MemoryUtils.h"
+
+namespace catapult { namespace io {
+
+	namespace {
+		uint32_t PeekSize(RawFile& blockFile) {
+			auto position = blockFile.position();
+			auto size = Read32(blockFile);
+			blockFile.seek(position);
+			return size;
+		}
+	}
+
+	std::shared_ptr<model::Block> ReadBlock(RawFile& blockFile) {
+		auto size = PeekSize(blockFile);
+
+		auto pBlock = utils::MakeSharedWithSize<model::Block>(size);
+		blockFile.read({ reinterpret_cast<uint8_t*>(pBlock.get()), size });
+		return pBlock;
+	}
+
+	std::shared_ptr<model::BlockElement> ReadBlockElement(RawFile& blockFile) {
+		auto size = PeekSize(blockFile);
+
+		// allocate memory for both the element and the block in one shot (Block data is appended)
+		auto pData = utils::MakeUniqueWithSize<uint8_t>(sizeof(model::BlockElement) + size);
+
+		// read the block data
+		auto pBlockData = pData.get() + sizeof(model::BlockElement);
+		blockFile.read({ pBlockData, size });
+
+		// create the block element and transfer ownership from pData to pBlockElement
+		auto pBlockElementRaw = new (pData.get()) model::BlockElement(*reinterpret_cast<model::Block*>(pBlockData));
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(pBlockElementRaw);
+		pData.release();
+
+		// read metadata
+		blockFile.read(pBlockElement->EntityHash);
+		blockFile.read(pBlockElement->GenerationHash);
+		ReadTransactionHashes(blockFile, *pBlockElement);
+		return pBlockElement;
+	}
+}}
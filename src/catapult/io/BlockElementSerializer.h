@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "PodIoUtils.h"
+#include "RawFile.h"
+#include "catapult/model/Elements.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace io {
+
+	/// Writes \a blockElement into \a output.
+	/// \note The block is followed by its entity hash, generation hash and all transaction hashes.
+	template<typename TOutput>
+	void WriteBlockElement(TOutput& output, const model::BlockElement& blockElement) {
+		output.write({ reinterpret_cast<const uint8_t*>(&blockElement.Block), blockElement.Block.Size });
+		output.write(blockElement.EntityHash);
+		output.write(blockElement.GenerationHash);
+
+		// we should probably save it in a separate file, but temporarily we can just store it here.
+		auto transactionsCount = static_cast<uint32_t>(blockElement.Transactions.size());
+		Write32(output, transactionsCount);
+		std::vector<Hash256> hashes(2 * transactionsCount);
+		auto iter = hashes.begin();
+		for (const auto& transactionElement : blockElement.Transactions) {
+			*iter++ = transactionElement.EntityHash;
+			*iter++ = transactionElement.MerkleComponentHash;
+		}
+
+		output.write({ reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+	}
+
+	/// Reads transaction hashes from \a input into the transaction elements of \a blockElement.
+	template<typename TInput>
+	void ReadTransactionHashes(TInput& input, model::BlockElement& blockElement) {
+		auto numTransactions = Read32(input);
+		std::vector<Hash256> hashes(2 * numTransactions);
+		input.read({ reinterpret_cast<uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+
+		size_t i = 0;
+		for (const auto& transaction : blockElement.Block.Transactions()) {
+			blockElement.Transactions.push_back(model::TransactionElement(transaction));
+			blockElement.Transactions.back().EntityHash = hashes[i++];
+			blockElement.Transactions.back().MerkleComponentHash = hashes[i++];
+		}
+	}
+
+	/// Reads a block from the current position of \a blockFile.
+	std::shared_ptr<model::Block> ReadBlock(RawFile& blockFile);
+
+	/// Reads a block element (including transaction hashes) from the current position of \a blockFile.
+	std::shared_ptr<model::BlockElement> ReadBlockElement(RawFile& blockFile);
+}}
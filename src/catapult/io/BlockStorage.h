@@ -28,6 +28,8 @@
 namespace catapult { namespace io {
 
 	/// A light interface for block storage (does not allow block loading).
+	/// \note Implementations are allowed to defer persisting saved blocks, in which case a failure to persist a block
+	///       is reported by the storage operation that persists it instead of by saveBlock.
 	class LightBlockStorage : public utils::NonCopyable {
 	public:
 		virtual ~LightBlockStorage() {}
@@ -40,6 +42,7 @@ namespace catapult { namespace io {
 		virtual model::HashRange loadHashesFrom(Height height, size_t maxHashes) const = 0;
 
 		/// Saves \a blockElement.
+		/// \note The block is not guaranteed to be persisted when this function returns.
 		virtual void saveBlock(const model::BlockElement& blockElement) = 0;
 
 		/// Drops all blocks after \a height.
@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "BlockStorageLayout.h"
+#include "PodIoUtils.h"
+#include "RawFile.h"
+#include <boost/filesystem.hpp>
+#include <inttypes.h>
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr auto Block_File_Extension = ".dat";
+		static constexpr auto Index_File = "index.dat";
+
+#ifdef _MSC_VER
+#define SPRINTF sprintf_s
+#else
+#define SPRINTF sprintf
+#endif
+
+		boost::filesystem::path GetIndexFilePath(const std::string& baseDirectory) {
+			boost::filesystem::path indexPath = baseDirectory;
+			indexPath /= Index_File;
+			return indexPath;
+		}
+	}
+
+	std::string GetStorageDirectoryPath(const std::string& baseDirectory, Height height) {
+		char subDirectory[16];
+		SPRINTF(subDirectory, "%05" PRId64, height.unwrap() / Files_Per_Directory);
+		boost::filesystem::path path = baseDirectory;
+		path /= subDirectory;
+		if (!boost::filesystem::exists(path))
+			boost::filesystem::create_directory(path);
+
+		return path.generic_string();
+	}
+
+	std::string GetStorageFilePath(const std::string& baseDirectory, Height height, const std::string& filename) {
+		boost::filesystem::path path = GetStorageDirectoryPath(baseDirectory, height);
+		path /= filename;
+		return path.generic_string();
+	}
+
+	std::string GetBlockFilePath(const std::string& baseDirectory, Height height) {
+		char filename[16];
+		SPRINTF(filename, "%05" PRId64, height.unwrap() % Files_Per_Directory);
+		return GetStorageFilePath(baseDirectory, height, std::string(filename) + Block_File_Extension);
+	}
+
+	Height LoadChainHeight(const std::string& baseDirectory) {
+		auto indexPath = GetIndexFilePath(baseDirectory);
+		if (!boost::filesystem::exists(indexPath) || !boost::filesystem::is_regular_file(indexPath))
+			return Height(1);
+
+		RawFile indexFile(indexPath.generic_string(), OpenMode::Read_Only);
+		return Read<Height>(indexFile);
+	}
+
+	void SaveChainHeight(const std::string& baseDirectory, Height height) {
+		RawFile indexFile(GetIndexFilePath(baseDirectory).generic_string(), OpenMode::Read_Write);
+		Write(indexFile, height);
+	}
+}}
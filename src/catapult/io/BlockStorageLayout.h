@@ -0,0 +1,46 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "catapult/types.h"
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Number of heights grouped into a single storage directory.
+	constexpr uint32_t Files_Per_Directory = 65536u;
+
+	/// Gets the path of the storage directory containing data for \a height within \a baseDirectory.
+	/// \note The directory is created if it does not exist.
+	std::string GetStorageDirectoryPath(const std::string& baseDirectory, Height height);
+
+	/// Gets the path of the file named \a filename in the storage directory containing data for \a height within \a baseDirectory.
+	std::string GetStorageFilePath(const std::string& baseDirectory, Height height, const std::string& filename);
+
+	/// Gets the path of the file containing the single block at \a height within \a baseDirectory.
+	std::string GetBlockFilePath(const std::string& baseDirectory, Height height);
+
+	/// Loads the chain height from the index file within \a baseDirectory.
+	Height LoadChainHeight(const std::string& baseDirectory);
+
+	/// Saves \a height as the chain height to the index file within \a baseDirectory.
+	void SaveChainHeight(const std::string& baseDirectory, Height height);
+}}
@@ -0,0 +1,62 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Stream.h"
+#include <vector>
+
+namespace catapult { namespace io {
+
+	/// Input stream that reads from an in-memory buffer.
+	class BufferInputStreamAdapter final : public InputStream {
+	public:
+		/// Creates an input stream around \a buffer.
+		explicit BufferInputStreamAdapter(const std::vector<uint8_t>& buffer);
+
+	public:
+		void read(const MutableRawBuffer& buffer) override;
+
+	public:
+		/// Returns the read position.
+		size_t position() const;
+
+		/// Returns \c true if all data has been read.
+		bool eof() const;
+
+	private:
+		const std::vector<uint8_t>& m_buffer;
+		size_t m_position;
+	};
+
+	/// Output stream that appends to an in-memory buffer.
+	class BufferOutputStreamAdapter final : public OutputStream {
+	public:
+		/// Creates an output stream around \a buffer.
+		explicit BufferOutputStreamAdapter(std::vector<uint8_t>& buffer);
+
+	public:
+		void write(const RawBuffer& buffer) override;
+
+		void flush() override;
+
+	private:
+		std::vector<uint8_t>& m_buffer;
+	};
+}}
@@ -18,14 +18,14 @@
 *** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
 **/
 
+
 #include "FileBasedStorage.h"
-#include "PodIoUtils.h"
-#include "RawFile.h"
-#include "catapult/model/Elements.h"
-#include "catapult/utils/MemoryUtils.h"
-#include <boost/filesystem/path.hpp>
+#include "BlockElementSerializer.h"
+#include "BlockStorageLayout.h"
 #include <boost/filesystem.hpp>
-#include <inttypes.h>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
 
 using catapult::model::Block;
 using catapult::model::BlockElement;
@@ -33,204 +33,160 @@ using catapult::model::BlockElement;
 namespace catapult { namespace io {
 
 	namespace {
-		static constexpr uint64_t Unset_Directory_Id = std::numeric_limits<uint64_t>::max();
-		static constexpr uint32_t Files_Per_Directory = 65536u;
-		static constexpr auto Block_File_Extension = ".dat";
-		static constexpr auto Index_File = "index.dat";
-
-#ifdef _MSC_VER
-#define SPRINTF sprintf_s
-#else
-#define SPRINTF sprintf
-#endif
-		boost::filesystem::path GetDirectoryPath(const std::string& baseDirectory, Height height) {
-			char subDirectory[16];
-			SPRINTF(subDirectory, "%05" PRId64, height.unwrap() / Files_Per_Directory);
-			boost::filesystem::path path = baseDirectory;
-			path /= subDirectory;
-			if (!boost::filesystem::exists(path))
-				boost::filesystem::create_directory(path);
-
-			return path;
-		}
-
-		boost::filesystem::path GetBlockPath(const std::string& baseDirectory, Height height) {
-			auto path = GetDirectoryPath(baseDirectory, height);
-			char filename[16];
-			SPRINTF(filename, "%05" PRId64, height.unwrap() % Files_Per_Directory);
-			path /= filename;
-			path += Block_File_Extension;
-			return path;
-		}
-
-		boost::filesystem::path GetHashFilePath(const std::string& baseDirectory, Height height) {
-			auto path = GetDirectoryPath(baseDirectory, height);
-			path /= "hashes.dat";
-			return path;
-		}
-
 		auto OpenBlockFile(const std::string& baseDirectory, Height height, OpenMode mode = OpenMode::Read_Only) {
-			auto blockPath = GetBlockPath(baseDirectory, height);
-			return std::make_unique<RawFile>(blockPath.generic_string().c_str(), mode);
-		}
-
-		bool HasJournal(const std::string& baseDirectory) {
-			boost::filesystem::path journalPath = baseDirectory;
-			journalPath /= Index_File;
-
-			return boost::filesystem::exists(journalPath) && boost::filesystem::is_regular_file(journalPath);
-		}
-
-		auto OpenJournalFile(const std::string& baseDirectory, OpenMode mode = OpenMode::Read_Only) {
-			boost::filesystem::path journalPath = baseDirectory;
-			journalPath /= Index_File;
-			return std::make_unique<RawFile>(journalPath.generic_string().c_str(), mode);
+			return std::make_unique<RawFile>(GetBlockFilePath(baseDirectory, height), mode);
 		}
 
 		// note: DeleteBlockFile returns false when attempting to delete nonexistent file.
 		bool DeleteBlockFile(const std::string& baseDirectory, Height height) {
-			auto blockPath = GetBlockPath(baseDirectory, height);
-			return boost::filesystem::remove(blockPath);
+			return boost::filesystem::remove(GetBlockFilePath(baseDirectory, height));
 		}
 	}
 
-	FileBasedStorage::HashFile::HashFile(const std::string& dataDirectory)
-			: m_dataDirectory(dataDirectory)
-			, m_cachedDirectoryId(Unset_Directory_Id)
-	{}
-
-	namespace {
-		std::unique_ptr<RawFile> OpenHashFile(const std::string& baseDirectory, Height height, io::OpenMode openMode) {
-			auto hashFilePath = GetHashFilePath(baseDirectory, height);
-			auto pHashFile = std::make_unique<RawFile>(hashFilePath.generic_string().c_str(), openMode, LockMode::None);
-			// check that first hash file has at least two hashes inside.
-			if (height.unwrap() < Files_Per_Directory && Hash256_Size * 2 > pHashFile->size())
-				CATAPULT_THROW_RUNTIME_ERROR_1("hashes.dat has invalid size", pHashFile->size());
-
-			return pHashFile;
-		}
-
-		void SeekHashFile(RawFile& hashFile, Height height) {
-			auto index = height.unwrap() % Files_Per_Directory;
-			hashFile.seek(index * Hash256_Size);
-		}
-	}
-
-	model::HashRange FileBasedStorage::HashFile::loadHashesFrom(Height height, size_t numHashes) const {
-		uint8_t* pData = nullptr;
-		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
-
-		while (numHashes) {
-			auto pHashFile = OpenHashFile(m_dataDirectory, height, OpenMode::Read_Only);
-			SeekHashFile(*pHashFile, height);
-
-			auto count = Files_Per_Directory - (height.unwrap() % Files_Per_Directory);
-			count = std::min<size_t>(numHashes, count);
-
-			pHashFile->read(MutableRawBuffer(pData, count * Hash256_Size));
-
-			pData += count * Hash256_Size;
-			numHashes -= count;
-			height = height + Height(count);
-		}
-
-		return range;
-	}
-
-	void FileBasedStorage::HashFile::save(Height height, const Hash256& hash) {
-		auto currentId = height.unwrap() / Files_Per_Directory;
-		if (m_cachedDirectoryId != currentId) {
-			m_pCachedHashFile = OpenHashFile(m_dataDirectory, height, OpenMode::Read_Append);
-			m_cachedDirectoryId = currentId;
-		}
-
-		SeekHashFile(*m_pCachedHashFile, height);
-		m_pCachedHashFile->write(hash);
-	}
-
-	FileBasedStorage::FileBasedStorage(const std::string& dataDirectory)
+	FileBasedStorage::FileBasedStorage(const std::string& dataDirectory, BlockReadMode readMode)
 			: m_dataDirectory(dataDirectory)
+			, m_readMode(readMode)
 			, m_hashFile(m_dataDirectory)
+			, m_lastLoadedHeight(0)
 	{}
 
-	namespace {
-		void SetHeight(const std::string& baseDirectory, Height height) {
-			auto pJournalFile = OpenJournalFile(baseDirectory, OpenMode::Read_Write);
-			Write(*pJournalFile, height);
-		}
-	}
-
 	Height FileBasedStorage::chainHeight() const {
-		if (!HasJournal(m_dataDirectory))
-			return Height(1);
-
-		auto pJournalFile = OpenJournalFile(m_dataDirectory);
-		return Read<Height>(*pJournalFile);
+		return LoadChainHeight(m_dataDirectory);
 	}
 
 	namespace {
-		std::shared_ptr<Block> ReadBlock(RawFile& blockFile) {
-			auto size = Read32(blockFile);
-			blockFile.seek(0);
-
-			auto pBlock = utils::MakeSharedWithSize<Block>(size);
-			blockFile.read({ reinterpret_cast<uint8_t*>(pBlock.get()), size });
-			return pBlock;
+		using MappedRegion = boost::interprocess::mapped_region;
+
+		std::shared_ptr<const MappedRegion> MapBlockFile(const std::string& baseDirectory, Height height) {
+			auto blockPath = GetBlockFilePath(baseDirectory, height);
+			try {
+				boost::interprocess::file_mapping mapping(blockPath.c_str(), boost::interprocess::read_only);
+				auto pRegion = std::make_shared<MappedRegion>(mapping, boost::interprocess::read_only);
+
+				// the whole block file is always consumed, so schedule all pages to be read at once
+				pRegion->advise(MappedRegion::advice_willneed);
+				return pRegion;
+			} catch (const boost::interprocess::interprocess_exception& ex) {
+				CATAPULT_LOG(error) << "couldn't map block file " << blockPath << ": " << ex.what();
+				CATAPULT_THROW_FILE_IO_ERROR("couldn't map block file");
+			}
 		}
 
-		std::shared_ptr<model::BlockElement> ReadBlockElement(RawFile& blockFile) {
-			auto size = Read32(blockFile);
-			blockFile.seek(0);
-
-			// allocate memory for both the element and the block in one shot (Block data is appended)
-			auto pData = utils::MakeUniqueWithSize<uint8_t>(sizeof(BlockElement) + size);
+		void PrefetchBlockFile(const std::string& baseDirectory, Height height) {
+			// mapping the file schedules its pages to be read; the pages remain in the page cache after the file is unmapped
+			try {
+				MapBlockFile(baseDirectory, height);
+			} catch (const catapult_file_io_error&) {
+				// prefetching is only a hint, so failures can be ignored
+			}
+		}
 
-			// read the block data
-			auto pBlockData = pData.get() + sizeof(BlockElement);
-			blockFile.read({ pBlockData, size });
+		// reads data from a mapped block file with the same semantics as RawFile
+		class MappedBlockFileReader {
+		public:
+			explicit MappedBlockFileReader(const MappedRegion& region)
+					: m_pData(static_cast<const uint8_t*>(region.get_address()))
+					, m_size(region.get_size())
+					, m_position(0)
+			{}
 
-			// create the block element and transfer ownership from pData to pBlockElement
-			auto pBlockElementRaw = new (pData.get()) BlockElement(*reinterpret_cast<Block*>(pBlockData));
-			auto pBlockElement = std::shared_ptr<BlockElement>(pBlockElementRaw);
-			pData.release();
+		public:
+			const uint8_t* data() const {
+				return m_pData + m_position;
+			}
 
-			// read metadata
-			blockFile.read(pBlockElement->EntityHash);
-			blockFile.read(pBlockElement->GenerationHash);
-			return pBlockElement;
-		}
+			void skip(size_t numBytes) {
+				requireAvailable(numBytes);
+				m_position += numBytes;
+			}
 
-		void ReadTransactionHashes(RawFile& blockFile, BlockElement& blockElement) {
-			auto numTransactions = Read32(blockFile);
-			std::vector<Hash256> hashes(2 * numTransactions);
-			blockFile.read({ reinterpret_cast<uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+			void read(const MutableRawBuffer& dataBuffer) {
+				requireAvailable(dataBuffer.Size);
+				std::memcpy(dataBuffer.pData, data(), dataBuffer.Size);
+				m_position += dataBuffer.Size;
+			}
 
-			size_t i = 0;
-			for (const auto& transaction : blockElement.Block.Transactions()) {
-				blockElement.Transactions.push_back(model::TransactionElement(transaction));
-				blockElement.Transactions.back().EntityHash = hashes[i++];
-				blockElement.Transactions.back().MerkleComponentHash = hashes[i++];
+		private:
+			void requireAvailable(size_t numBytes) const {
+				if (m_size - m_position < numBytes)
+					CATAPULT_THROW_FILE_IO_ERROR("couldn't read from mapped block file");
 			}
-		}
+
+		private:
+			const uint8_t* m_pData;
+			size_t m_size;
+			size_t m_position;
+		};
+
+		const Block& MapBlock(MappedBlockFileReader& reader) {
+			// blocks are never modified after being loaded, so they can point directly into the (read only) mapped region
+			const auto& block = *reinterpret_cast<const Block*>(reader.data());
+			reader.skip(sizeof(uint32_t));
+			reader.skip(block.Size - sizeof(uint32_t));
+			return block;
+		}
+
+		struct MappedBlockElement {
+		public:
+			MappedBlockElement(const std::shared_ptr<const MappedRegion>& pRegion, const Block& block)
+					: pRegion(pRegion)
+					, Element(block)
+			{}
+
+		public:
+			std::shared_ptr<const MappedRegion> pRegion;
+			BlockElement Element;
+		};
 	}
 
 	std::shared_ptr<const model::Block> FileBasedStorage::loadBlock(Height height) const {
-		if (height > chainHeight())
+		auto currentHeight = chainHeight();
+		if (height > currentHeight)
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
+		if (BlockReadMode::Memory_Mapped == m_readMode) {
+			auto pRegion = MapBlockFile(m_dataDirectory, height);
+			prefetchIfSequential(height, currentHeight);
+
+			MappedBlockFileReader reader(*pRegion);
+			const auto& block = MapBlock(reader);
+
+			// the returned block shares ownership of (and keeps alive) the mapped region
+			return std::shared_ptr<const Block>(pRegion, &block);
+		}
+
 		auto pBlockFile = OpenBlockFile(m_dataDirectory, height);
 		return ReadBlock(*pBlockFile);
 	}
 
 	std::shared_ptr<const model::BlockElement> FileBasedStorage::loadBlockElement(Height height) const {
-		if (height > chainHeight())
+		auto currentHeight = chainHeight();
+		if (height > currentHeight)
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
+		if (BlockReadMode::Memory_Mapped == m_readMode) {
+			auto pRegion = MapBlockFile(m_dataDirectory, height);
+			prefetchIfSequential(height, currentHeight);
+
+			MappedBlockFileReader reader(*pRegion);
+			auto pMappedBlockElement = std::make_shared<MappedBlockElement>(pRegion, MapBlock(reader));
+			auto& blockElement = pMappedBlockElement->Element;
+
+			reader.read(blockElement.EntityHash);
+			reader.read(blockElement.GenerationHash);
+			ReadTransactionHashes(reader, blockElement);
+			return std::shared_ptr<const BlockElement>(pMappedBlockElement, &blockElement);
+		}
+
 		auto pBlockFile = OpenBlockFile(m_dataDirectory, height);
-		auto pBlockElement = ReadBlockElement(*pBlockFile);
+		return ReadBlockElement(*pBlockFile);
+	}
 
-		ReadTransactionHashes(*pBlockFile, *pBlockElement);
-		return pBlockElement;
+	void FileBasedStorage::prefetchIfSequential(Height height, Height chainHeight) const {
+		// when the previous block was loaded last, assume a sequential scan and start reading the next block file
+		auto isSequential = height.unwrap() == m_lastLoadedHeight.exchange(height.unwrap()) + 1;
+		if (isSequential && height < chainHeight)
+			PrefetchBlockFile(m_dataDirectory, height + Height(1));
 	}
 
 	model::HashRange FileBasedStorage::loadHashesFrom(Height height, size_t maxHashes) const {
@@ -250,33 +206,23 @@ namespace catapult { namespace io {
 		if (height != currentHeight + Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
 
+		// the existing file could be mapped by outstanding blocks, so unlink it instead of truncating it
+		if (BlockReadMode::Memory_Mapped == m_readMode)
+			DeleteBlockFile(m_dataDirectory, height);
+
 		{
 			auto pBlockFile = OpenBlockFile(m_dataDirectory, height, OpenMode::Read_Write);
-			pBlockFile->write({ reinterpret_cast<const uint8_t*>(&blockElement.Block), blockElement.Block.Size });
-			pBlockFile->write(blockElement.EntityHash);
-			pBlockFile->write(blockElement.GenerationHash);
-
-			// we should probably save it in a separate file, but temporarily we can just store it here.
-			auto transactionsCount = static_cast<uint32_t>(blockElement.Transactions.size());
-			pBlockFile->write({ reinterpret_cast<const uint8_t*>(&transactionsCount), sizeof(uint32_t) });
-			std::vector<Hash256> hashes(2 * transactionsCount);
-			auto iter = hashes.begin();
-			for (const auto& transactionElement : blockElement.Transactions) {
-				*iter++ = transactionElement.EntityHash;
-				*iter++ = transactionElement.MerkleComponentHash;
-			}
-
-			pBlockFile->write({ reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+			WriteBlockElement(*pBlockFile, blockElement);
 		}
 
 		m_hashFile.save(height, blockElement.EntityHash);
 
 		if (height > currentHeight)
-			SetHeight(m_dataDirectory, height);
+			SaveChainHeight(m_dataDirectory, height);
 	}
 
 	void FileBasedStorage::dropBlocksAfter(Height height) {
-		SetHeight(m_dataDirectory, height);
+		SaveChainHeight(m_dataDirectory, height);
 	}
 
 	void FileBasedStorage::pruneBlocksBefore(Height pruneHeight) {
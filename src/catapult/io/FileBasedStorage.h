@@ -20,16 +20,26 @@
 
 #pragma once
 #include "BlockStorage.h"
-#include "RawFile.h"
+#include "HashFile.h"
+#include <atomic>
 #include <string>
 
 namespace catapult { namespace io {
 
+	/// Possible ways of reading blocks from a file-based storage.
+	enum class BlockReadMode {
+		/// Blocks are copied from the block files into newly allocated memory.
+		Buffered,
+
+		/// Blocks are views into memory mapped block files that remain mapped as long as they are referenced.
+		Memory_Mapped
+	};
+
 	/// File-based block storage.
 	class FileBasedStorage final : public PrunableBlockStorage {
 	public:
-		/// Creates a file-based storage, where blocks will be stored inside \a dataDirectory.
-		explicit FileBasedStorage(const std::string& dataDirectory);
+		/// Creates a file-based storage, where blocks will be stored inside \a dataDirectory and read according to \a readMode.
+		explicit FileBasedStorage(const std::string& dataDirectory, BlockReadMode readMode = BlockReadMode::Buffered);
 
 	public:
 		Height chainHeight() const override;
@@ -47,22 +57,14 @@ namespace catapult { namespace io {
 		void pruneBlocksBefore(Height height) override;
 
 	private:
-		class HashFile final {
-		public:
-			explicit HashFile(const std::string& dataDirectory);
-
-			model::HashRange loadHashesFrom(Height height, size_t numHashes) const;
-			void save(Height height, const Hash256& hash);
-
-		private:
-			const std::string& m_dataDirectory;
-
-			// used for caching inside save()
-			uint64_t m_cachedDirectoryId;
-			std::unique_ptr<RawFile> m_pCachedHashFile;
-		};
+		void prefetchIfSequential(Height height, Height chainHeight) const;
 
+	private:
 		std::string m_dataDirectory;
+		BlockReadMode m_readMode;
 		HashFile m_hashFile;
+
+		// used for detecting sequential reads, which prefetch the next block file when memory mapping is enabled
+		mutable std::atomic<uint64_t> m_lastLoadedHeight;
 	};
 }}
@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "HashFile.h"
+#include "BlockStorageLayout.h"
+#include "catapult/exceptions.h"
+#include <limits>
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr uint64_t Unset_Directory_Id = std::numeric_limits<uint64_t>::max();
+		static constexpr auto Hash_File = "hashes.dat";
+
+		std::unique_ptr<RawFile> OpenHashFile(const std::string& baseDirectory, Height height, io::OpenMode openMode) {
+			auto hashFilePath = GetStorageFilePath(baseDirectory, height, Hash_File);
+			auto pHashFile = std::make_unique<RawFile>(hashFilePath, openMode, LockMode::None);
+			// check that first hash file has at least two hashes inside.
+			if (height.unwrap() < Files_Per_Directory && Hash256_Size * 2 > pHashFile->size())
+				CATAPULT_THROW_RUNTIME_ERROR_1("hashes.dat has invalid size", pHashFile->size());
+
+			return pHashFile;
+		}
+
+		void SeekHashFile(RawFile& hashFile, Height height) {
+			auto index = height.unwrap() % Files_Per_Directory;
+			hashFile.seek(index * Hash256_Size);
+		}
+	}
+
+	HashFile::HashFile(const std::string& dataDirectory)
+			: m_dataDirectory(dataDirectory)
+			, m_cachedDirectoryId(Unset_Directory_Id)
+	{}
+
+	model::HashRange HashFile::loadHashesFrom(Height height, size_t numHashes) const {
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+
+		while (numHashes) {
+			auto pHashFile = OpenHashFile(m_dataDirectory, height, OpenMode::Read_Only);
+			SeekHashFile(*pHashFile, height);
+
+			auto count = Files_Per_Directory - (height.unwrap() % Files_Per_Directory);
+			count = std::min<size_t>(numHashes, count);
+
+			pHashFile->read(MutableRawBuffer(pData, count * Hash256_Size));
+
+			pData += count * Hash256_Size;
+			numHashes -= count;
+			height = height + Height(count);
+		}
+
+		return range;
+	}
+
+	void HashFile::save(Height height, const Hash256& hash) {
+		auto currentId = height.unwrap() / Files_Per_Directory;
+		if (m_cachedDirectoryId != currentId) {
+			m_pCachedHashFile = OpenHashFile(m_dataDirectory, height, OpenMode::Read_Append);
+			m_cachedDirectoryId = currentId;
+		}
+
+		SeekHashFile(*m_pCachedHashFile, height);
+		m_pCachedHashFile->write(hash);
+	}
+}}
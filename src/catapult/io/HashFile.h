@@ -0,0 +1,50 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "RawFile.h"
+#include "catapult/model/RangeTypes.h"
+#include <memory>
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Block hashes stored in a hash file within each storage directory.
+	class HashFile final {
+	public:
+		/// Creates hash file storage around \a dataDirectory.
+		explicit HashFile(const std::string& dataDirectory);
+
+	public:
+		/// Loads \a numHashes hashes starting at \a height.
+		model::HashRange loadHashesFrom(Height height, size_t numHashes) const;
+
+		/// Saves \a hash as the hash of the block at \a height.
+		void save(Height height, const Hash256& hash);
+
+	private:
+		std::string m_dataDirectory;
+
+		// used for caching inside save()
+		uint64_t m_cachedDirectoryId;
+		std::unique_ptr<RawFile> m_pCachedHashFile;
+	};
+}}
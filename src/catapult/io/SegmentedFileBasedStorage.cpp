@@ -0,0 +1,265 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "SegmentedFileBasedStorage.h"
+#include "BlockElementSerializer.h"
+#include "BlockStorageLayout.h"
+#include "catapult/exceptions.h"
+#include <boost/filesystem.hpp>
+#include <limits>
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr uint64_t Unset_Segment_Id = std::numeric_limits<uint64_t>::max();
+		static constexpr auto Segment_File = "blocks.dat";
+		static constexpr auto Offsets_File = "offsets.dat";
+
+		uint64_t GetSegmentId(Height height) {
+			return height.unwrap() / Files_Per_Directory;
+		}
+
+		uint64_t GetEntryIndex(Height height) {
+			return height.unwrap() % Files_Per_Directory;
+		}
+
+		template<typename TEntry>
+		void ReadEntry(RawFile& offsetsFile, uint64_t index, TEntry& entry) {
+			offsetsFile.seek(index * sizeof(TEntry));
+			offsetsFile.read({ reinterpret_cast<uint8_t*>(&entry), sizeof(TEntry) });
+		}
+
+		template<typename TEntry>
+		void WriteEntries(RawFile& offsetsFile, uint64_t index, const std::vector<TEntry>& entries) {
+			offsetsFile.seek(index * sizeof(TEntry));
+			offsetsFile.write({ reinterpret_cast<const uint8_t*>(entries.data()), entries.size() * sizeof(TEntry) });
+		}
+	}
+
+	// region SegmentFiles
+
+	SegmentedFileBasedStorage::SegmentFiles::SegmentFiles(const std::string& dataDirectory, OpenMode mode)
+			: m_dataDirectory(dataDirectory)
+			, m_mode(mode)
+			, m_segmentId(Unset_Segment_Id)
+	{}
+
+	RawFile& SegmentedFileBasedStorage::SegmentFiles::open(
+			std::unique_ptr<RawFile>& pFile,
+			Height height,
+			const char* filename,
+			uint64_t minSize) {
+		auto segmentId = GetSegmentId(height);
+		if (m_segmentId != segmentId) {
+			reset();
+			m_segmentId = segmentId;
+		}
+
+		// files opened for reading need to be reopened when they have grown since being opened
+		if (!pFile || pFile->size() < minSize)
+			pFile = std::make_unique<RawFile>(GetStorageFilePath(m_dataDirectory, height, filename), m_mode, LockMode::None);
+
+		return *pFile;
+	}
+
+	RawFile& SegmentedFileBasedStorage::SegmentFiles::openOffsetsFile(Height height, uint64_t minSize) {
+		return open(m_pOffsetsFile, height, Offsets_File, minSize);
+	}
+
+	SegmentedFileBasedStorage::SegmentEntry SegmentedFileBasedStorage::SegmentFiles::loadEntry(Height height) {
+		auto index = GetEntryIndex(height);
+		auto& offsetsFile = openOffsetsFile(height, (index + 1) * sizeof(SegmentEntry));
+		if (offsetsFile.size() < (index + 1) * sizeof(SegmentEntry))
+			CATAPULT_THROW_FILE_IO_ERROR("offsets file does not contain block");
+
+		SegmentEntry entry;
+		ReadEntry(offsetsFile, index, entry);
+
+		// empty entries are written for blocks that are skipped (e.g. pruned before migration)
+		if (0 == entry.Size)
+			CATAPULT_THROW_FILE_IO_ERROR("segment file does not contain block");
+
+		return entry;
+	}
+
+	RawFile& SegmentedFileBasedStorage::SegmentFiles::seekSegmentFile(Height height, const SegmentEntry& entry) {
+		auto& segmentFile = open(m_pSegmentFile, height, Segment_File, entry.Offset + entry.Size);
+		segmentFile.seek(entry.Offset);
+		return segmentFile;
+	}
+
+	void SegmentedFileBasedStorage::SegmentFiles::append(Height height, const consumer<RawFile&>& write) {
+		auto& offsetsFile = openOffsetsFile(height, 0);
+		auto numEntries = offsetsFile.size() / sizeof(SegmentEntry);
+		auto index = GetEntryIndex(height);
+
+		// new block data always starts after the block data of the last preceding entry, which truncates (logically)
+		// any blocks previously stored at greater heights
+		SegmentEntry entry{ 0, 0 };
+		if (0 != index && 0 != numEntries) {
+			SegmentEntry previousEntry;
+			ReadEntry(offsetsFile, std::min<uint64_t>(index, numEntries) - 1, previousEntry);
+			entry.Offset = previousEntry.Offset + previousEntry.Size;
+		}
+
+		auto& segmentFile = open(m_pSegmentFile, height, Segment_File, 0);
+		segmentFile.seek(entry.Offset);
+		write(segmentFile);
+		entry.Size = segmentFile.position() - entry.Offset;
+
+		// fill any gap between the last entry and the new entry with empty entries
+		auto firstIndex = std::min<uint64_t>(index, numEntries);
+		std::vector<SegmentEntry> entries(index - firstIndex, SegmentEntry{ entry.Offset, 0 });
+		entries.push_back(entry);
+		WriteEntries(offsetsFile, firstIndex, entries);
+	}
+
+	void SegmentedFileBasedStorage::SegmentFiles::reset() {
+		m_segmentId = Unset_Segment_Id;
+		m_pSegmentFile.reset();
+		m_pOffsetsFile.reset();
+	}
+
+	// endregion
+
+	// region SegmentedFileBasedStorage
+
+	SegmentedFileBasedStorage::SegmentedFileBasedStorage(const std::string& dataDirectory)
+			: m_dataDirectory(dataDirectory)
+			, m_hashFile(m_dataDirectory)
+			, m_writeFiles(m_dataDirectory, OpenMode::Read_Append)
+			, m_readFiles(m_dataDirectory, OpenMode::Read_Only)
+	{}
+
+	Height SegmentedFileBasedStorage::chainHeight() const {
+		return LoadChainHeight(m_dataDirectory);
+	}
+
+	std::shared_ptr<const model::Block> SegmentedFileBasedStorage::loadBlock(Height height) const {
+		if (height > chainHeight())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
+
+		std::lock_guard<std::mutex> guard(m_readMutex);
+		auto entry = m_readFiles.loadEntry(height);
+		return ReadBlock(m_readFiles.seekSegmentFile(height, entry));
+	}
+
+	std::shared_ptr<const model::BlockElement> SegmentedFileBasedStorage::loadBlockElement(Height height) const {
+		if (height > chainHeight())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
+
+		std::lock_guard<std::mutex> guard(m_readMutex);
+		auto entry = m_readFiles.loadEntry(height);
+		return ReadBlockElement(m_readFiles.seekSegmentFile(height, entry));
+	}
+
+	model::HashRange SegmentedFileBasedStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		auto currentHeight = chainHeight();
+		if (Height(0) == height || currentHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((currentHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+		return m_hashFile.loadHashesFrom(height, numHashes);
+	}
+
+	void SegmentedFileBasedStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto currentHeight = chainHeight();
+		auto height = blockElement.Block.Height;
+
+		if (height != currentHeight + Height(1))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
+
+		m_writeFiles.append(height, [&blockElement](auto& segmentFile) {
+			WriteBlockElement(segmentFile, blockElement);
+		});
+		m_hashFile.save(height, blockElement.EntityHash);
+
+		SaveChainHeight(m_dataDirectory, height);
+	}
+
+	void SegmentedFileBasedStorage::dropBlocksAfter(Height height) {
+		SaveChainHeight(m_dataDirectory, height);
+	}
+
+	void SegmentedFileBasedStorage::pruneBlocksBefore(Height pruneHeight) {
+		auto currentHeight = chainHeight();
+
+		if (pruneHeight > currentHeight)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("prune requested with height", pruneHeight);
+
+		{
+			// close all files because they could belong to pruned segments
+			std::lock_guard<std::mutex> guard(m_readMutex);
+			m_readFiles.reset();
+			m_writeFiles.reset();
+		}
+
+		// only segments that exclusively contain blocks before pruneHeight can be deleted
+		for (auto segmentId = GetSegmentId(pruneHeight); segmentId > 1; --segmentId) {
+			auto segmentHeight = Height((segmentId - 1) * Files_Per_Directory);
+			if (!boost::filesystem::remove(GetStorageFilePath(m_dataDirectory, segmentHeight, Segment_File)))
+				break;
+
+			boost::filesystem::remove(GetStorageFilePath(m_dataDirectory, segmentHeight, Offsets_File));
+		}
+	}
+
+	// endregion
+
+	// region MigrateBlockFiles
+
+	size_t SegmentedFileBasedStorage::MigrateBlockFiles(const std::string& dataDirectory, bool shouldDeleteBlockFiles) {
+		auto chainHeight = LoadChainHeight(dataDirectory);
+		SegmentFiles segmentFiles(dataDirectory, OpenMode::Read_Append);
+
+		// block files are identical to segment file block data, so they can be copied without being parsed
+		size_t numBlocks = 0;
+		std::vector<uint8_t> buffer;
+		for (auto height = Height(1); height <= chainHeight; height = height + Height(1)) {
+			auto blockFilePath = GetBlockFilePath(dataDirectory, height);
+			if (!boost::filesystem::exists(blockFilePath))
+				continue;
+
+			{
+				RawFile blockFile(blockFilePath, OpenMode::Read_Only);
+				buffer.resize(blockFile.size());
+				blockFile.read(buffer);
+			}
+
+			segmentFiles.append(height, [&buffer](auto& segmentFile) {
+				segmentFile.write(buffer);
+			});
+
+			if (0 == ++numBlocks % Files_Per_Directory)
+				CATAPULT_LOG(info) << "migrated blocks up to height " << height;
+		}
+
+		if (shouldDeleteBlockFiles) {
+			for (auto height = Height(1); height <= chainHeight; height = height + Height(1))
+				boost::filesystem::remove(GetBlockFilePath(dataDirectory, height));
+		}
+
+		return numBlocks;
+	}
+
+	// endregion
+}}
@@ -0,0 +1,111 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "BlockStorage.h"
+#include "HashFile.h"
+#include "catapult/functions.h"
+#include <mutex>
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// File-based block storage that appends blocks to one segment file per storage directory.
+	/// \note Each storage directory contains a segment file (blocks.dat) with all of its blocks and
+	///       an offsets file (offsets.dat) with the location of each block within the segment file.
+	///       Block hashes and the chain height are stored in the same files as used by FileBasedStorage.
+	class SegmentedFileBasedStorage final : public PrunableBlockStorage {
+	public:
+		/// Creates a segmented file-based storage, where blocks will be stored inside \a dataDirectory.
+		explicit SegmentedFileBasedStorage(const std::string& dataDirectory);
+
+	public:
+		Height chainHeight() const override;
+
+	public:
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+	public:
+		/// Drops all blocks before \a height.
+		/// \note Only whole segments are dropped and the first segment, which contains the nemesis block, is never dropped.
+		void pruneBlocksBefore(Height height) override;
+
+	public:
+		/// Copies all blocks stored in per-block files in \a dataDirectory (as written by FileBasedStorage) into segment files.
+		/// The per-block files are deleted after all blocks have been copied when \a shouldDeleteBlockFiles is \c true.
+		/// Returns the number of copied blocks.
+		/// \note Blocks that have been pruned are skipped.
+		static size_t MigrateBlockFiles(const std::string& dataDirectory, bool shouldDeleteBlockFiles);
+
+	private:
+		// location of a block within a segment file
+		struct SegmentEntry {
+			uint64_t Offset;
+			uint64_t Size;
+		};
+
+		// segment and offsets files of the most recently accessed segment
+		class SegmentFiles final {
+		public:
+			/// Creates segment files within \a dataDirectory that will be opened with \a mode.
+			SegmentFiles(const std::string& dataDirectory, OpenMode mode);
+
+		public:
+			/// Loads the segment entry for \a height.
+			/// \note Throws when no block is stored at \a height.
+			SegmentEntry loadEntry(Height height);
+
+			/// Opens the segment file containing \a entry for \a height and seeks to the start of the block data.
+			RawFile& seekSegmentFile(Height height, const SegmentEntry& entry);
+
+			/// Appends the block data at \a height after the block data at the previous height by calling \a write.
+			void append(Height height, const consumer<RawFile&>& write);
+
+			/// Closes all open files.
+			void reset();
+
+		private:
+			RawFile& open(std::unique_ptr<RawFile>& pFile, Height height, const char* filename, uint64_t minSize);
+			RawFile& openOffsetsFile(Height height, uint64_t minSize);
+
+		private:
+			std::string m_dataDirectory;
+			OpenMode m_mode;
+			uint64_t m_segmentId;
+			std::unique_ptr<RawFile> m_pSegmentFile;
+			std::unique_ptr<RawFile> m_pOffsetsFile;
+		};
+
+	private:
+		std::string m_dataDirectory;
+		HashFile m_hashFile;
+		SegmentFiles m_writeFiles;
+
+		mutable std::mutex m_readMutex;
+		mutable SegmentFiles m_readFiles;
+	};
+}}
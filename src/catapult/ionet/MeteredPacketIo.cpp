@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MeteredPacketIo.h"
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		template<typename TTimePoint>
+		uint64_t GetElapsedMillis(TTimePoint start, TTimePoint end) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+		}
+	}
+
+	MeteredPacketIo::MeteredPacketIo(const std::shared_ptr<PacketIo>& pIo)
+			: m_pIo(pIo)
+			, m_hasWrite(false)
+			, m_hasPendingRequest(false)
+			, m_metrics()
+	{}
+
+	PacketIoMetrics MeteredPacketIo::metrics() const {
+		utils::SpinLockGuard guard(m_lock);
+		auto metrics = m_metrics;
+		metrics.ElapsedMillis = m_hasWrite && m_lastReadTime > m_firstWriteTime
+				? GetElapsedMillis(m_firstWriteTime, m_lastReadTime)
+				: 0;
+		return metrics;
+	}
+
+	void MeteredPacketIo::read(const ReadCallback& callback) {
+		m_pIo->read([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+			if (SocketOperationCode::Success == code && pPacket)
+				pThis->onRead(pPacket);
+
+			callback(code, pPacket);
+		});
+	}
+
+	void MeteredPacketIo::write(const PacketPayload& payload, const WriteCallback& callback) {
+		{
+			utils::SpinLockGuard guard(m_lock);
+			auto now = Clock::now();
+			if (!m_hasWrite) {
+				m_hasWrite = true;
+				m_firstWriteTime = now;
+			}
+
+			// only the first write of a request starts a round trip
+			if (!m_hasPendingRequest) {
+				m_hasPendingRequest = true;
+				m_requestTime = now;
+			}
+		}
+
+		m_pIo->write(payload, callback);
+	}
+
+	void MeteredPacketIo::onRead(const Packet* pPacket) {
+		utils::SpinLockGuard guard(m_lock);
+		m_lastReadTime = Clock::now();
+		m_metrics.NumBytesRead += pPacket->Size;
+
+		// only the first read of a response completes a round trip
+		if (!m_hasPendingRequest)
+			return;
+
+		m_hasPendingRequest = false;
+		++m_metrics.NumRoundTrips;
+		m_metrics.TotalRoundTripMillis += GetElapsedMillis(m_requestTime, m_lastReadTime);
+	}
+}}
@@ -0,0 +1,77 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketIo.h"
+#include "catapult/utils/SpinLock.h"
+#include <chrono>
+
+namespace catapult { namespace ionet {
+
+	/// Interaction measurements collected by a metered packet io.
+	struct PacketIoMetrics {
+		/// Number of completed request / response round trips.
+		uint32_t NumRoundTrips;
+
+		/// Total time spent waiting for responses (in milliseconds).
+		uint64_t TotalRoundTripMillis;
+
+		/// Total number of bytes read.
+		uint64_t NumBytesRead;
+
+		/// Time elapsed between the first write and the last read (in milliseconds).
+		uint64_t ElapsedMillis;
+	};
+
+	/// Packet io decorator that measures the round trip latency and read throughput of the decorated packet io.
+	/// \note A round trip starts with the first write following a read and ends with the next successful read.
+	class MeteredPacketIo
+			: public PacketIo
+			, public std::enable_shared_from_this<MeteredPacketIo> {
+	private:
+		using Clock = std::chrono::steady_clock;
+
+	public:
+		/// Creates a metered packet io around \a pIo.
+		explicit MeteredPacketIo(const std::shared_ptr<PacketIo>& pIo);
+
+	public:
+		/// Gets the current measurements.
+		PacketIoMetrics metrics() const;
+
+	public:
+		void read(const ReadCallback& callback) override;
+
+		void write(const PacketPayload& payload, const WriteCallback& callback) override;
+
+	private:
+		void onRead(const Packet* pPacket);
+
+	private:
+		std::shared_ptr<PacketIo> m_pIo;
+		bool m_hasWrite;
+		bool m_hasPendingRequest;
+		Clock::time_point m_firstWriteTime;
+		Clock::time_point m_requestTime;
+		Clock::time_point m_lastReadTime;
+		PacketIoMetrics m_metrics;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -59,6 +59,9 @@ namespace catapult { namespace ionet {
 				, NumAttempts(0)
 				, NumSuccesses(0)
 				, NumFailures(0)
+				, NumMeasuredInteractions(0)
+				, RoundTripMillis(0)
+				, BytesPerSecond(0)
 		{}
 
 	public:
@@ -74,6 +77,16 @@ namespace catapult { namespace ionet {
 
 		/// Number of failed connections.
 		uint32_t NumFailures;
+
+		/// Number of measured interactions.
+		uint32_t NumMeasuredInteractions;
+
+		/// Smoothed round trip time of interactions (in milliseconds).
+		uint32_t RoundTripMillis;
+
+		/// Smoothed read throughput of interactions (in bytes per second).
+		/// \c 0 if no interaction has been large enough to be sampled.
+		uint64_t BytesPerSecond;
 	};
 
 	/// Information about a node and its interactions.
@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ExtractedAddressesCache.h"
+#include "TransactionUtils.h"
+#include <chrono>
+
+namespace catapult { namespace model {
+
+	ExtractedAddressesCache::ExtractedAddressesCache(const NotificationPublisher& notificationPublisher, size_t maxSize)
+			: m_notificationPublisher(notificationPublisher)
+			, m_maxSize(maxSize)
+			, m_nextInsertionId(0)
+	{}
+
+	size_t ExtractedAddressesCache::size() const {
+		utils::SpinLockGuard guard(m_lock);
+		return m_entries.size();
+	}
+
+	const ExtractedAddressesCacheStatistics& ExtractedAddressesCache::statistics() const {
+		return m_statistics;
+	}
+
+	std::shared_ptr<AddressSet> ExtractedAddressesCache::extract(const Transaction& transaction, const Hash256& hash) {
+		auto pAddresses = find(hash, false);
+		if (pAddresses)
+			return pAddresses;
+
+		pAddresses = extractUncached(transaction);
+		insert(hash, pAddresses);
+		return pAddresses;
+	}
+
+	std::shared_ptr<AddressSet> ExtractedAddressesCache::extractAndRemove(const Transaction& transaction, const Hash256& hash) {
+		auto pAddresses = find(hash, true);
+		return pAddresses ? pAddresses : extractUncached(transaction);
+	}
+
+	std::shared_ptr<AddressSet> ExtractedAddressesCache::find(const Hash256& hash, bool shouldRemove) {
+		std::shared_ptr<AddressSet> pAddresses;
+		{
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_entries.find(hash);
+			if (m_entries.cend() != iter) {
+				pAddresses = iter->second.pAddresses;
+
+				// the stale insertion order entry is ignored when it is evicted
+				if (shouldRemove)
+					m_entries.erase(iter);
+			}
+		}
+
+		++(pAddresses ? m_statistics.NumHits : m_statistics.NumMisses);
+		return pAddresses;
+	}
+
+	std::shared_ptr<AddressSet> ExtractedAddressesCache::extractUncached(const Transaction& transaction) {
+		auto startTime = std::chrono::steady_clock::now();
+		auto pAddresses = std::make_shared<AddressSet>(ExtractAddresses(transaction, m_notificationPublisher));
+
+		auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+		m_statistics.ExtractionMicros += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime).count());
+		return pAddresses;
+	}
+
+	void ExtractedAddressesCache::insert(const Hash256& hash, const std::shared_ptr<AddressSet>& pAddresses) {
+		if (0 == m_maxSize)
+			return;
+
+		utils::SpinLockGuard guard(m_lock);
+		auto insertionId = m_nextInsertionId++;
+		if (!m_entries.emplace(hash, CacheEntry{ pAddresses, insertionId }).second)
+			return;
+
+		m_insertionOrder.emplace_back(hash, insertionId);
+
+		// evict the oldest insertions, skipping entries that have already been removed (or removed and reinserted)
+		while (m_insertionOrder.size() > m_maxSize) {
+			const auto& oldest = m_insertionOrder.front();
+			auto iter = m_entries.find(oldest.first);
+			if (m_entries.cend() != iter && oldest.second == iter->second.InsertionId)
+				m_entries.erase(iter);
+
+			m_insertionOrder.pop_front();
+		}
+	}
+}}
@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ContainerTypes.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace catapult {
+	namespace model {
+		class NotificationPublisher;
+		struct Transaction;
+	}
+}
+
+namespace catapult { namespace model {
+
+	/// Statistics about address extractions performed by an extracted addresses cache.
+	struct ExtractedAddressesCacheStatistics {
+	public:
+		/// Creates zeroed statistics.
+		ExtractedAddressesCacheStatistics()
+				: NumHits(0)
+				, NumMisses(0)
+				, ExtractionMicros(0)
+		{}
+
+	public:
+		/// Number of lookups that were satisfied by cached addresses.
+		std::atomic<uint64_t> NumHits;
+
+		/// Number of lookups that required addresses to be extracted.
+		std::atomic<uint64_t> NumMisses;
+
+		/// Total number of microseconds spent extracting addresses.
+		std::atomic<uint64_t> ExtractionMicros;
+	};
+
+	/// Bounded cache of the addresses involved in transactions keyed by transaction merkle component hash.
+	/// \note Returned address sets are shared and must not be modified.
+	/// \note Entity hashes must not be used as keys because they do not cover aggregate cosigners, which are involved addresses.
+	class ExtractedAddressesCache {
+	public:
+		/// Creates a cache around \a notificationPublisher that holds the addresses of at most \a maxSize transactions.
+		ExtractedAddressesCache(const NotificationPublisher& notificationPublisher, size_t maxSize);
+
+	public:
+		/// Gets the number of transactions with cached addresses.
+		size_t size() const;
+
+		/// Gets the extraction statistics.
+		const ExtractedAddressesCacheStatistics& statistics() const;
+
+	public:
+		/// Gets the addresses involved in \a transaction with merkle component \a hash and caches them for subsequent lookups.
+		std::shared_ptr<AddressSet> extract(const Transaction& transaction, const Hash256& hash);
+
+		/// Gets the addresses involved in \a transaction with merkle component \a hash and removes them from the cache.
+		/// \note This is intended for confirmed transactions that are unlikely to be seen again.
+		std::shared_ptr<AddressSet> extractAndRemove(const Transaction& transaction, const Hash256& hash);
+
+	private:
+		std::shared_ptr<AddressSet> find(const Hash256& hash, bool shouldRemove);
+
+		std::shared_ptr<AddressSet> extractUncached(const Transaction& transaction);
+
+		void insert(const Hash256& hash, const std::shared_ptr<AddressSet>& pAddresses);
+
+	private:
+		struct CacheEntry {
+			std::shared_ptr<AddressSet> pAddresses;
+			uint64_t InsertionId;
+		};
+
+	private:
+		const NotificationPublisher& m_notificationPublisher;
+		size_t m_maxSize;
+		uint64_t m_nextInsertionId;
+		std::unordered_map<Hash256, CacheEntry, utils::ArrayHasher<Hash256>> m_entries;
+		std::deque<std::pair<Hash256, uint64_t>> m_insertionOrder;
+		ExtractedAddressesCacheStatistics m_statistics;
+		mutable utils::SpinLock m_lock;
+	};
+}}
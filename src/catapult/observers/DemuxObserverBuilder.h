@@ -19,41 +19,43 @@
 **/
 
 #pragma once
-#include "AggregateObserverBuilder.h"
 #include "ObserverTypes.h"
-#include <functional>
+#include "catapult/utils/NamedObject.h"
+#include <unordered_map>
 #include <vector>
 
 namespace catapult { namespace observers {
 
 	/// A demultiplexing observer builder.
+	/// \note The built observer dispatches each notification only to the observers registered for its type
+	///        (ignoring channel) and to the observers registered for all notifications.
 	class DemuxObserverBuilder {
 	private:
-		using NotificationObserverPredicate = predicate<const model::Notification&>;
+		struct ObserverEntry {
+			NotificationObserverPointerT<model::Notification> pObserver;
+			bool IsTyped;
+			model::NotificationType Type;
+		};
 
 	public:
 		/// Adds an observer (\a pObserver) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxObserverBuilder& add(NotificationObserverPointerT<TNotification>&& pObserver) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalObserver<TNotification>>(std::move(pObserver), predicate));
+			auto pTypedObserver = std::make_unique<TypedObserver<TNotification>>(std::move(pObserver));
+			m_entries.push_back({ std::move(pTypedObserver), true, TNotification::Notification_Type });
 			return *this;
 		}
 
 		/// Builds a demultiplexing observer.
 		AggregateNotificationObserverPointerT<model::Notification> build() {
-			return m_builder.build();
+			return std::make_unique<DemuxAggregateNotificationObserver>(std::move(m_entries));
 		}
 
 	private:
 		template<typename TNotification>
-		class ConditionalObserver : public NotificationObserver {
+		class TypedObserver : public NotificationObserver {
 		public:
-			ConditionalObserver(NotificationObserverPointerT<TNotification>&& pObserver, const NotificationObserverPredicate& predicate)
-					: m_pObserver(std::move(pObserver))
-					, m_predicate(predicate)
+			explicit TypedObserver(NotificationObserverPointerT<TNotification>&& pObserver) : m_pObserver(std::move(pObserver))
 			{}
 
 		public:
@@ -62,26 +64,88 @@ namespace catapult { namespace observers {
 			}
 
 			void notify(const model::Notification& notification, const ObserverContext& context) const override {
-				if (!m_predicate(notification))
-					return;
-
 				m_pObserver->notify(static_cast<const TNotification&>(notification), context);
 			}
 
 		private:
 			NotificationObserverPointerT<TNotification> m_pObserver;
-			NotificationObserverPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationObserver : public AggregateNotificationObserver {
+		private:
+			using ObserverPointers = std::vector<const NotificationObserver*>;
+
+		public:
+			explicit DemuxAggregateNotificationObserver(std::vector<ObserverEntry>&& entries) {
+				// 1. collect all notification types with typed observers
+				for (const auto& entry : entries) {
+					if (entry.IsTyped)
+						m_observersByType.emplace(ToTypeKey(entry.Type), ObserverPointers());
+				}
+
+				// 2. build dispatch lists for all types (and for unknown types) preserving registration order
+				for (auto& entry : entries) {
+					if (entry.IsTyped) {
+						m_observersByType.find(ToTypeKey(entry.Type))->second.push_back(entry.pObserver.get());
+					} else {
+						m_untypedObservers.push_back(entry.pObserver.get());
+						for (auto& pair : m_observersByType)
+							pair.second.push_back(entry.pObserver.get());
+					}
+
+					m_observers.push_back(std::move(entry.pObserver));
+				}
+
+				m_name = utils::ReduceNames(utils::ExtractNames(m_observers));
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_observers);
+			}
+
+			void notify(const model::Notification& notification, const ObserverContext& context) const override {
+				auto iter = m_observersByType.find(ToTypeKey(notification.Type));
+				const auto& observers = m_observersByType.cend() == iter ? m_untypedObservers : iter->second;
+
+				if (NotifyMode::Commit == context.Mode)
+					notifyAll(observers.cbegin(), observers.cend(), notification, context);
+				else
+					notifyAll(observers.crbegin(), observers.crend(), notification, context);
+			}
+
+		private:
+			template<typename TIter>
+			void notifyAll(TIter begin, TIter end, const model::Notification& notification, const ObserverContext& context) const {
+				for (auto iter = begin; end != iter; ++iter)
+					(*iter)->notify(notification, context);
+			}
+
+			static uint32_t ToTypeKey(model::NotificationType type) {
+				model::SetNotificationChannel(type, model::NotificationChannel::None);
+				return utils::to_underlying_type(type);
+			}
+
+		private:
+			std::vector<NotificationObserverPointerT<model::Notification>> m_observers;
+			ObserverPointers m_untypedObservers;
+			std::unordered_map<uint32_t, ObserverPointers> m_observersByType;
+			std::string m_name;
 		};
 
 	private:
-		AggregateObserverBuilder<model::Notification> m_builder;
+		std::vector<ObserverEntry> m_entries;
 	};
 
 	/// Adds an observer (\a pObserver) to the builder that is always invoked.
 	template<>
 	CATAPULT_INLINE
 	DemuxObserverBuilder& DemuxObserverBuilder::add(NotificationObserverPointerT<model::Notification>&& pObserver) {
-		m_builder.add(std::move(pObserver));
+		m_entries.push_back({ std::move(pObserver), false, model::NotificationType() });
 		return *this;
 	}
 }}
@@ -29,12 +29,25 @@
 #include "catapult/cache/AggregateUtCache.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/io/AggregateBlockStorage.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/SegmentedFileBasedStorage.h"
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::unique_ptr<io::PrunableBlockStorage> CreateFileStorage(const config::LocalNodeConfiguration& config) {
+			const auto& dataDirectory = config.User.DataDirectory;
+			if (config.Node.ShouldUseSegmentedBlockStorage)
+				return std::make_unique<io::SegmentedFileBasedStorage>(dataDirectory);
+
+			auto readMode = config.Node.ShouldUseMemoryMappedBlockStorage ? io::BlockReadMode::Memory_Mapped : io::BlockReadMode::Buffered;
+			return std::make_unique<io::FileBasedStorage>(dataDirectory, readMode);
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::LocalNodeConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBasedStorage>(m_config.User.DataDirectory)) {
+			, m_pStorage(CreateFileStorage(m_config)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
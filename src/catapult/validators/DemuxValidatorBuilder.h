@@ -19,55 +19,60 @@
 **/
 
 #pragma once
-#include "AggregateValidatorBuilder.h"
+#include "AggregateNotificationValidator.h"
+#include "AggregateValidationResult.h"
 #include "ValidatorTypes.h"
-#include <functional>
+#include "catapult/utils/NamedObject.h"
+#include <unordered_map>
 #include <vector>
 
 namespace catapult { namespace validators {
 
 	/// A demultiplexing validator builder.
+	/// \note The built validator dispatches each notification only to the validators registered for its type
+	///        (ignoring channel) and to the validators registered for all notifications.
 	template<typename... TArgs>
 	class DemuxValidatorBuilderT {
 	private:
 		template<typename TNotification>
 		using NotificationValidatorPointerT = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
-		using NotificationValidatorPredicate = predicate<const model::Notification&>;
+		using NotificationValidator = NotificationValidatorT<model::Notification, TArgs...>;
+		using NotificationValidatorPointer = NotificationValidatorPointerT<model::Notification>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
 
+		struct ValidatorEntry {
+			NotificationValidatorPointer pValidator;
+			bool IsTyped;
+			model::NotificationType Type;
+		};
+
 	public:
 		/// Adds a validator (\a pValidator) to the builder that is invoked only when matching notifications are processed.
 		template<
 				typename TNotification,
 				typename X = typename std::enable_if<!std::is_same<model::Notification, TNotification>::value>::type>
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<TNotification>&& pValidator) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+			auto pTypedValidator = std::make_unique<TypedValidator<TNotification>>(std::move(pValidator));
+			m_entries.push_back({ std::move(pTypedValidator), true, TNotification::Notification_Type });
 			return *this;
 		}
 
 		/// Adds a validator (\a pValidator) to the builder that is always invoked.
-		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<model::Notification>&& pValidator) {
-			m_builder.add(std::move(pValidator));
+		DemuxValidatorBuilderT& add(NotificationValidatorPointer&& pValidator) {
+			m_entries.push_back({ std::move(pValidator), false, model::NotificationType() });
 			return *this;
 		}
 
 		/// Builds a demultiplexing validator that ignores suppressed failures according to \a isSuppressedFailure.
 		AggregateValidatorPointer build(const ValidationResultPredicate& isSuppressedFailure) {
-			return m_builder.build(isSuppressedFailure);
+			return std::make_unique<DemuxAggregateNotificationValidator>(std::move(m_entries), isSuppressedFailure);
 		}
 
 	private:
 		template<typename TNotification>
-		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
+		class TypedValidator : public NotificationValidator {
 		public:
-			ConditionalValidator(
-					NotificationValidatorPointerT<TNotification>&& pValidator,
-					const NotificationValidatorPredicate& predicate)
-					: m_pValidator(std::move(pValidator))
-					, m_predicate(predicate)
+			explicit TypedValidator(NotificationValidatorPointerT<TNotification>&& pValidator) : m_pValidator(std::move(pValidator))
 			{}
 
 		public:
@@ -76,18 +81,88 @@ namespace catapult { namespace validators {
 			}
 
 			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
-				if (!m_predicate(notification))
-					return ValidationResult::Success;
-
 				return m_pValidator->validate(static_cast<const TNotification&>(notification), std::forward<TArgs>(args)...);
 			}
 
 		private:
 			NotificationValidatorPointerT<TNotification> m_pValidator;
-			NotificationValidatorPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationValidator : public AggregateNotificationValidatorT<model::Notification, TArgs...> {
+		private:
+			using ValidatorPointers = std::vector<const NotificationValidator*>;
+
+		public:
+			DemuxAggregateNotificationValidator(std::vector<ValidatorEntry>&& entries, const ValidationResultPredicate& isSuppressedFailure)
+					: m_isSuppressedFailure(isSuppressedFailure) {
+				// 1. collect all notification types with typed validators
+				for (const auto& entry : entries) {
+					if (entry.IsTyped)
+						m_validatorsByType.emplace(ToTypeKey(entry.Type), ValidatorPointers());
+				}
+
+				// 2. build dispatch lists for all types (and for unknown types) preserving registration order
+				for (auto& entry : entries) {
+					if (entry.IsTyped) {
+						m_validatorsByType.find(ToTypeKey(entry.Type))->second.push_back(entry.pValidator.get());
+					} else {
+						m_untypedValidators.push_back(entry.pValidator.get());
+						for (auto& pair : m_validatorsByType)
+							pair.second.push_back(entry.pValidator.get());
+					}
+
+					m_validators.push_back(std::move(entry.pValidator));
+				}
+
+				m_name = utils::ReduceNames(utils::ExtractNames(m_validators));
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return utils::ExtractNames(m_validators);
+			}
+
+			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
+				auto iter = m_validatorsByType.find(ToTypeKey(notification.Type));
+				const auto& validators = m_validatorsByType.cend() == iter ? m_untypedValidators : iter->second;
+
+				auto aggregateResult = ValidationResult::Success;
+				for (const auto* pValidator : validators) {
+					auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
+
+					// ignore suppressed failures
+					if (m_isSuppressedFailure(result))
+						continue;
+
+					// exit on other failures
+					if (IsValidationResultFailure(result))
+						return result;
+
+					AggregateValidationResult(aggregateResult, result);
+				}
+
+				return aggregateResult;
+			}
+
+		private:
+			static uint32_t ToTypeKey(model::NotificationType type) {
+				model::SetNotificationChannel(type, model::NotificationChannel::None);
+				return utils::to_underlying_type(type);
+			}
+
+		private:
+			std::vector<NotificationValidatorPointer> m_validators;
+			ValidatorPointers m_untypedValidators;
+			std::unordered_map<uint32_t, ValidatorPointers> m_validatorsByType;
+			ValidationResultPredicate m_isSuppressedFailure;
+			std::string m_name;
 		};
 
 	private:
-		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
+		std::vector<ValidatorEntry> m_entries;
 	};
 }}
@@ -21,8 +21,10 @@
 #include "catapult/cache/CacheStorageAdapter.h"
 #include "catapult/cache/SubCachePluginAdapter.h"
 #include "tests/catapult/cache/test/CacheSerializationTestUtils.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -47,8 +49,15 @@ namespace catapult { namespace cache {
 
 		class ViewAdapter {
 		public:
-			explicit ViewAdapter(const std::vector<TestEntry>& entries) : m_entries(entries)
-			{}
+			ViewAdapter(const std::vector<TestEntry>& entries, size_t& numActiveViews)
+					: m_entries(entries)
+					, m_numActiveViews(numActiveViews) {
+				++m_numActiveViews;
+			}
+
+			~ViewAdapter() {
+				--m_numActiveViews;
+			}
 
 		public:
 			size_t size() const {
@@ -61,6 +70,7 @@ namespace catapult { namespace cache {
 
 		private:
 			const std::vector<TestEntry>& m_entries;
+			size_t& m_numActiveViews;
 		};
 
 		class VectorToCacheAdapter {
@@ -76,6 +86,7 @@ namespace catapult { namespace cache {
 				size_t NumCreateViewCalls = 0;
 				size_t NumCreateDeltaCalls = 0;
 				size_t NumCommitCalls = 0;
+				size_t NumActiveViews = 0;
 			};
 
 		public:
@@ -86,7 +97,7 @@ namespace catapult { namespace cache {
 		public:
 			std::unique_ptr<ViewAdapter> createView() const {
 				++m_counts.NumCreateViewCalls;
-				return std::make_unique<ViewAdapter>(m_entries);
+				return std::make_unique<ViewAdapter>(m_entries, m_counts.NumActiveViews);
 			}
 
 			std::vector<TestEntry>* createDelta() {
@@ -171,9 +182,10 @@ namespace catapult { namespace cache {
 			auto seed = GenerateRandomEntries(numEntries);
 			auto buffer = CopyEntriesToStreamBuffer(seed);
 			mocks::MockMemoryStream stream("", buffer);
+			auto pPool = test::CreateStartedIoServiceThreadPool();
 
 			// Act:
-			storage.loadAll(stream, batchSize);
+			storage.loadAll(stream, batchSize, *pPool);
 
 			// Assert:
 			EXPECT_EQ(0u, cache.counts().NumCreateViewCalls);
@@ -194,4 +206,302 @@ namespace catapult { namespace cache {
 		// Assert:
 		AssertCanLoadViaCacheStorageAdapter(7, 2, 4);
 	}
+
+	// region chunked
+
+	namespace {
+		constexpr size_t Num_Entries_Per_Chunk = 4;
+		constexpr auto Chunked_Header_Size = 3 * sizeof(uint64_t);
+		constexpr auto Chunk_Header_Size = 2 * sizeof(uint64_t);
+
+		struct ChunkedTestEntryStorageTraits : public TestEntryStorageTraits {
+			using SnapshotType = std::vector<TestEntry>;
+			using StagingType = std::vector<TestEntry>;
+
+			static SnapshotType CreateSnapshot(const SourceType& view) {
+				return *view.tryMakeIterableView();
+			}
+
+			static void SaveChunk(const SnapshotType& snapshot, size_t startIndex, size_t count, io::OutputStream& output) {
+				for (auto i = startIndex; i < startIndex + count; ++i)
+					Save(snapshot[i], output);
+			}
+
+			static void LoadChunk(io::InputStream& input, uint64_t numEntries, StagingType& staging) {
+				while (numEntries--)
+					TestEntryLoaderTraits::LoadInto(input, staging);
+			}
+
+			static void MergeStaged(StagingType&& staging, DestinationType& destination) {
+				destination.insert(destination.end(), staging.cbegin(), staging.cend());
+			}
+		};
+
+		using ChunkedStorageAdapter = CacheStorageAdapter<VectorToCacheAdapter, ChunkedTestEntryStorageTraits>;
+
+		std::vector<uint8_t> SaveChunked(const std::vector<TestEntry>& entries) {
+			auto seed = entries;
+			VectorToCacheAdapter cache(seed);
+			ChunkedStorageAdapter storage(cache, Num_Entries_Per_Chunk);
+
+			std::vector<uint8_t> buffer;
+			mocks::MockMemoryStream stream("", buffer);
+			storage.saveAll(stream);
+			return buffer;
+		}
+
+		void AssertChunkedFormat(const std::vector<TestEntry>& entries, const std::vector<uint8_t>& buffer) {
+			auto numExpectedChunks = (entries.size() + Num_Entries_Per_Chunk - 1) / Num_Entries_Per_Chunk;
+			ASSERT_EQ(Chunked_Header_Size + numExpectedChunks * Chunk_Header_Size + entries.size() * sizeof(TestEntry), buffer.size());
+
+			const auto* pHeader = reinterpret_cast<const uint64_t*>(buffer.data());
+			EXPECT_EQ(Chunked_Data_Marker, pHeader[0]);
+			EXPECT_EQ(entries.size(), pHeader[1]);
+			EXPECT_EQ(numExpectedChunks, pHeader[2]);
+
+			const auto* pData = buffer.data() + Chunked_Header_Size;
+			for (auto i = 0u; i < numExpectedChunks; ++i) {
+				auto numChunkEntries = std::min(Num_Entries_Per_Chunk, entries.size() - i * Num_Entries_Per_Chunk);
+				const auto* pChunkHeader = reinterpret_cast<const uint64_t*>(pData);
+				EXPECT_EQ(numChunkEntries, pChunkHeader[0]) << "chunk " << i;
+				EXPECT_EQ(numChunkEntries * sizeof(TestEntry), pChunkHeader[1]) << "chunk " << i;
+
+				pData += Chunk_Header_Size;
+				const auto* pExpectedEntries = entries.data() + i * Num_Entries_Per_Chunk;
+				EXPECT_TRUE(0 == memcmp(pExpectedEntries, pData, numChunkEntries * sizeof(TestEntry))) << "chunk " << i;
+				pData += numChunkEntries * sizeof(TestEntry);
+			}
+		}
+
+		void AssertCanSaveChunkedViaCacheStorageAdapter(uint64_t numEntries) {
+			// Arrange:
+			auto seed = GenerateRandomEntries(numEntries);
+			VectorToCacheAdapter cache(seed);
+			ChunkedStorageAdapter storage(cache, Num_Entries_Per_Chunk);
+
+			std::vector<uint8_t> buffer;
+			mocks::MockMemoryStream stream("", buffer);
+
+			// Act:
+			storage.saveAll(stream);
+
+			// Assert:
+			EXPECT_EQ(1u, cache.counts().NumCreateViewCalls);
+			EXPECT_EQ(0u, cache.counts().NumCreateDeltaCalls);
+			EXPECT_EQ(0u, cache.counts().NumCommitCalls);
+
+			AssertChunkedFormat(seed, buffer);
+			EXPECT_EQ(1u, stream.numFlushes());
+		}
+	}
+
+	TEST(TEST_CLASS, CanSaveEmptyChunkedDataViaCacheStorageAdapter) {
+		// Assert:
+		AssertCanSaveChunkedViaCacheStorageAdapter(0);
+	}
+
+	TEST(TEST_CLASS, CanSaveChunkedDataViaCacheStorageAdapter_SingleChunk) {
+		// Assert:
+		AssertCanSaveChunkedViaCacheStorageAdapter(Num_Entries_Per_Chunk);
+	}
+
+	TEST(TEST_CLASS, CanSaveChunkedDataViaCacheStorageAdapter_MultipleChunks) {
+		// Assert: last chunk is partial
+		AssertCanSaveChunkedViaCacheStorageAdapter(6 * Num_Entries_Per_Chunk + 1);
+	}
+
+	namespace {
+		class ViewTrackingOutputStream : public io::OutputStream {
+		public:
+			explicit ViewTrackingOutputStream(const VectorToCacheAdapter& cache) : m_cache(cache)
+			{}
+
+		public:
+			const std::vector<size_t>& numActiveViewsPerWrite() const {
+				return m_numActiveViewsPerWrite;
+			}
+
+		public:
+			void write(const RawBuffer&) override {
+				m_numActiveViewsPerWrite.push_back(m_cache.counts().NumActiveViews);
+			}
+
+			void flush() override
+			{}
+
+		private:
+			const VectorToCacheAdapter& m_cache;
+			std::vector<size_t> m_numActiveViewsPerWrite;
+		};
+
+		template<typename TStorageTraits>
+		std::vector<size_t> SaveAndCollectNumActiveViewsPerWrite() {
+			// Arrange:
+			auto seed = GenerateRandomEntries(10);
+			VectorToCacheAdapter cache(seed);
+			CacheStorageAdapter<VectorToCacheAdapter, TStorageTraits> storage(cache, Num_Entries_Per_Chunk);
+
+			ViewTrackingOutputStream stream(cache);
+
+			// Act:
+			storage.saveAll(stream);
+
+			// Sanity:
+			EXPECT_FALSE(stream.numActiveViewsPerWrite().empty());
+			return stream.numActiveViewsPerWrite();
+		}
+	}
+
+	TEST(TEST_CLASS, SequentialDataIsSavedFromView) {
+		// Act:
+		auto numActiveViewsPerWrite = SaveAndCollectNumActiveViewsPerWrite<TestEntryStorageTraits>();
+
+		// Assert:
+		for (auto numActiveViews : numActiveViewsPerWrite)
+			EXPECT_EQ(1u, numActiveViews);
+	}
+
+	TEST(TEST_CLASS, ChunkedDataIsSavedFromDetachedSnapshot) {
+		// Act:
+		auto numActiveViewsPerWrite = SaveAndCollectNumActiveViewsPerWrite<ChunkedTestEntryStorageTraits>();
+
+		// Assert: the view was released before any data was written
+		for (auto numActiveViews : numActiveViewsPerWrite)
+			EXPECT_EQ(0u, numActiveViews);
+	}
+
+	namespace {
+		constexpr uint32_t Num_Loader_Threads = 2;
+
+		void AssertCanLoadChunkedViaCacheStorageAdapter(size_t numEntries, uint32_t numThreads = Num_Loader_Threads) {
+			// Arrange:
+			std::vector<TestEntry> loadedEntries;
+			VectorToCacheAdapter cache(loadedEntries);
+			ChunkedStorageAdapter storage(cache, Num_Entries_Per_Chunk);
+
+			auto seed = GenerateRandomEntries(numEntries);
+			auto buffer = SaveChunked(seed);
+			mocks::MockMemoryStream stream("", buffer);
+			auto pPool = test::CreateStartedIoServiceThreadPool(numThreads);
+
+			// Act: use a batch size smaller than the number of entries
+			storage.loadAll(stream, 2, *pPool);
+
+			// Assert: all chunks are committed at once
+			EXPECT_EQ(0u, cache.counts().NumCreateViewCalls);
+			EXPECT_EQ(1u, cache.counts().NumCreateDeltaCalls);
+			EXPECT_EQ(1u, cache.counts().NumCommitCalls);
+
+			EXPECT_EQ(seed, loadedEntries);
+			EXPECT_EQ(buffer.size(), stream.position());
+		}
+	}
+
+	TEST(TEST_CLASS, CanLoadEmptyChunkedDataViaCacheStorageAdapter) {
+		// Assert:
+		AssertCanLoadChunkedViaCacheStorageAdapter(0);
+	}
+
+	TEST(TEST_CLASS, CanLoadChunkedDataViaCacheStorageAdapter_SingleChunk) {
+		// Assert:
+		AssertCanLoadChunkedViaCacheStorageAdapter(Num_Entries_Per_Chunk - 1);
+	}
+
+	TEST(TEST_CLASS, CanLoadChunkedDataViaCacheStorageAdapter_MultipleChunks) {
+		// Assert: more chunks than can be parsed in parallel
+		AssertCanLoadChunkedViaCacheStorageAdapter((2 * Num_Loader_Threads + 3) * Num_Entries_Per_Chunk + 1);
+	}
+
+	TEST(TEST_CLASS, CanLoadChunkedDataViaCacheStorageAdapter_SingleThreadPool) {
+		// Assert: chunks are parsed one at a time
+		AssertCanLoadChunkedViaCacheStorageAdapter(3 * Num_Entries_Per_Chunk + 1, 1);
+	}
+
+	TEST(TEST_CLASS, CanLoadSequentialDataViaChunkedCacheStorageAdapter) {
+		// Arrange:
+		std::vector<TestEntry> loadedEntries;
+		VectorToCacheAdapter cache(loadedEntries);
+		ChunkedStorageAdapter storage(cache, Num_Entries_Per_Chunk);
+
+		auto seed = GenerateRandomEntries(7);
+		auto buffer = CopyEntriesToStreamBuffer(seed);
+		mocks::MockMemoryStream stream("", buffer);
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+
+		// Act:
+		storage.loadAll(stream, 2, *pPool);
+
+		// Assert: sequential data is committed in batches
+		EXPECT_EQ(1u, cache.counts().NumCreateDeltaCalls);
+		EXPECT_EQ(4u, cache.counts().NumCommitCalls);
+		EXPECT_EQ(seed, loadedEntries);
+	}
+
+	TEST(TEST_CLASS, CannotLoadChunkedDataViaSequentialCacheStorageAdapter) {
+		// Arrange:
+		std::vector<TestEntry> loadedEntries;
+		VectorToCacheAdapter cache(loadedEntries);
+		CacheStorageAdapter<VectorToCacheAdapter, TestEntryStorageTraits> storage(cache);
+
+		auto buffer = SaveChunked(GenerateRandomEntries(7));
+		mocks::MockMemoryStream stream("", buffer);
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+
+		// Act + Assert:
+		EXPECT_THROW(storage.loadAll(stream, 100, *pPool), catapult_runtime_error);
+		EXPECT_EQ(0u, cache.counts().NumCommitCalls);
+	}
+
+	namespace {
+		void AssertCannotLoadMalformedChunkedData(const consumer<std::vector<uint8_t>&>& malformBuffer) {
+			// Arrange:
+			std::vector<TestEntry> loadedEntries;
+			VectorToCacheAdapter cache(loadedEntries);
+			ChunkedStorageAdapter storage(cache, Num_Entries_Per_Chunk);
+
+			auto buffer = SaveChunked(GenerateRandomEntries(3 * Num_Entries_Per_Chunk));
+			malformBuffer(buffer);
+			mocks::MockMemoryStream stream("", buffer);
+			auto pPool = test::CreateStartedIoServiceThreadPool(Num_Loader_Threads);
+
+			// Act + Assert:
+			EXPECT_THROW(storage.loadAll(stream, 100, *pPool), catapult_runtime_error);
+			EXPECT_EQ(0u, cache.counts().NumCommitCalls);
+		}
+
+		uint64_t& GetChunkHeaderValue(std::vector<uint8_t>& buffer, size_t chunkIndex, size_t valueIndex) {
+			auto chunkOffset = Chunked_Header_Size + chunkIndex * (Chunk_Header_Size + Num_Entries_Per_Chunk * sizeof(TestEntry));
+			return reinterpret_cast<uint64_t*>(buffer.data() + chunkOffset)[valueIndex];
+		}
+	}
+
+	TEST(TEST_CLASS, CannotLoadChunkedDataWithTooFewEntries) {
+		// Assert:
+		AssertCannotLoadMalformedChunkedData([](auto& buffer) {
+			++reinterpret_cast<uint64_t*>(buffer.data())[1];
+		});
+	}
+
+	TEST(TEST_CLASS, CannotLoadChunkedDataWithTooManyEntries) {
+		// Assert:
+		AssertCannotLoadMalformedChunkedData([](auto& buffer) {
+			--reinterpret_cast<uint64_t*>(buffer.data())[1];
+		});
+	}
+
+	TEST(TEST_CLASS, CannotLoadChunkedDataWithChunkContainingTrailingData) {
+		// Assert: second chunk claims one entry less than it contains
+		AssertCannotLoadMalformedChunkedData([](auto& buffer) {
+			--GetChunkHeaderValue(buffer, 1, 0);
+		});
+	}
+
+	TEST(TEST_CLASS, CannotLoadChunkedDataWithChunkContainingTooFewBytes) {
+		// Assert: second chunk claims one entry more than it contains
+		AssertCannotLoadMalformedChunkedData([](auto& buffer) {
+			++GetChunkHeaderValue(buffer, 1, 0);
+		});
+	}
+
+	// endregion
 }}
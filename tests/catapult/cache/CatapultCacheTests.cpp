@@ -22,9 +22,11 @@
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -216,6 +218,158 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region undo
+
+	namespace {
+		void CommitChangeToAllSubCachesAtHeight(CatapultCache& cache, Height height) {
+			auto delta = cache.createDelta();
+			IncrementAllSubCaches(delta);
+			cache.commit(height);
+		}
+
+		CatapultCache CreateJournaledCatapultCache(uint32_t maxRollbackBlocks) {
+			// Arrange: commit changes at heights 10, 15, 20 and 25
+			auto cache = CreateSimpleCatapultCache();
+			cache.enableUndoJournal(maxRollbackBlocks);
+			for (auto height : { 10u, 15u, 20u, 25u })
+				CommitChangeToAllSubCachesAtHeight(cache, Height(height));
+
+			return cache;
+		}
+	}
+
+	TEST(TEST_CLASS, UndoReturnsCacheHeightWhenUndoJournalIsDisabled) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+		CommitChangeToAllSubCachesAtHeight(cache, Height(10));
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto undoneHeight = cache.undo(Height(5));
+
+		// Assert:
+		EXPECT_EQ(Height(10), undoneHeight);
+		AssertSubCacheSizes(delta, 1);
+	}
+
+	TEST(TEST_CLASS, UndoRevertsAllCommitsStartingAtOrAboveHeight) {
+		// Arrange:
+		auto cache = CreateJournaledCatapultCache(100);
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto undoneHeight = cache.undo(Height(15));
+
+		// Assert: only the delta is changed
+		EXPECT_EQ(Height(15), undoneHeight);
+		AssertSubCacheSizes(delta, 2);
+		AssertSubCacheSizes(cache.createView(), 4);
+		EXPECT_EQ(Height(25), cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, UndoToHeightWithinCommitReturnsStartHeightOfNextCommit) {
+		// Arrange:
+		auto cache = CreateJournaledCatapultCache(100);
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto undoneHeight = cache.undo(Height(12));
+
+		// Assert:
+		EXPECT_EQ(Height(15), undoneHeight);
+		AssertSubCacheSizes(delta, 2);
+	}
+
+	TEST(TEST_CLASS, UndoCanBeCalledMultipleTimes) {
+		// Arrange:
+		auto cache = CreateJournaledCatapultCache(100);
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto undoneHeight1 = cache.undo(Height(20));
+		auto undoneHeight2 = cache.undo(Height(15));
+
+		// Assert:
+		EXPECT_EQ(Height(20), undoneHeight1);
+		EXPECT_EQ(Height(15), undoneHeight2);
+		AssertSubCacheSizes(delta, 2);
+	}
+
+	TEST(TEST_CLASS, UndoIsDiscardedWithDelta) {
+		// Arrange:
+		auto cache = CreateJournaledCatapultCache(100);
+		{
+			auto delta = cache.createDelta();
+			cache.undo(Height(15));
+		}
+
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto undoneHeight = cache.undo(Height(20));
+
+		// Assert:
+		EXPECT_EQ(Height(20), undoneHeight);
+		AssertSubCacheSizes(delta, 3);
+	}
+
+	TEST(TEST_CLASS, CommitAfterUndoReplacesUndoneCommits) {
+		// Arrange:
+		auto cache = CreateJournaledCatapultCache(100);
+		{
+			auto delta = cache.createDelta();
+			cache.undo(Height(15));
+			IncrementAllSubCaches(delta);
+
+			// Act:
+			cache.commit(Height(18));
+		}
+
+		// Assert:
+		AssertSubCacheSizes(cache.createView(), 3);
+		EXPECT_EQ(Height(18), cache.createView().height());
+
+		// - the replacement commit and all preceding commits can be undone
+		auto delta = cache.createDelta();
+		EXPECT_EQ(Height(15), cache.undo(Height(15)));
+		AssertSubCacheSizes(delta, 2);
+
+		EXPECT_EQ(Height(10), cache.undo(Height(10)));
+		AssertSubCacheSizes(delta, 1);
+	}
+
+	TEST(TEST_CLASS, CommitAfterPartialUndoDiscardsUndoJournal) {
+		// Arrange: the caller reverts the changes between heights 12 and 15 outside of the journal
+		auto cache = CreateJournaledCatapultCache(100);
+		{
+			auto delta = cache.createDelta();
+			cache.undo(Height(12));
+
+			// Act:
+			cache.commit(Height(12));
+		}
+
+		// Assert: no commits can be undone anymore
+		auto delta = cache.createDelta();
+		EXPECT_EQ(Height(12), cache.undo(Height(10)));
+		AssertSubCacheSizes(delta, 2);
+	}
+
+	TEST(TEST_CLASS, UndoIsLimitedByMaxRollbackBlocks) {
+		// Arrange: only the commits starting at heights 15 and 20 are within the rollback window of height 25
+		auto cache = CreateJournaledCatapultCache(10);
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto undoneHeight = cache.undo(Height(10));
+
+		// Assert:
+		EXPECT_EQ(Height(15), undoneHeight);
+		AssertSubCacheSizes(delta, 2);
+	}
+
+	// endregion
+
 	// region toReadOnly
 
 	TEST(TEST_CLASS, CanAcquireReadOnlyViewOfView) {
@@ -280,9 +434,10 @@ namespace catapult { namespace cache {
 		// - load all data
 		auto i = 0u;
 		auto cache = CreateSimpleCatapultCache();
+		auto pPool = test::CreateStartedIoServiceThreadPool();
 		for (const auto& pStorage : cache.storages()) {
 			mocks::MockMemoryStream stream("", serializedSubCaches[i++]);
-			pStorage->loadAll(stream, 5);
+			pStorage->loadAll(stream, 5, *pPool);
 		}
 
 		// Assert: the cache data was loaded successfully
@@ -326,9 +481,10 @@ namespace catapult { namespace cache {
 		// - load all data
 		auto i = 0u;
 		auto cache = CreateSimpleCatapultCacheWithSomeNonIterableSubCaches();
+		auto pPool = test::CreateStartedIoServiceThreadPool();
 		for (const auto& pStorage : cache.storages()) {
 			mocks::MockMemoryStream stream("", serializedSubCaches[i++]);
-			pStorage->loadAll(stream, 5);
+			pStorage->loadAll(stream, 5, *pPool);
 		}
 
 		// Assert: the cache data was loaded successfully for all caches that support storage
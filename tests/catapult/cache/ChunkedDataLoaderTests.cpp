@@ -106,6 +106,24 @@ namespace catapult { namespace cache {
 		EXPECT_FALSE(loader.hasNext());
 	}
 
+	TEST(TEST_CLASS, CanLoadStorageWithPreviouslyConsumedEntryCount) {
+		// Arrange:
+		auto seed = GenerateRandomEntries(7);
+		auto buffer = CopyEntriesToStreamBuffer(seed);
+		mocks::MockMemoryStream stream("", buffer);
+		io::Read64(stream);
+		ChunkedDataLoader<TestEntryLoaderTraits> loader(stream, 5);
+
+		// Act:
+		std::vector<TestEntry> loadedEntries;
+		loader.next(100, loadedEntries);
+
+		// Assert:
+		EXPECT_FALSE(loader.hasNext());
+		EXPECT_EQ(std::vector<TestEntry>(seed.cbegin(), seed.cbegin() + 5), loadedEntries);
+		EXPECT_EQ(sizeof(uint64_t) + 5 * sizeof(TestEntry), stream.position());
+	}
+
 	TEST(TEST_CLASS, ReadingFromEndOfStreamHasNoEffect) {
 		// Arrange:
 		auto buffer = CopyEntriesToStreamBuffer({});
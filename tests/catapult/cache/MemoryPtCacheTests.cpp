@@ -607,10 +607,14 @@ namespace catapult { namespace cache {
 		}
 
 		Hash256 HashCosignatures(const std::vector<model::Cosignature>& cosignatures) {
-			Hash256 cosignaturesHash;
-			crypto::Sha3_256(
-					{ reinterpret_cast<const uint8_t*>(cosignatures.data()), cosignatures.size() * sizeof(model::Cosignature) },
-					cosignaturesHash);
+			Hash256 cosignaturesHash{};
+			for (const auto& cosignature : cosignatures) {
+				Hash256 cosignatureHash;
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&cosignature), sizeof(model::Cosignature) }, cosignatureHash);
+				for (auto i = 0u; i < Hash256_Size; ++i)
+					cosignaturesHash[i] ^= cosignatureHash[i];
+			}
+
 			return cosignaturesHash;
 		}
 	}
@@ -670,8 +674,31 @@ namespace catapult { namespace cache {
 			}
 		}
 
-		// - calculate the expected cosignatures hash (notice that the cosignatures must be sorted)
-		auto expectedCosignaturesHash = HashCosignatures(Sort(cosignatures));
+		// - calculate the expected cosignatures hash
+		auto expectedCosignaturesHash = HashCosignatures(cosignatures);
+
+		// Act:
+		auto shortHashPairs = cache.view().shortHashPairs();
+
+		// Assert:
+		ValidateShortHashPairs(transactionInfos, shortHashPairs, [&expectedCosignaturesHash](const auto&) {
+			return utils::ToShortHash(expectedCosignaturesHash);
+		});
+	}
+
+	TEST(TEST_CLASS, ShortHashesReturnCosignaturesShortHashUnaffectedByRedundantCosignatures) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(1);
+		AddAll(cache, transactionInfos);
+
+		// - add all cosignatures twice
+		auto cosignatures = test::GenerateRandomDataVector<model::Cosignature>(5);
+		AddAll(cache, transactionInfos[0], cosignatures);
+		AddAll(cache, transactionInfos[0], cosignatures);
+
+		// - calculate the expected cosignatures hash
+		auto expectedCosignaturesHash = HashCosignatures(cosignatures);
 
 		// Act:
 		auto shortHashPairs = cache.view().shortHashPairs();
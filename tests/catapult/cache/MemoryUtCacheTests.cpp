@@ -515,6 +515,276 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEachByFeeDensity
+
+	namespace {
+		struct FeeDescriptor {
+			Amount Fee;
+			uint32_t Size;
+		};
+
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithFees(const std::vector<FeeDescriptor>& descriptors) {
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < descriptors.size(); ++i) {
+				auto pTransaction = test::GenerateRandomTransaction(descriptors[i].Size);
+				pTransaction->Fee = descriptors[i].Fee;
+				pTransaction->Deadline = Timestamp(i);
+
+				auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+				test::FillWithRandomData(transactionInfo.EntityHash);
+				transactionInfos.push_back(std::move(transactionInfo));
+			}
+
+			return transactionInfos;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractRawDeadlinesByFeeDensity(const MemoryUtCache& cache, size_t numRequested) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEachByFeeDensity([numRequested, &rawDeadlines](const auto& info) {
+				rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+				return numRequested != rawDeadlines.size();
+			});
+			return rawDeadlines;
+		}
+
+		std::unique_ptr<MemoryUtCache> PrepareCacheWithFees() {
+			auto pCache = std::make_unique<MemoryUtCache>(Default_Options);
+			test::AddAll(*pCache, CreateTransactionInfosWithFees({
+				{ Amount(200), 200 }, // 1.00
+				{ Amount(300), 150 }, // 2.00
+				{ Amount(100), 400 }, // 0.25
+				{ Amount(600), 300 }, // 2.00
+				{ Amount(500), 250 }, // 2.00
+				{ Amount(0), 200 } // 0.00
+			}));
+			return pCache;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeDensityForwardsNoTransactionInfosIfCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByFeeDensity(cache, 3);
+
+		// Assert:
+		EXPECT_TRUE(rawDeadlines.empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeDensityForwardsAllTransactionsByDecreasingFeePerByteIfNotShortCircuited) {
+		// Arrange:
+		auto pCache = PrepareCacheWithFees();
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByFeeDensity(*pCache, 100);
+
+		// Assert: transactions with equal fees per byte are ordered by arrival
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3, 4, 0, 2, 5 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeDensityForwardsSubsetOfTransactionsIfShortCircuited) {
+		// Arrange:
+		auto pCache = PrepareCacheWithFees();
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByFeeDensity(*pCache, 4);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3, 4, 0 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeDensityCanOrderTransactionsWithLargeFees) {
+		// Arrange: fee * size products do not fit into 64 bits
+		auto pCache = std::make_unique<MemoryUtCache>(Default_Options);
+		test::AddAll(*pCache, CreateTransactionInfosWithFees({
+			{ Amount(0xFFFF'FFFF'FFFF'FFFF), 200 },
+			{ Amount(0xFFFF'FFFF'FFFF'FFF0), 199 },
+			{ Amount(0x8000'0000'0000'0000), 200 },
+			{ Amount(0xFFFF'FFFF'FFFF'FFFF), 201 }
+		}));
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlinesByFeeDensity(*pCache, 100);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 0, 3, 2 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeDensityDoesNotForwardRemovedTransactions) {
+		// Arrange:
+		auto pCache = PrepareCacheWithFees();
+		std::vector<Hash256> hashes;
+		pCache->view().forEach([&hashes](const auto& info) {
+			if (0 == info.pEntity->Deadline.unwrap() % 3)
+				hashes.push_back(info.EntityHash);
+
+			return true;
+		});
+
+		// Act:
+		test::RemoveAll(*pCache, hashes);
+		auto rawDeadlines = ExtractRawDeadlinesByFeeDensity(*pCache, 100);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 4, 2, 5 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeDensityDoesNotForwardTransactionsAfterRemoveAll) {
+		// Arrange:
+		auto pCache = PrepareCacheWithFees();
+
+		// Act:
+		pCache->modifier().removeAll();
+		auto rawDeadlines = ExtractRawDeadlinesByFeeDensity(*pCache, 100);
+
+		// Assert:
+		EXPECT_TRUE(rawDeadlines.empty());
+	}
+
+	// endregion
+
+	// region selectByFeeDensity
+
+	namespace {
+		struct SignedFeeDescriptor {
+			size_t SignerIndex;
+			Amount Fee;
+		};
+
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithSignersAndFees(const std::vector<SignedFeeDescriptor>& descriptors) {
+			auto signers = test::GenerateRandomDataVector<Key>(descriptors.size());
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < descriptors.size(); ++i) {
+				auto pTransaction = test::GenerateRandomTransaction(200);
+				pTransaction->Signer = signers[descriptors[i].SignerIndex];
+				pTransaction->Fee = descriptors[i].Fee;
+				pTransaction->Deadline = Timestamp(i);
+
+				auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+				test::FillWithRandomData(transactionInfo.EntityHash);
+				transactionInfos.push_back(std::move(transactionInfo));
+			}
+
+			return transactionInfos;
+		}
+
+		std::vector<Timestamp::ValueType> SelectRawDeadlinesByFeeDensity(const MemoryUtCache& cache, size_t count) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			for (const auto* pTransactionInfo : cache.view().selectByFeeDensity(count))
+				rawDeadlines.push_back(pTransactionInfo->pEntity->Deadline.unwrap());
+
+			return rawDeadlines;
+		}
+
+		std::unique_ptr<MemoryUtCache> PrepareCacheWithDependentFees() {
+			// transactions 1 and 3 pay the highest fees but were added after transaction 0 with the same signer
+			auto pCache = std::make_unique<MemoryUtCache>(Default_Options);
+			test::AddAll(*pCache, CreateTransactionInfosWithSignersAndFees({
+				{ 0, Amount(100) },
+				{ 0, Amount(900) },
+				{ 1, Amount(500) },
+				{ 0, Amount(800) }
+			}));
+			return pCache;
+		}
+	}
+
+	TEST(TEST_CLASS, SelectByFeeDensityReturnsNoTransactionInfosIfCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act:
+		auto rawDeadlines = SelectRawDeadlinesByFeeDensity(cache, 3);
+
+		// Assert:
+		EXPECT_TRUE(rawDeadlines.empty());
+	}
+
+	TEST(TEST_CLASS, SelectByFeeDensityReturnsNoTransactionInfosIfZeroInfosAreRequested) {
+		// Arrange:
+		auto pCache = PrepareCacheWithFees();
+
+		// Act:
+		auto rawDeadlines = SelectRawDeadlinesByFeeDensity(*pCache, 0);
+
+		// Assert:
+		EXPECT_TRUE(rawDeadlines.empty());
+	}
+
+	TEST(TEST_CLASS, SelectByFeeDensityReturnsTransactionInfosWithHighestFeesPerByteOrderedByArrival) {
+		// Arrange:
+		auto pCache = PrepareCacheWithFees();
+
+		// Act:
+		auto rawDeadlines = SelectRawDeadlinesByFeeDensity(*pCache, 4);
+
+		// Assert: transactions 1, 3, 4 and 0 are selected
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 0, 1, 3, 4 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, SelectByFeeDensityReturnsAllTransactionInfosOrderedByArrivalIfCacheHasLessThanCountTransactions) {
+		// Arrange:
+		auto pCache = PrepareCacheWithFees();
+
+		// Act:
+		auto rawDeadlines = SelectRawDeadlinesByFeeDensity(*pCache, 100);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 0, 1, 2, 3, 4, 5 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, SelectByFeeDensityDoesNotSelectTransactionInfoBeforeEarlierTransactionInfosWithSameSigner) {
+		// Arrange:
+		auto pCache = PrepareCacheWithDependentFees();
+
+		// Act + Assert: transactions 1 and 3 are deferred until transaction 0 is selected
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2 }), SelectRawDeadlinesByFeeDensity(*pCache, 1));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 0, 2 }), SelectRawDeadlinesByFeeDensity(*pCache, 2));
+	}
+
+	TEST(TEST_CLASS, SelectByFeeDensitySelectsDeferredTransactionInfosAfterEarlierTransactionInfosWithSameSigner) {
+		// Arrange:
+		auto pCache = PrepareCacheWithDependentFees();
+
+		// Act + Assert: transactions 1 and 3 are selected immediately after transaction 0
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 0, 1, 2 }), SelectRawDeadlinesByFeeDensity(*pCache, 3));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 0, 1, 2, 3 }), SelectRawDeadlinesByFeeDensity(*pCache, 4));
+	}
+
+	TEST(TEST_CLASS, SelectByFeeDensityDoesNotDependOnRemovedTransactions) {
+		// Arrange:
+		auto pCache = PrepareCacheWithDependentFees();
+		std::vector<Hash256> hashes;
+		pCache->view().forEach([&hashes](const auto& info) {
+			if (0 == info.pEntity->Deadline.unwrap())
+				hashes.push_back(info.EntityHash);
+
+			return true;
+		});
+
+		// Act:
+		test::RemoveAll(*pCache, hashes);
+		auto rawDeadlines = SelectRawDeadlinesByFeeDensity(*pCache, 2);
+
+		// Assert: transaction 1 is the earliest remaining transaction of its signer
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, SelectByFeeDensityReturnsNoTransactionInfosAfterRemoveAll) {
+		// Arrange:
+		auto pCache = PrepareCacheWithDependentFees();
+
+		// Act:
+		pCache->modifier().removeAll();
+		auto rawDeadlines = SelectRawDeadlinesByFeeDensity(*pCache, 100);
+
+		// Assert:
+		EXPECT_TRUE(rawDeadlines.empty());
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsAllShortHashes) {
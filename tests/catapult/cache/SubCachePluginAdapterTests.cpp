@@ -20,9 +20,11 @@
 
 #include "catapult/cache/SubCachePluginAdapter.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -281,9 +283,10 @@ namespace catapult { namespace cache {
 			pData64[i] = i ^ 0xFFFFFFFF'FFFFFFFF;
 
 		mocks::MockMemoryStream stream("", buffer);
+		auto pPool = test::CreateStartedIoServiceThreadPool();
 
 		// Act:
-		pCacheStorage->loadAll(stream, 2);
+		pCacheStorage->loadAll(stream, 2, *pPool);
 
 		// Assert:
 		auto pView = adapter.createView();
@@ -0,0 +1,137 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/cache/ValueUndoJournal.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS ValueUndoJournalTests
+
+	namespace {
+		ValueUndoJournal<int> CreateJournal(std::initializer_list<int> values) {
+			ValueUndoJournal<int> journal;
+			for (auto value : values)
+				journal.record(value);
+
+			return journal;
+		}
+	}
+
+	TEST(TEST_CLASS, JournalIsInitiallyEmpty) {
+		// Act:
+		ValueUndoJournal<int> journal;
+
+		// Assert:
+		EXPECT_EQ(0u, journal.size());
+	}
+
+	TEST(TEST_CLASS, CanRecordValues) {
+		// Act:
+		auto journal = CreateJournal({ 3, 7, 11 });
+
+		// Assert:
+		EXPECT_EQ(3u, journal.size());
+	}
+
+	TEST(TEST_CLASS, CannotUndoZeroCommits) {
+		// Arrange:
+		auto journal = CreateJournal({ 3, 7, 11 });
+
+		// Act + Assert:
+		EXPECT_THROW(journal.undo(0), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotUndoMoreCommitsThanJournaled) {
+		// Arrange:
+		auto journal = CreateJournal({ 3, 7, 11 });
+
+		// Act + Assert:
+		EXPECT_THROW(journal.undo(4), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, UndoReturnsValueBeforeOldestUndoneCommit) {
+		// Arrange:
+		auto journal = CreateJournal({ 3, 7, 11 });
+
+		// Act:
+		auto value1 = journal.undo(1);
+		auto value2 = journal.undo(2);
+
+		// Assert:
+		EXPECT_EQ(11, value1);
+		EXPECT_EQ(3, value2);
+		EXPECT_EQ(0u, journal.size());
+	}
+
+	TEST(TEST_CLASS, RecordAfterUndoReplacesUndoneCommits) {
+		// Arrange:
+		auto journal = CreateJournal({ 3, 7, 11 });
+		journal.undo(2);
+
+		// Act: the recorded value is ignored because the commit starts from the value before the oldest undone commit
+		journal.record(8);
+
+		// Assert:
+		EXPECT_EQ(2u, journal.size());
+		EXPECT_EQ(7, journal.undo(1));
+		EXPECT_EQ(3, journal.undo(1));
+	}
+
+	TEST(TEST_CLASS, ResetDiscardsUndoneCommits) {
+		// Arrange:
+		auto journal = CreateJournal({ 3, 7, 11 });
+		journal.undo(2);
+
+		// Act:
+		journal.reset();
+		journal.record(13);
+
+		// Assert:
+		EXPECT_EQ(4u, journal.size());
+		EXPECT_EQ(13, journal.undo(1));
+		EXPECT_EQ(11, journal.undo(1));
+	}
+
+	TEST(TEST_CLASS, PruneRetainsMostRecentCommits) {
+		// Arrange:
+		auto journal = CreateJournal({ 3, 7, 11 });
+
+		// Act:
+		journal.prune(2);
+
+		// Assert:
+		EXPECT_EQ(2u, journal.size());
+		EXPECT_EQ(7, journal.undo(2));
+	}
+
+	TEST(TEST_CLASS, PruneHasNoEffectWhenFewerCommitsAreJournaled) {
+		// Arrange:
+		auto journal = CreateJournal({ 3, 7, 11 });
+
+		// Act:
+		journal.prune(5);
+
+		// Assert:
+		EXPECT_EQ(3u, journal.size());
+		EXPECT_EQ(3, journal.undo(3));
+	}
+}}
@@ -19,10 +19,13 @@
 **/
 
 #include "catapult/cache_core/AccountStateCacheStorage.h"
+#include "catapult/cache/CacheStorageAdapter.h"
 #include "catapult/state/AccountStateAdapter.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/core/AccountStateTestUtils.h"
 #include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -56,6 +59,7 @@ namespace catapult { namespace cache {
 			ASSERT_EQ(sizeof(model::AccountInfo) + mosaicsCount * sizeof(model::Mosaic), buffer.size());
 
 			const auto& savedAccountInfo = reinterpret_cast<const model::AccountInfo&>(*buffer.data());
+			EXPECT_EQ(buffer.size(), savedAccountInfo.Size);
 			EXPECT_EQ(mosaicsCount, savedAccountInfo.MosaicsCount);
 
 			auto savedAccountState = state::ToAccountState(savedAccountInfo);
@@ -198,4 +202,297 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region CreateSnapshot / SaveChunk / LoadChunk
+
+	namespace {
+		auto CreateRandomAccountState(Height publicKeyHeight) {
+			auto pAccountState = std::make_shared<state::AccountState>(test::GenerateRandomAddress(), Height(123));
+			pAccountState->PublicKey = test::GenerateRandomData<Key_Size>();
+			pAccountState->PublicKeyHeight = publicKeyHeight;
+			test::RandomFillAccountData(0, *pAccountState, 2);
+			return pAccountState;
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateSnapshot) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		std::set<const state::AccountState*> expectedAccountStates;
+		{
+			auto delta = cache.createDelta();
+			for (auto i = 0u; i < 5; ++i)
+				expectedAccountStates.insert(&delta->addAccount(CreateRandomAccountState(Height(i))));
+
+			cache.commit();
+		}
+
+		// Act:
+		auto snapshot = AccountStateCacheStorage::CreateSnapshot(*cache.createView());
+
+		// Assert: the snapshot shares all account states
+		std::set<const state::AccountState*> accountStates;
+		for (const auto& pAccountState : snapshot)
+			accountStates.insert(pAccountState.get());
+
+		EXPECT_EQ(5u, snapshot.size());
+		EXPECT_EQ(expectedAccountStates, accountStates);
+	}
+
+	TEST(TEST_CLASS, SnapshotIsNotAffectedBySubsequentCommits) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto pOriginalAccountState = CreateRandomAccountState(Height(234));
+		auto address = pOriginalAccountState->Address;
+		{
+			auto delta = cache.createDelta();
+			delta->addAccount(pOriginalAccountState);
+			delta->addAccount(test::GenerateRandomAddress(), Height(345));
+			cache.commit();
+		}
+
+		auto expectedAccountState = *pOriginalAccountState;
+		auto snapshot = AccountStateCacheStorage::CreateSnapshot(*cache.createView());
+
+		// Act: modify one account and remove the other
+		{
+			auto delta = cache.createDelta();
+			delta->get(address).Balances.credit(MosaicId(1234), Amount(1000));
+			for (const auto& pAccountState : snapshot) {
+				if (address != pAccountState->Address)
+					delta->queueRemove(pAccountState->Address, pAccountState->AddressHeight);
+			}
+
+			delta->commitRemovals();
+			cache.commit();
+		}
+
+		// Assert: the cache was modified but the snapshot was not
+		EXPECT_EQ(1u, cache.createView()->size());
+		EXPECT_EQ(2u, snapshot.size());
+
+		auto snapshotIter = std::find_if(snapshot.cbegin(), snapshot.cend(), [&address](const auto& pAccountState) {
+			return address == pAccountState->Address;
+		});
+		ASSERT_NE(snapshot.cend(), snapshotIter);
+		test::AssertEqual(expectedAccountState, **snapshotIter);
+	}
+
+	namespace {
+		template<typename TValue>
+		const TValue& GetValueAt(const std::vector<uint8_t>& buffer, size_t offset) {
+			return reinterpret_cast<const TValue&>(buffer[offset]);
+		}
+	}
+
+	TEST(TEST_CLASS, CanSaveChunkWithColumnarBalances) {
+		// Arrange: only save the middle two accounts
+		AccountStateCacheStorage::SnapshotType snapshot;
+		for (auto numMosaics : { 1u, 2u, 3u, 4u }) {
+			auto pAccountState = CreateRandomAccountState(Height(234));
+			pAccountState->Balances = state::AccountBalances();
+			for (auto i = 0u; i < numMosaics; ++i)
+				pAccountState->Balances.credit(MosaicId(100 + i), Amount(1000 * numMosaics + i));
+
+			snapshot.push_back(pAccountState);
+		}
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		AccountStateCacheStorage::SaveChunk(snapshot, 1, 2, stream);
+
+		// Assert: headers are followed by all mosaic ids and then by all amounts
+		constexpr auto Header_Size = sizeof(model::AccountInfo) - sizeof(uint32_t);
+		constexpr auto Columns_Offset = 2 * Header_Size;
+		ASSERT_EQ(Columns_Offset + 5 * (sizeof(MosaicId) + sizeof(Amount)), buffer.size());
+
+		for (auto i = 0u; i < 2; ++i) {
+			const auto& accountState = *snapshot[1 + i];
+			auto headerOffset = i * Header_Size;
+			EXPECT_EQ(accountState.Address, GetValueAt<Address>(buffer, headerOffset)) << i;
+			EXPECT_EQ(accountState.PublicKey, GetValueAt<Key>(buffer, headerOffset + Address_Decoded_Size + sizeof(Height))) << i;
+			EXPECT_EQ(accountState.Balances.size(), GetValueAt<uint16_t>(buffer, headerOffset + Header_Size - sizeof(uint16_t))) << i;
+		}
+
+		// - balances are columnar in account order (balance order within an account is determined by AccountBalances)
+		std::vector<MosaicId> expectedMosaicIds;
+		std::vector<Amount> expectedAmounts;
+		for (auto i = 1u; i <= 2; ++i) {
+			for (const auto& pair : snapshot[i]->Balances) {
+				expectedMosaicIds.push_back(pair.first);
+				expectedAmounts.push_back(pair.second);
+			}
+		}
+
+		for (auto i = 0u; i < 5; ++i) {
+			EXPECT_EQ(expectedMosaicIds[i], GetValueAt<MosaicId>(buffer, Columns_Offset + i * sizeof(MosaicId))) << i;
+			EXPECT_EQ(expectedAmounts[i], GetValueAt<Amount>(buffer, Columns_Offset + 5 * sizeof(MosaicId) + i * sizeof(Amount))) << i;
+		}
+	}
+
+	namespace {
+		std::vector<uint8_t> SaveRandomChunk(AccountStateCacheStorage::SnapshotType& snapshot) {
+			for (auto height : { Height(0), Height(234), Height(0), Height(345) })
+				snapshot.push_back(CreateRandomAccountState(height));
+
+			std::vector<uint8_t> buffer;
+			mocks::MockMemoryStream stream("", buffer);
+			AccountStateCacheStorage::SaveChunk(snapshot, 0, snapshot.size(), stream);
+			return buffer;
+		}
+	}
+
+	TEST(TEST_CLASS, CanRoundtripChunk) {
+		// Arrange:
+		AccountStateCacheStorage::SnapshotType snapshot;
+		auto buffer = SaveRandomChunk(snapshot);
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		AccountStateCacheStorage::StagingType staging;
+		AccountStateCacheStorage::LoadChunk(stream, snapshot.size(), staging);
+
+		// Assert:
+		EXPECT_EQ(buffer.size(), stream.position());
+		ASSERT_EQ(snapshot.size(), staging.size());
+		for (auto i = 0u; i < snapshot.size(); ++i) {
+			EXPECT_EQ(2u, staging[i]->Balances.size()) << i;
+			test::AssertEqual(*snapshot[i], *staging[i]);
+		}
+	}
+
+	TEST(TEST_CLASS, LoadChunkAppendsToStaging) {
+		// Arrange:
+		AccountStateCacheStorage::SnapshotType snapshot;
+		auto buffer = SaveRandomChunk(snapshot);
+		mocks::MockMemoryStream stream("", buffer);
+
+		auto pExistingAccountState = CreateRandomAccountState(Height(123));
+		AccountStateCacheStorage::StagingType staging{ pExistingAccountState };
+
+		// Act:
+		AccountStateCacheStorage::LoadChunk(stream, snapshot.size(), staging);
+
+		// Assert:
+		ASSERT_EQ(snapshot.size() + 1, staging.size());
+		EXPECT_EQ(pExistingAccountState, staging[0]);
+		for (auto i = 0u; i < snapshot.size(); ++i)
+			test::AssertEqual(*snapshot[i], *staging[i + 1]);
+	}
+
+	TEST(TEST_CLASS, CannotLoadChunkWithTruncatedBalances) {
+		// Arrange: drop the last amount
+		AccountStateCacheStorage::SnapshotType snapshot;
+		auto buffer = SaveRandomChunk(snapshot);
+		buffer.resize(buffer.size() - sizeof(Amount));
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act + Assert:
+		AccountStateCacheStorage::StagingType staging;
+		EXPECT_THROW(AccountStateCacheStorage::LoadChunk(stream, snapshot.size(), staging), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotLoadChunkWithMoreEntriesThanAvailable) {
+		// Arrange:
+		AccountStateCacheStorage::SnapshotType snapshot;
+		auto buffer = SaveRandomChunk(snapshot);
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act + Assert:
+		AccountStateCacheStorage::StagingType staging;
+		EXPECT_THROW(AccountStateCacheStorage::LoadChunk(stream, 1'000'000'000, staging), catapult_file_io_error);
+	}
+
+	// endregion
+
+	// region MergeStaged
+
+	TEST(TEST_CLASS, CanMergeStagedValues) {
+		// Arrange:
+		AccountStateCacheStorage::StagingType staging;
+		for (auto height : { Height(0), Height(234), Height(0), Height(345) })
+			staging.push_back(CreateRandomAccountState(height));
+
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto expectedStaging = staging;
+		AccountStateCacheStorage::MergeStaged(std::move(staging), *delta);
+
+		// Assert: all states are accessible by address and states with public key heights are accessible by public key
+		EXPECT_EQ(4u, delta->size());
+		for (const auto& pAccountState : expectedStaging) {
+			EXPECT_EQ(pAccountState.get(), delta->tryGet(pAccountState->Address));
+
+			auto isKeyKnown = Height(0) != pAccountState->PublicKeyHeight;
+			EXPECT_EQ(isKeyKnown, delta->contains(pAccountState->PublicKey));
+		}
+	}
+
+	TEST(TEST_CLASS, MergeStagedDoesNotOverrideKnownAccounts) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto delta = cache.createDelta();
+
+		auto pOriginalAccountState = CreateRandomAccountState(Height(234));
+		delta->addAccount(pOriginalAccountState);
+
+		AccountStateCacheStorage::StagingType staging;
+		staging.push_back(std::make_shared<state::AccountState>(*pOriginalAccountState));
+
+		// Act:
+		AccountStateCacheStorage::MergeStaged(std::move(staging), *delta);
+
+		// Assert:
+		EXPECT_EQ(1u, delta->size());
+		EXPECT_EQ(pOriginalAccountState.get(), delta->tryGet(pOriginalAccountState->Address));
+	}
+
+	// endregion
+
+	// region chunked roundtrip
+
+	TEST(TEST_CLASS, CanRoundtripCacheViaChunkedStorage) {
+		// Arrange: seed a cache with more accounts than fit in a single chunk
+		AccountStateCache originalCache(CacheConfiguration(), Default_Cache_Options);
+		std::vector<std::shared_ptr<state::AccountState>> accountStates;
+		{
+			auto delta = originalCache.createDelta();
+			for (auto i = 0u; i < 50; ++i) {
+				accountStates.push_back(CreateRandomAccountState(Height(i % 2 ? 0 : i + 1)));
+				delta->addAccount(accountStates.back());
+			}
+
+			originalCache.commit();
+		}
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+		CacheStorageAdapter<AccountStateCache, AccountStateCacheStorage>(originalCache, 7).saveAll(stream);
+
+		// Sanity: chunked data was written
+		ASSERT_LE(sizeof(uint64_t), buffer.size());
+		EXPECT_EQ(Chunked_Data_Marker, reinterpret_cast<const uint64_t&>(*buffer.data()));
+
+		// Act:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+		CacheStorageAdapter<AccountStateCache, AccountStateCacheStorage>(cache, 7).loadAll(stream, 10, *pPool);
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(50u, view->size());
+		for (const auto& pAccountState : accountStates) {
+			ASSERT_TRUE(view->contains(pAccountState->Address));
+			test::AssertEqual(*pAccountState, view->get(pAccountState->Address));
+
+			auto isKeyKnown = Height(0) != pAccountState->PublicKeyHeight;
+			EXPECT_EQ(isKeyKnown, view->contains(pAccountState->PublicKey));
+		}
+	}
+
+	// endregion
 }}
@@ -899,6 +899,66 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region addAccount (AccountState)
+
+	TEST(TEST_CLASS, CanAddAccountViaAccountStateWithoutPublicKey) {
+		// Arrange: note that public key height is 0
+		auto info = CreateInconsistentAccountInfo();
+		info.PublicKeyHeight = Height(0);
+		auto pAccountState = std::make_shared<state::AccountState>(state::ToAccountState(info));
+
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto delta = cache.createDelta();
+
+		// Act:
+		const auto& accountState = delta->addAccount(pAccountState);
+		const auto* pAccountStateFromAddress = AddressTraits::TryGet(*delta, info.Address);
+		const auto* pAccountStateFromKey = PublicKeyTraits::TryGet(*delta, info.PublicKey);
+
+		// Assert: state is inserted without copy and is only accessible by address because public key height is 0
+		EXPECT_EQ(pAccountState.get(), &accountState);
+		EXPECT_EQ(pAccountState.get(), pAccountStateFromAddress);
+		EXPECT_FALSE(!!pAccountStateFromKey);
+	}
+
+	TEST(TEST_CLASS, CanAddAccountViaAccountStateWithPublicKey) {
+		// Arrange: note that public key height is not 0
+		auto info = CreateInconsistentAccountInfo();
+		auto pAccountState = std::make_shared<state::AccountState>(state::ToAccountState(info));
+
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto delta = cache.createDelta();
+
+		// Act:
+		const auto& accountState = delta->addAccount(pAccountState);
+		const auto* pAccountStateFromAddress = AddressTraits::TryGet(*delta, info.Address);
+		const auto* pAccountStateFromKey = PublicKeyTraits::TryGet(*delta, info.PublicKey);
+
+		// Assert: state is inserted without copy and is accessible by address and public key
+		EXPECT_EQ(pAccountState.get(), &accountState);
+		EXPECT_EQ(pAccountState.get(), pAccountStateFromAddress);
+		EXPECT_EQ(pAccountState.get(), pAccountStateFromKey);
+	}
+
+	TEST(TEST_CLASS, AddAccountViaAccountStateDoesNotOverrideKnownAccounts) {
+		// Arrange:
+		auto info = CreateRandomAccountInfoWithKey();
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto delta = cache.createDelta();
+		const auto& addState1 = delta->addAccount(info);
+
+		// Act: add another state with the same address
+		auto pAccountState = std::make_shared<state::AccountState>(state::ToAccountState(info));
+		const auto& addState2 = delta->addAccount(pAccountState);
+
+		// Assert: the second add had no effect
+		EXPECT_EQ(&addState1, &addState2);
+		EXPECT_EQ(&addState1, delta->tryGet(info.Address));
+		EXPECT_NE(pAccountState.get(), &addState2);
+	}
+
+	// endregion
+
 	// region highValueAddresses
 
 	namespace {
@@ -93,6 +93,7 @@ namespace catapult { namespace chain {
 			std::shared_ptr<MockPacketIo> pIo;
 			std::shared_ptr<MockChainApi> pChainApi;
 			size_t BlockRangeConsumerCalls;
+			std::vector<Height> ConsumedRangeStartHeights;
 			ChainSynchronizerConfiguration Config;
 			disruptor::ProcessingCompleteFunc ProcessingComplete;
 		};
@@ -104,8 +105,9 @@ namespace catapult { namespace chain {
 			auto pLocal = std::make_shared<MockChainApi>(context.LocalScore, std::move(pVerifiableBlock), context.LocalHashes);
 
 			auto& blockConsumerCalls = context.BlockRangeConsumerCalls;
-			auto blockRangeConsumer = [mode, &blockConsumerCalls, &context](const auto&, const auto& processingComplete) {
+			auto blockRangeConsumer = [mode, &blockConsumerCalls, &context](const auto& range, const auto& processingComplete) {
 				++blockConsumerCalls;
+				context.ConsumedRangeStartHeights.push_back(range.cbegin()->Height);
 				context.ProcessingComplete = processingComplete;
 				return ConsumerMode::Normal == mode ? blockConsumerCalls : 0;
 			};
@@ -580,6 +582,164 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region pipelining
+
+	namespace {
+		void AssertRequests(const TestContext& context, const std::vector<std::pair<Height, uint32_t>>& expectedRequests) {
+			ASSERT_EQ(expectedRequests.size(), context.pChainApi->blocksFromRequests().size());
+
+			auto i = 0u;
+			for (const auto& expectedRequest : expectedRequests) {
+				const auto& params = context.pChainApi->blocksFromRequests()[i];
+				EXPECT_EQ(expectedRequest.first, params.first) << "height of request " << i;
+				EXPECT_EQ(expectedRequest.second, params.second.NumBlocks) << "NumBlocks of request " << i;
+				++i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, ChainComparisonIsNotPipelined) {
+		// Arrange:
+		auto context = CreateTestContextForUnprocessedElementTests();
+		context.Config.MaxPendingBlockRequests = 3;
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto result = synchronizer(*context.pChainApi).get();
+
+		// Assert: only a single range was pulled
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertSync(context, 1);
+		AssertRequestHeights(context, { Default_Height });
+	}
+
+	TEST(TEST_CLASS, MultipleBlockRequestsArePipelinedWhenExtendingChain) {
+		// Arrange: each request asks for 9 (max rollback) blocks and the remote returns full ranges
+		auto context = CreateTestContextForUnprocessedElementTests();
+		context.Config.MaxPendingBlockRequests = 3;
+		context.pChainApi->setNumBlocksPerBlocksFromRequest({ 2, 9 });
+		auto synchronizer = CreateSynchronizer(context);
+		synchronizer(*context.pChainApi).get();
+
+		// Act:
+		auto result1 = synchronizer(*context.pChainApi).get();
+		auto result2 = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result1);
+		EXPECT_EQ(NodeInteractionResult::Success, result2);
+		AssertSync(context, 7);
+
+		auto height = [](auto delta) { return Default_Height + Height(delta); };
+		EXPECT_EQ(
+				std::vector<Height>({ height(0), height(2), height(11), height(20), height(29), height(38), height(47) }),
+				context.ConsumedRangeStartHeights);
+		AssertRequests(context, {
+			{ height(0), 9 },
+			{ height(2), 9 }, { height(11), 9 }, { height(20), 9 },
+			{ height(29), 9 }, { height(38), 9 }, { height(47), 9 }
+		});
+	}
+
+	TEST(TEST_CLASS, RangesFollowingShortResponseAreBufferedUntilMissingBlocksArePulled) {
+		// Arrange: the first pipelined request returns a short range, leaving a hole at heights 27 - 30
+		auto context = CreateTestContextForUnprocessedElementTests();
+		context.Config.MaxPendingBlockRequests = 2;
+		context.pChainApi->setNumBlocksPerBlocksFromRequest({ 2, 5, 9, 4, 9 });
+		auto synchronizer = CreateSynchronizer(context);
+		synchronizer(*context.pChainApi).get();
+
+		// Act:
+		auto result1 = synchronizer(*context.pChainApi).get();
+		auto numConsumerCallsAfterFirstPull = context.BlockRangeConsumerCalls;
+		auto result2 = synchronizer(*context.pChainApi).get();
+
+		// Assert: range starting at 31 is only forwarded after the hole has been filled
+		EXPECT_EQ(NodeInteractionResult::Success, result1);
+		EXPECT_EQ(NodeInteractionResult::Success, result2);
+		EXPECT_EQ(2u, numConsumerCallsAfterFirstPull);
+		AssertSync(context, 5);
+
+		auto height = [](auto delta) { return Default_Height + Height(delta); };
+		EXPECT_EQ(std::vector<Height>({ height(0), height(2), height(7), height(11), height(20) }), context.ConsumedRangeStartHeights);
+		AssertRequests(context, {
+			{ height(0), 9 },
+			{ height(2), 9 }, { height(11), 9 },
+			{ height(7), 4 }, { height(20), 9 }
+		});
+	}
+
+	TEST(TEST_CLASS, SpeculativeRequestsAreDiscardedWhenRemoteRunsOutOfBlocks) {
+		// Arrange:
+		auto context = CreateTestContextForUnprocessedElementTests();
+		context.Config.MaxPendingBlockRequests = 3;
+		context.pChainApi->setNumBlocksPerBlocksFromRequest({ 2, 0, 9, 9, 2 });
+		auto synchronizer = CreateSynchronizer(context);
+		synchronizer(*context.pChainApi).get();
+
+		// Act:
+		auto result1 = synchronizer(*context.pChainApi).get();
+		auto result2 = synchronizer(*context.pChainApi).get();
+
+		// Assert: all ranges returned for the discarded requests are ignored and pulling restarts at the first empty height
+		EXPECT_EQ(NodeInteractionResult::Neutral, result1);
+		EXPECT_EQ(NodeInteractionResult::Success, result2);
+		AssertSync(context, 2);
+
+		auto height = [](auto delta) { return Default_Height + Height(delta); };
+		EXPECT_EQ(std::vector<Height>({ height(0), height(2) }), context.ConsumedRangeStartHeights);
+		AssertRequests(context, {
+			{ height(0), 9 },
+			{ height(2), 9 }, { height(11), 9 }, { height(20), 9 },
+			{ height(2), 9 }, { height(11), 9 }, { height(20), 9 }
+		});
+	}
+
+	TEST(TEST_CLASS, FailedPipelinedRequestDiscardsSpeculativeRequests) {
+		// Arrange:
+		auto context = CreateTestContextForUnprocessedElementTests();
+		context.Config.MaxPendingBlockRequests = 2;
+		auto synchronizer = CreateSynchronizer(context);
+		synchronizer(*context.pChainApi).get();
+
+		// Act: fail the pipelined requests and then retry
+		context.pChainApi->setError(MockChainApi::EntryPoint::Blocks_From);
+		auto result1 = synchronizer(*context.pChainApi).get();
+		context.pChainApi->setError(MockChainApi::EntryPoint::None);
+		auto result2 = synchronizer(*context.pChainApi).get();
+
+		// Assert: the retry restarts at the first failed height
+		EXPECT_EQ(NodeInteractionResult::Failure, result1);
+		EXPECT_EQ(NodeInteractionResult::Success, result2);
+		AssertSync(context, 2);
+
+		auto height = [](auto delta) { return Default_Height + Height(delta); };
+		AssertRequestHeights(context, { height(0), height(2), height(11), height(2), height(11) });
+	}
+
+	TEST(TEST_CLASS, PendingBlockRequestsAreLimitedAcrossSyncs) {
+		// Arrange:
+		auto context = CreateTestContextForUnprocessedElementTests();
+		context.Config.MaxPendingBlockRequests = 2;
+		auto synchronizer = CreateSynchronizer(context);
+		synchronizer(*context.pChainApi).get();
+
+		// Act: start two delayed syncs
+		context.pChainApi->setDelay(utils::TimeSpan::FromMilliseconds(10));
+		auto syncFuture1 = synchronizer(*context.pChainApi);
+		auto syncFuture2 = synchronizer(*context.pChainApi);
+
+		auto result1 = syncFuture1.get();
+		auto result2 = syncFuture2.get();
+
+		// Assert: the first sync used all available request slots, so the second was bypassed
+		EXPECT_EQ(NodeInteractionResult::Success, result1);
+		EXPECT_EQ(NodeInteractionResult::Neutral, result2);
+		AssertRequestHeights(context, { Default_Height, Default_Height + Height(2), Default_Height + Height(11) });
+	}
+
+	// endregion
+
 	// region recoverability
 
 	namespace {
@@ -0,0 +1,229 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/chain/NotificationUndoLog.h"
+#include "catapult/cache/CatapultCache.h"
+#include "tests/test/core/NotificationTestUtils.h"
+#include "tests/test/other/mocks/MockNotificationObserver.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS NotificationUndoLogTests
+
+	namespace {
+		constexpr auto MakeTestNotificationType(uint16_t code) {
+			return model::MakeNotificationType(model::NotificationChannel::All, static_cast<model::FacilityCode>(0), code);
+		}
+
+		constexpr auto Notification_Type_1 = MakeTestNotificationType(1);
+		constexpr auto Notification_Type_2 = MakeTestNotificationType(2);
+		constexpr auto Notification_Type_3 = MakeTestNotificationType(3);
+
+		class TestContext {
+		public:
+			TestContext()
+					: m_cache({})
+					, m_cacheDelta(m_cache.createDelta())
+					, m_observerContext(m_cacheDelta, m_state, Height(123), observers::NotifyMode::Rollback)
+			{}
+
+		public:
+			NotificationUndoLog& undoLog() {
+				return m_undoLog;
+			}
+
+			const auto& observer() const {
+				return m_observer;
+			}
+
+			void rollback(NotificationUndoLog::Savepoint savepoint) {
+				m_undoLog.rollback(savepoint, m_observer, m_observerContext);
+			}
+
+		public:
+			void assertObserverCalls(const std::vector<model::NotificationType>& expectedTypes) const {
+				// Assert:
+				ASSERT_EQ(expectedTypes.size(), m_observer.notificationTypes().size());
+
+				for (auto i = 0u; i < expectedTypes.size(); ++i) {
+					auto message = "observer notification at " + std::to_string(i);
+					EXPECT_EQ(expectedTypes[i], m_observer.notificationTypes()[i]) << message;
+					EXPECT_EQ(&m_observerContext, m_observer.contextPointers()[i]) << message;
+				}
+			}
+
+		private:
+			mocks::MockNotificationObserver m_observer;
+			NotificationUndoLog m_undoLog;
+
+			cache::CatapultCache m_cache;
+			cache::CatapultCacheDelta m_cacheDelta;
+			state::CatapultState m_state;
+			observers::ObserverContext m_observerContext;
+		};
+
+		void RecordAll(NotificationUndoLog& undoLog, const std::vector<model::NotificationType>& types) {
+			for (auto type : types)
+				undoLog.record(test::CreateNotification(type));
+		}
+	}
+
+	// region record
+
+	TEST(TEST_CLASS, LogIsInitiallyEmpty) {
+		// Act:
+		NotificationUndoLog undoLog;
+
+		// Assert:
+		EXPECT_EQ(0u, undoLog.size());
+		EXPECT_EQ(0u, undoLog.savepoint());
+	}
+
+	TEST(TEST_CLASS, CanRecordNotifications) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		RecordAll(context.undoLog(), { Notification_Type_1, Notification_Type_2, Notification_Type_3 });
+
+		// Assert: notifications are recorded but not observed
+		EXPECT_EQ(3u, context.undoLog().size());
+		EXPECT_EQ(3u, context.undoLog().savepoint());
+		context.assertObserverCalls({});
+	}
+
+	// endregion
+
+	// region rollback
+
+	TEST(TEST_CLASS, CanRollbackAllNotifications) {
+		// Arrange:
+		TestContext context;
+		RecordAll(context.undoLog(), { Notification_Type_1, Notification_Type_2, Notification_Type_3 });
+
+		// Act:
+		context.rollback(0);
+
+		// Assert: notifications are undone in reverse order
+		EXPECT_EQ(0u, context.undoLog().size());
+		context.assertObserverCalls({ Notification_Type_3, Notification_Type_2, Notification_Type_1 });
+	}
+
+	TEST(TEST_CLASS, CanRollbackToIntermediateSavepoint) {
+		// Arrange:
+		TestContext context;
+		RecordAll(context.undoLog(), { Notification_Type_1 });
+		auto savepoint = context.undoLog().savepoint();
+		RecordAll(context.undoLog(), { Notification_Type_2, Notification_Type_3 });
+
+		// Act:
+		context.rollback(savepoint);
+
+		// Assert: only notifications after the savepoint are undone
+		EXPECT_EQ(1u, context.undoLog().size());
+		context.assertObserverCalls({ Notification_Type_3, Notification_Type_2 });
+	}
+
+	TEST(TEST_CLASS, RollbackToEndOfLogHasNoEffect) {
+		// Arrange:
+		TestContext context;
+		RecordAll(context.undoLog(), { Notification_Type_1, Notification_Type_2 });
+
+		// Act:
+		context.rollback(2);
+
+		// Assert:
+		EXPECT_EQ(2u, context.undoLog().size());
+		context.assertObserverCalls({});
+	}
+
+	TEST(TEST_CLASS, CannotRollbackBeyondEndOfLog) {
+		// Arrange:
+		TestContext context;
+		RecordAll(context.undoLog(), { Notification_Type_1, Notification_Type_2 });
+
+		// Act + Assert:
+		EXPECT_THROW(context.rollback(3), catapult_invalid_argument);
+		EXPECT_EQ(2u, context.undoLog().size());
+		context.assertObserverCalls({});
+	}
+
+	TEST(TEST_CLASS, CanRollbackNotificationsWithVaryingSizes) {
+		// Arrange:
+		TestContext context;
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		auto notification1 = model::AccountPublicKeyNotification(signer);
+		auto notification2 = test::CreateNotification(Notification_Type_1);
+		auto notification3 = model::TransactionNotification(signer, hash, model::EntityType(22), Timestamp(11));
+
+		context.undoLog().record(notification1);
+		context.undoLog().record(notification2);
+		context.undoLog().record(notification3);
+
+		// Act:
+		context.rollback(0);
+
+		// Assert: data integrity is preserved
+		const auto& hashes = context.observer().notificationHashes();
+		ASSERT_EQ(3u, hashes.size());
+		EXPECT_EQ(test::CalculateNotificationHash(notification3), hashes[0]);
+		EXPECT_EQ(test::CalculateNotificationHash(notification2), hashes[1]);
+		EXPECT_EQ(test::CalculateNotificationHash(notification1), hashes[2]);
+		EXPECT_EQ(std::vector<Key>({ signer }), context.observer().accountKeys());
+	}
+
+	TEST(TEST_CLASS, CanRecordAndRollbackAfterRollback) {
+		// Arrange:
+		TestContext context;
+		RecordAll(context.undoLog(), { Notification_Type_1, Notification_Type_2 });
+		context.rollback(1);
+
+		// Act:
+		RecordAll(context.undoLog(), { Notification_Type_3 });
+		context.rollback(0);
+
+		// Assert: the storage of the undone notification was reused
+		EXPECT_EQ(0u, context.undoLog().size());
+		context.assertObserverCalls({ Notification_Type_2, Notification_Type_3, Notification_Type_1 });
+	}
+
+	// endregion
+
+	// region clear
+
+	TEST(TEST_CLASS, ClearRemovesNotificationsWithoutUndoingThem) {
+		// Arrange:
+		TestContext context;
+		RecordAll(context.undoLog(), { Notification_Type_1, Notification_Type_2 });
+
+		// Act:
+		context.undoLog().clear();
+		context.rollback(0);
+
+		// Assert:
+		EXPECT_EQ(0u, context.undoLog().size());
+		context.assertObserverCalls({});
+	}
+
+	// endregion
+}}
@@ -60,6 +60,10 @@ namespace catapult { namespace chain {
 				return m_sub;
 			}
 
+			ProcessingNotificationSubscriber createSub() {
+				return ProcessingNotificationSubscriber(m_validator, m_validatorContext, m_observer, m_observerContext);
+			}
+
 			void setValidationResult(ValidationResult result) {
 				m_validator.setResult(result);
 			}
@@ -492,4 +496,63 @@ namespace catapult { namespace chain {
 			Notification_Type_All_3, Notification_Type_All_2
 		}, 3);
 	}
+	// region external undo log
+
+	TEST(TEST_CLASS, CanUndoNotificationsUsingExternalUndoLog) {
+		// Arrange:
+		TestContext context;
+		NotificationUndoLog undoLog;
+		context.sub().enableUndo(undoLog);
+		auto notification1 = test::CreateNotification(Notification_Type_All);
+		auto notification2 = test::CreateNotification(Notification_Type_All_2);
+
+		// - process notifications
+		context.sub().notify(notification1);
+		context.sub().notify(notification2);
+
+		// Sanity: notifications were recorded in the external log
+		EXPECT_EQ(2u, undoLog.size());
+
+		// Act: undo notifications
+		context.sub().undo();
+
+		// Assert:
+		EXPECT_EQ(0u, undoLog.size());
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({ Notification_Type_All, Notification_Type_All_2 });
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_All_2, Notification_Type_All_2, Notification_Type_All }, 2);
+	}
+
+	TEST(TEST_CLASS, UndoOnlyUndoesNotificationsRecordedInExternalUndoLogAfterEnablingUndo) {
+		// Arrange: record a notification with a different subscriber
+		TestContext context;
+		NotificationUndoLog undoLog;
+		auto notification1 = test::CreateNotification(Notification_Type_All);
+		auto notification2 = test::CreateNotification(Notification_Type_All_2);
+		auto notification3 = test::CreateNotification(Notification_Type_All_3);
+		{
+			auto sub = context.createSub();
+			sub.enableUndo(undoLog);
+			sub.notify(notification1);
+		}
+
+		// - process notifications
+		context.sub().enableUndo(undoLog);
+		context.sub().notify(notification2);
+		context.sub().notify(notification3);
+
+		// Act: undo notifications
+		context.sub().undo();
+
+		// Assert: the notification recorded by the other subscriber is not undone
+		EXPECT_EQ(1u, undoLog.size());
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({ Notification_Type_All, Notification_Type_All_2, Notification_Type_All_3 });
+		context.assertObserverCalls({
+			Notification_Type_All, Notification_Type_All_2, Notification_Type_All_3,
+			Notification_Type_All_3, Notification_Type_All_2
+		}, 3);
+	}
+
+	// endregion
 }}
@@ -19,7 +19,9 @@
 **/
 
 #include "catapult/chain/RemoteApiForwarder.h"
+#include "tests/test/core/PacketTestUtils.h"
 #include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/test/net/NodeTestUtils.h"
 #include "tests/test/net/mocks/MockPacketWriters.h"
 #include "tests/TestHarness.h"
 
@@ -109,4 +111,101 @@ namespace catapult { namespace chain {
 		EXPECT_EQ(1u, capture.NumActionCalls);
 		EXPECT_EQ(Default_Action_Api_Id, capture.ActionApiId);
 	}
+
+	// region metrics
+
+	namespace {
+		struct MetricsConsumerCapture {
+			size_t NumCalls = 0;
+			Key IdentityKey;
+			ionet::PacketIoMetrics Metrics;
+		};
+
+		RemoteApiForwarder::InteractionMetricsConsumer CreateMetricsConsumer(MetricsConsumerCapture& capture) {
+			return [&capture](const auto& node, const auto& metrics) {
+				++capture.NumCalls;
+				capture.IdentityKey = node.identityKey();
+				capture.Metrics = metrics;
+			};
+		}
+
+		template<typename TAction>
+		thread::future<NodeInteractionResult> ProcessSyncWithPacketIoAction(RemoteApiForwarder& forwarder, TAction action) {
+			return forwarder.processSync(
+				[action](auto* pPacketIo) {
+					action(*pPacketIo);
+					return thread::make_ready_future(NodeInteractionResult::Success);
+				},
+				[](auto& packetIo, const auto&) {
+					return std::make_unique<ionet::PacketIo*>(&packetIo);
+				});
+		}
+	}
+
+	TEST(TEST_CLASS, FactoryIsPassedMeteredPacketIoWhenMetricsConsumerIsSet) {
+		// Arrange:
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		mocks::PickOneAwareMockPacketWriters writers;
+		writers.setPacketIo(pPacketIo);
+
+		// - create the forwarder
+		model::TransactionRegistry registry;
+		MetricsConsumerCapture metricsCapture;
+		auto metricsConsumer = CreateMetricsConsumer(metricsCapture);
+		RemoteApiForwarder forwarder(writers, registry, utils::TimeSpan::FromSeconds(4), "test", metricsConsumer);
+
+		// Act:
+		ProcessSyncParamsCapture capture;
+		auto result = ProcessSyncAndCapture(forwarder, capture).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+
+		// - factory was called with a decorator
+		EXPECT_EQ(1u, capture.NumFactoryCalls);
+		EXPECT_NE(pPacketIo.get(), capture.pFactoryPacketIo);
+		EXPECT_TRUE(!!dynamic_cast<const ionet::MeteredPacketIo*>(capture.pFactoryPacketIo));
+
+		// - action was called but metrics consumer was not (no round trips)
+		EXPECT_EQ(1u, capture.NumActionCalls);
+		EXPECT_EQ(0u, metricsCapture.NumCalls);
+	}
+
+	TEST(TEST_CLASS, MetricsConsumerIsCalledWhenInteractionCompletesRoundTrip) {
+		// Arrange:
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		auto pPacket = test::CreateRandomPacket(100, ionet::PacketType::Undefined);
+		pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+		pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+		auto node = test::CreateNamedNode(test::GenerateRandomData<Key_Size>(), "alice");
+		mocks::PickOneAwareMockPacketWriters writers;
+		writers.setPacketIo(pPacketIo);
+		writers.setNode(node);
+
+		// - create the forwarder
+		model::TransactionRegistry registry;
+		MetricsConsumerCapture metricsCapture;
+		auto metricsConsumer = CreateMetricsConsumer(metricsCapture);
+		RemoteApiForwarder forwarder(writers, registry, utils::TimeSpan::FromSeconds(4), "test", metricsConsumer);
+
+		// Act: write a request and read a response
+		auto result = ProcessSyncWithPacketIoAction(forwarder, [](auto& packetIo) {
+			packetIo.write(ionet::PacketPayload(ionet::PacketType::Undefined), [](auto) {});
+			packetIo.read([](auto, const auto*) {});
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(1u, pPacketIo->numWrites());
+		EXPECT_EQ(1u, pPacketIo->numReads());
+
+		// - metrics consumer was called
+		ASSERT_EQ(1u, metricsCapture.NumCalls);
+		EXPECT_EQ(node.identityKey(), metricsCapture.IdentityKey);
+		EXPECT_EQ(1u, metricsCapture.Metrics.NumRoundTrips);
+		EXPECT_EQ(sizeof(ionet::PacketHeader) + 100, metricsCapture.Metrics.NumBytesRead);
+	}
+
+	// endregion
 }}
@@ -23,8 +23,10 @@
 #include "catapult/cache/MemoryUtCache.h"
 #include "catapult/chain/ChainResults.h"
 #include "catapult/model/TransactionStatus.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/catapult/chain/test/MockExecutionConfiguration.h"
 #include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -115,7 +117,9 @@ namespace catapult { namespace chain {
 
 		class UpdaterTestContext {
 		public:
-			explicit UpdaterTestContext(ThrottleMode throttleMode = ThrottleMode::Off)
+			explicit UpdaterTestContext(
+					ThrottleMode throttleMode = ThrottleMode::Off,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool = nullptr)
 					: m_cache(CreateCacheWithDefaultHeight())
 					, m_transactionsCache(cache::MemoryCacheOptions(1024, 1000))
 					, m_updater(
@@ -130,7 +134,8 @@ namespace catapult { namespace chain {
 							[this, throttleMode](const auto& transactionInfo, const auto& context) {
 								m_throttleParams.emplace_back(transactionInfo, context);
 								return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
-							})
+							},
+							pPool)
 			{}
 
 		public:
@@ -146,6 +151,18 @@ namespace catapult { namespace chain {
 				m_executionConfig.pValidator->setResult(result, hash, id);
 			}
 
+			const auto& validatorParams() const {
+				return m_executionConfig.pValidator->params();
+			}
+
+			const auto& observerParams() const {
+				return m_executionConfig.pObserver->params();
+			}
+
+			const auto& failedTransactionStatuses() const {
+				return m_failedTransactionStatuses;
+			}
+
 			void setPartialUndoFailureIndexes(const std::unordered_set<size_t>& partialUndoFailureIndexes) {
 				m_partialUndoFailureIndexes = partialUndoFailureIndexes;
 			}
@@ -963,4 +980,157 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region pre-validation
+
+	namespace {
+		std::shared_ptr<thread::IoServiceThreadPool> CreatePrevalidationPool() {
+			// notice that a single thread is used because the mock validator is not thread safe
+			return test::CreateStartedIoServiceThreadPool(1);
+		}
+
+		size_t CountValidations(const UpdaterTestContext& context, const Hash256& hash, size_t id) {
+			const auto& params = context.validatorParams();
+			return static_cast<size_t>(std::count_if(params.cbegin(), params.cend(), [&hash, id](const auto& validateParams) {
+				return hash == validateParams.HashCopy && id == validateParams.SequenceId;
+			}));
+		}
+
+		void SetExtractedAddresses(model::TransactionInfo& transactionInfo, const model::AddressSet& addresses) {
+			transactionInfo.OptionalExtractedAddresses = std::make_shared<model::AddressSet>(addresses);
+		}
+	}
+
+	NEW_TRANSACTIONS_TRAITS_BASED_TEST(TransactionsThatFailPrevalidationAreNotExecuted) {
+		// Arrange:
+		UpdaterTestContext context(ThrottleMode::Off, CreatePrevalidationPool());
+		auto transactionData = CreateTransactionData(6);
+
+		// - set failures for 2 / 6 entities
+		context.setValidationResult(ValidationResult::Failure, transactionData.Hashes[1], 1);
+		context.setValidationResult(Modify(ValidationResult::Failure), transactionData.Hashes[4], 1);
+
+		// Act:
+		TTraits::Update(context.updater(), transactionData.UtInfos);
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 0, 2, 3, 5 }));
+
+		// - failed entities are only pre-validated
+		for (auto i = 0u; i < transactionData.Hashes.size(); ++i) {
+			auto isFailure = 1 == i || 4 == i;
+			EXPECT_EQ(isFailure ? 1u : 2u, CountValidations(context, transactionData.Hashes[i], 1)) << "entity " << i;
+			EXPECT_EQ(isFailure ? 0u : 1u, CountValidations(context, transactionData.Hashes[i], 2)) << "entity " << i;
+		}
+
+		// - observer only gets called for entities that pass validation
+		EXPECT_EQ(8u, context.observerParams().size());
+
+		const auto& failedStatuses = context.failedTransactionStatuses();
+		ASSERT_EQ(2u, failedStatuses.size());
+		EXPECT_EQ(transactionData.Hashes[1], failedStatuses[0].Hash);
+		EXPECT_EQ(utils::to_underlying_type(ValidationResult::Failure), failedStatuses[0].Status);
+		EXPECT_EQ(transactionData.Hashes[4], failedStatuses[1].Hash);
+		EXPECT_EQ(utils::to_underlying_type(Modify(ValidationResult::Failure)), failedStatuses[1].Status);
+	}
+
+	NEW_TRANSACTIONS_TRAITS_BASED_TEST(PrevalidationStopsAtFirstObservedNotification) {
+		// Arrange:
+		UpdaterTestContext context(ThrottleMode::Off, CreatePrevalidationPool());
+		auto transactionData = CreateTransactionData(6);
+
+		// - set failures for 2 / 6 entities so that one notification from the entity is observed
+		context.setValidationResult(ValidationResult::Failure, transactionData.Hashes[1], 2);
+		context.setValidationResult(ValidationResult::Failure, transactionData.Hashes[4], 2);
+
+		// Act:
+		TTraits::Update(context.updater(), transactionData.UtInfos);
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 0, 2, 3, 5 }));
+
+		// - second notification is never pre-validated, so all entities are executed
+		for (auto i = 0u; i < transactionData.Hashes.size(); ++i) {
+			EXPECT_EQ(2u, CountValidations(context, transactionData.Hashes[i], 1)) << "entity " << i;
+			EXPECT_EQ(1u, CountValidations(context, transactionData.Hashes[i], 2)) << "entity " << i;
+		}
+
+		// - observer (rollback) gets called for entities that fail validation
+		EXPECT_EQ(4u * 2 + 2u * 2, context.observerParams().size());
+		EXPECT_EQ(2u, context.failedTransactionStatuses().size());
+	}
+
+	NEW_TRANSACTIONS_TRAITS_BASED_TEST(TransactionsThatArePrevalidatedAsNeutralAreExecuted) {
+		// Arrange:
+		UpdaterTestContext context(ThrottleMode::Off, CreatePrevalidationPool());
+		auto transactionData = CreateTransactionData(3);
+		context.setValidationResult(ValidationResult::Neutral, transactionData.Hashes[1], 1);
+
+		// Act:
+		TTraits::Update(context.updater(), transactionData.UtInfos);
+
+		// Assert: neutral entity was pre-validated and executed
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 0, 2 }));
+
+		EXPECT_EQ(2u, CountValidations(context, transactionData.Hashes[1], 1));
+		EXPECT_EQ(0u, context.failedTransactionStatuses().size());
+	}
+
+	NEW_TRANSACTIONS_TRAITS_BASED_TEST(PrevalidationFailuresInvolvingAppliedAddressesAreRevalidated) {
+		// Arrange:
+		UpdaterTestContext context(ThrottleMode::Off, CreatePrevalidationPool());
+		auto transactionData = CreateTransactionData(4);
+
+		// - second entity shares an address with (successful) first entity
+		// - fourth entity shares an address with (failed) third entity
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		SetExtractedAddresses(transactionData.UtInfos[0], { addresses[0] });
+		SetExtractedAddresses(transactionData.UtInfos[1], { addresses[0], addresses[1] });
+		SetExtractedAddresses(transactionData.UtInfos[2], { addresses[2] });
+		SetExtractedAddresses(transactionData.UtInfos[3], { addresses[2] });
+		for (auto i = 1u; i < 4; ++i)
+			context.setValidationResult(ValidationResult::Failure, transactionData.Hashes[i], 1);
+
+		// Act:
+		TTraits::Update(context.updater(), transactionData.UtInfos);
+
+		// Assert:
+		EXPECT_EQ(1u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 0 }));
+
+		// - only the entity conflicting with an applied entity was revalidated
+		EXPECT_EQ(2u, CountValidations(context, transactionData.Hashes[0], 1));
+		EXPECT_EQ(2u, CountValidations(context, transactionData.Hashes[1], 1));
+		EXPECT_EQ(1u, CountValidations(context, transactionData.Hashes[2], 1));
+		EXPECT_EQ(1u, CountValidations(context, transactionData.Hashes[3], 1));
+		EXPECT_EQ(3u, context.failedTransactionStatuses().size());
+	}
+
+	TEST(TEST_CLASS, OriginalTransactionsThatFailPrevalidationAreNotExecuted) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context(ThrottleMode::Off, CreatePrevalidationPool());
+		auto originalTransactionData = CreateTransactionData(6);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - set failures for 2 / 6 entities
+		context.setValidationResult(ValidationResult::Failure, originalTransactionData.Hashes[1], 1);
+		context.setValidationResult(ValidationResult::Failure, originalTransactionData.Hashes[4], 1);
+
+		// Act:
+		context.updater().update({}, {});
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalTransactionData.Hashes, { 0, 2, 3, 5 }));
+
+		EXPECT_EQ(1u, CountValidations(context, originalTransactionData.Hashes[1], 1));
+		EXPECT_EQ(1u, CountValidations(context, originalTransactionData.Hashes[4], 1));
+		EXPECT_EQ(8u, context.observerParams().size());
+		EXPECT_EQ(2u, context.failedTransactionStatuses().size());
+	}
+
+	// endregion
 }}
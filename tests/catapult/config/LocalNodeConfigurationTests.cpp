@@ -72,12 +72,15 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.ShouldAllowAddressReuse);
 			EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 			EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+			EXPECT_FALSE(config.ShouldUseMemoryMappedBlockStorage);
+			EXPECT_FALSE(config.ShouldUseSegmentedBlockStorage);
 
 			EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
 			EXPECT_EQ(400u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(4u, config.MaxPendingBlockRequests);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -96,8 +99,10 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(4096u, config.BlockDisruptorSize);
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
+			EXPECT_EQ(disruptor::ConsumerWaitStrategy::Blocking, config.BlockDisruptorWaitStrategy);
 			EXPECT_EQ(16384u, config.TransactionDisruptorSize);
 			EXPECT_EQ(10u, config.TransactionElementTraceInterval);
+			EXPECT_EQ(disruptor::ConsumerWaitStrategy::Blocking, config.TransactionDisruptorWaitStrategy);
 
 			EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 			EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
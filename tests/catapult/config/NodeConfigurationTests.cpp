@@ -38,12 +38,15 @@ namespace catapult { namespace config {
 							{ "shouldAllowAddressReuse", "true" },
 							{ "shouldUseSingleThreadPool", "true" },
 							{ "shouldUseCacheDatabaseStorage", "true" },
+							{ "shouldUseMemoryMappedBlockStorage", "true" },
+							{ "shouldUseSegmentedBlockStorage", "true" },
 
 							{ "shouldEnableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxPendingBlockRequests", "7" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -62,8 +65,10 @@ namespace catapult { namespace config {
 
 							{ "blockDisruptorSize", "1000" },
 							{ "blockElementTraceInterval", "34" },
+							{ "blockDisruptorWaitStrategy", "Busy_Spin" },
 							{ "transactionDisruptorSize", "9876" },
 							{ "transactionElementTraceInterval", "98" },
+							{ "transactionDisruptorWaitStrategy", "Blocking" },
 
 							{ "shouldAbortWhenDispatcherIsFull", "true" },
 							{ "shouldAuditDispatcherInputs", "true" },
@@ -119,12 +124,15 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.ShouldAllowAddressReuse);
 				EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 				EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_FALSE(config.ShouldUseMemoryMappedBlockStorage);
+				EXPECT_FALSE(config.ShouldUseSegmentedBlockStorage);
 
 				EXPECT_FALSE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxPendingBlockRequests);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -143,8 +151,10 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(0u, config.BlockDisruptorSize);
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
+				EXPECT_EQ(static_cast<disruptor::ConsumerWaitStrategy>(0), config.BlockDisruptorWaitStrategy);
 				EXPECT_EQ(0u, config.TransactionDisruptorSize);
 				EXPECT_EQ(0u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(static_cast<disruptor::ConsumerWaitStrategy>(0), config.TransactionDisruptorWaitStrategy);
 
 				EXPECT_FALSE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
@@ -175,12 +185,15 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.ShouldAllowAddressReuse);
 				EXPECT_TRUE(config.ShouldUseSingleThreadPool);
 				EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_TRUE(config.ShouldUseMemoryMappedBlockStorage);
+				EXPECT_TRUE(config.ShouldUseSegmentedBlockStorage);
 
 				EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(7u, config.MaxPendingBlockRequests);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -199,8 +212,10 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(1000u, config.BlockDisruptorSize);
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
+				EXPECT_EQ(disruptor::ConsumerWaitStrategy::Busy_Spin, config.BlockDisruptorWaitStrategy);
 				EXPECT_EQ(9876u, config.TransactionDisruptorSize);
 				EXPECT_EQ(98u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(disruptor::ConsumerWaitStrategy::Blocking, config.TransactionDisruptorWaitStrategy);
 
 				EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_TRUE(config.ShouldAuditDispatcherInputs);
@@ -21,6 +21,7 @@
 #include "catapult/consumers/BlockConsumers.h"
 #include "catapult/consumers/TransactionConsumers.h"
 #include "catapult/model/Address.h"
+#include "catapult/model/ExtractedAddressesCache.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
@@ -148,4 +149,145 @@ namespace catapult { namespace consumers {
 	}
 
 	// endregion
+
+	// region cached
+
+	namespace {
+		template<typename TTransactionElements>
+		void SetRandomHashes(TTransactionElements& transactionElements) {
+			for (auto& transactionElement : transactionElements) {
+				transactionElement.EntityHash = test::GenerateRandomData<Hash256_Size>();
+				transactionElement.MerkleComponentHash = test::GenerateRandomData<Hash256_Size>();
+			}
+		}
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CachedConsumerExtractsAndCachesAddresses) {
+		// Arrange:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+		model::ExtractedAddressesCache addressesCache(*pPublisher, 10);
+		auto input = test::CreateTransactionElements(3);
+		SetRandomHashes(static_cast<disruptor::TransactionElements&>(input));
+
+		// Act:
+		auto result = CreateTransactionAddressExtractionConsumer(addressesCache)(input);
+
+		// Assert:
+		test::AssertContinued(result);
+
+		auto i = 0u;
+		for (const auto& transactionElement : input)
+			AssertExtractedAddress(transactionElement, i++);
+
+		EXPECT_EQ(3u, addressesCache.size());
+		EXPECT_EQ(0u, addressesCache.statistics().NumHits);
+		EXPECT_EQ(3u, addressesCache.statistics().NumMisses);
+	}
+
+	TEST(BLOCK_TEST_CLASS, CachedConsumerExtractsAddressesWithoutCachingThem) {
+		// Arrange:
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(3, 10);
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+		model::ExtractedAddressesCache addressesCache(*pPublisher, 10);
+		auto input = test::CreateBlockElements({ pBlock.get() });
+		SetRandomHashes(input[0].Transactions);
+
+		// Act:
+		auto result = CreateBlockAddressExtractionConsumer(addressesCache)(input);
+
+		// Assert:
+		test::AssertContinued(result);
+
+		auto i = 0u;
+		for (const auto& transactionElement : input[0].Transactions)
+			AssertExtractedAddress(transactionElement, i++);
+
+		EXPECT_EQ(0u, addressesCache.size());
+		EXPECT_EQ(0u, addressesCache.statistics().NumHits);
+		EXPECT_EQ(3u, addressesCache.statistics().NumMisses);
+	}
+
+	TEST(BLOCK_TEST_CLASS, CachedConsumerReusesAddressesExtractedByCachedTransactionConsumer) {
+		// Arrange: create transaction elements for all transactions in a block
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(3, 10);
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+		model::ExtractedAddressesCache addressesCache(*pPublisher, 10);
+
+		auto blockInput = test::CreateBlockElements({ pBlock.get() });
+		auto& blockTransactionElements = blockInput[0].Transactions;
+		SetRandomHashes(blockTransactionElements);
+
+		std::vector<const model::Transaction*> transactions;
+		for (const auto& transactionElement : blockTransactionElements)
+			transactions.push_back(&transactionElement.Transaction);
+
+		auto transactionInput = test::CreateTransactionElements(transactions);
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			transactionInput[i].EntityHash = blockTransactionElements[i].EntityHash;
+			transactionInput[i].MerkleComponentHash = blockTransactionElements[i].MerkleComponentHash;
+		}
+
+		// - extract the addresses of the unconfirmed transactions
+		CreateTransactionAddressExtractionConsumer(addressesCache)(transactionInput);
+
+		// Act:
+		auto result = CreateBlockAddressExtractionConsumer(addressesCache)(blockInput);
+
+		// Assert: the addresses extracted for the unconfirmed transactions were reused and released
+		test::AssertContinued(result);
+
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			AssertExtractedAddress(blockTransactionElements[i], i);
+			EXPECT_EQ(transactionInput[i].OptionalExtractedAddresses, blockTransactionElements[i].OptionalExtractedAddresses) << i;
+		}
+
+		EXPECT_EQ(0u, addressesCache.size());
+		EXPECT_EQ(3u, addressesCache.statistics().NumHits);
+		EXPECT_EQ(3u, addressesCache.statistics().NumMisses);
+	}
+
+	TEST(BLOCK_TEST_CLASS, CachedConsumerDoesNotReuseAddressesOfTransactionWithSameEntityHashButDifferentMerkleComponentHash) {
+		// Arrange: create transaction elements for all transactions in a block
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(3, 10);
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto pPublisher = model::CreateNotificationPublisher(registry, model::PublicationMode::Basic);
+		model::ExtractedAddressesCache addressesCache(*pPublisher, 10);
+
+		auto blockInput = test::CreateBlockElements({ pBlock.get() });
+		auto& blockTransactionElements = blockInput[0].Transactions;
+		SetRandomHashes(blockTransactionElements);
+
+		std::vector<const model::Transaction*> transactions;
+		for (const auto& transactionElement : blockTransactionElements)
+			transactions.push_back(&transactionElement.Transaction);
+
+		// - simulate unconfirmed aggregates that have the same entity hashes but different cosigners
+		auto transactionInput = test::CreateTransactionElements(transactions);
+		SetRandomHashes(static_cast<disruptor::TransactionElements&>(transactionInput));
+		for (auto i = 0u; i < transactions.size(); ++i)
+			transactionInput[i].EntityHash = blockTransactionElements[i].EntityHash;
+
+		// - extract the addresses of the unconfirmed transactions
+		CreateTransactionAddressExtractionConsumer(addressesCache)(transactionInput);
+
+		// Act:
+		auto result = CreateBlockAddressExtractionConsumer(addressesCache)(blockInput);
+
+		// Assert: the addresses extracted for the unconfirmed transactions were neither reused nor released
+		test::AssertContinued(result);
+
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			AssertExtractedAddress(blockTransactionElements[i], i);
+			EXPECT_NE(transactionInput[i].OptionalExtractedAddresses, blockTransactionElements[i].OptionalExtractedAddresses) << i;
+		}
+
+		EXPECT_EQ(3u, addressesCache.size());
+		EXPECT_EQ(0u, addressesCache.statistics().NumHits);
+		EXPECT_EQ(6u, addressesCache.statistics().NumMisses);
+	}
+
+	// endregion
 }}
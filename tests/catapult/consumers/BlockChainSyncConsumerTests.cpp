@@ -729,6 +729,118 @@ namespace catapult { namespace consumers {
 		context.assertStored(input, model::ChainScore(2));
 	}
 
+	// region successful syncs - undo journal
+
+	namespace {
+		void SeedStorageAndCache(ConsumerTestContext& context, Height height) {
+			// seed the storage and mark the cache as being at the same height
+			context.seedStorage(height);
+			auto delta = context.Cache.createDelta();
+			context.Cache.commit(height);
+		}
+
+		void SyncCompatibleChain(ConsumerTestContext& context, std::vector<ConsumerInput>& inputs, Height startHeight, uint32_t numBlocks) {
+			inputs.push_back(CreateInput(startHeight, numBlocks));
+			auto result = context.Consumer(inputs.back());
+
+			// Sanity:
+			test::AssertContinued(result);
+		}
+	}
+
+	TEST(TEST_CLASS, CanSyncIncompatibleChainsUsingUndoJournal) {
+		// Arrange: create a local storage with blocks 1-7 and sync blocks 8-11
+		ConsumerTestContext context;
+		std::vector<ConsumerInput> inputs;
+		SeedStorageAndCache(context, Height(7));
+		SyncCompatibleChain(context, inputs, Height(8), 4);
+
+		// - create a remote storage with blocks 8-12
+		auto input = CreateInput(Height(8), 5);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: all unwound blocks were reverted by the undo journal
+		test::AssertContinued(result);
+		EXPECT_EQ(0u, context.UndoBlock.params().size());
+
+		// - the processor was passed the cache and state at the common block height
+		ASSERT_EQ(2u, context.Processor.params().size());
+		const auto& processorParams = context.Processor.params()[1];
+		EXPECT_EQ(Initial_Last_Recalculation_Height, processorParams.LastRecalculationHeight);
+		EXPECT_TRUE(processorParams.IsPassedMarkedCache);
+		EXPECT_EQ(0u, processorParams.NumDifficultyInfos);
+
+		// - the changes were committed
+		ASSERT_EQ(2u, context.StateChange.params().size());
+		EXPECT_EQ(model::ChainScore(Base_Difficulty - 1), context.StateChange.params()[1].ScoreDelta);
+		EXPECT_EQ(Height(12), context.Storage.view().chainHeight());
+		EXPECT_EQ(Height(12), context.Cache.createView().height());
+		EXPECT_EQ(Modified_Last_Recalculation_Height, context.State.LastRecalculationHeight);
+
+		// - the transactions of the unwound blocks were collected
+		ASSERT_EQ(2u, context.TransactionsChange.params().size());
+	}
+
+	TEST(TEST_CLASS, CanSyncIncompatibleChainsPartiallyCoveredByUndoJournal) {
+		// Arrange: create a local storage with blocks 1-7 and sync blocks 8-11 and 12-13
+		ConsumerTestContext context;
+		std::vector<ConsumerInput> inputs;
+		SeedStorageAndCache(context, Height(7));
+		SyncCompatibleChain(context, inputs, Height(8), 4);
+		SyncCompatibleChain(context, inputs, Height(12), 2);
+
+		// - create a remote storage with blocks 10-14
+		auto input = CreateInput(Height(10), 5);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: blocks 12-13 were reverted by the undo journal and blocks 10-11 were executed in reverse
+		test::AssertContinued(result);
+		ASSERT_EQ(2u, context.UndoBlock.params().size());
+		EXPECT_EQ(inputs[0].blocks()[3].Block, *context.UndoBlock.params()[0].pBlock);
+		EXPECT_EQ(inputs[0].blocks()[2].Block, *context.UndoBlock.params()[1].pBlock);
+
+		// - undo started from the journaled state at height 11
+		EXPECT_EQ(Modified_Last_Recalculation_Height, context.UndoBlock.params()[0].LastRecalculationHeight);
+
+		ASSERT_EQ(3u, context.Processor.params().size());
+		EXPECT_EQ(AddImportanceHeight(Modified_Last_Recalculation_Height, 2), context.Processor.params()[2].LastRecalculationHeight);
+
+		// - the changes were committed
+		ASSERT_EQ(3u, context.StateChange.params().size());
+		EXPECT_EQ(model::ChainScore(Base_Difficulty - 1), context.StateChange.params()[2].ScoreDelta);
+		EXPECT_EQ(Height(14), context.Cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, CanSyncIncompatibleChainsAfterUndoJournalIsDiscarded) {
+		// Arrange: create a local storage with blocks 1-7, sync blocks 8-11 and replace blocks 10-11 with blocks 10-12
+		ConsumerTestContext context;
+		std::vector<ConsumerInput> inputs;
+		SeedStorageAndCache(context, Height(7));
+		SyncCompatibleChain(context, inputs, Height(8), 4);
+		SyncCompatibleChain(context, inputs, Height(10), 3);
+
+		// Sanity: blocks 10-11 were executed in reverse
+		EXPECT_EQ(2u, context.UndoBlock.params().size());
+
+		// - create a remote storage with blocks 10-13
+		auto input = CreateInput(Height(10), 4);
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert: blocks 10-12 were executed in reverse because the undo journal was discarded
+		test::AssertContinued(result);
+		ASSERT_EQ(5u, context.UndoBlock.params().size());
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_EQ(inputs[1].blocks()[2 - i].Block, *context.UndoBlock.params()[2 + i].pBlock) << "undo at " << i;
+
+		EXPECT_EQ(Height(13), context.Cache.createView().height());
+	}
+
 	// endregion
 
 	// region transaction notification
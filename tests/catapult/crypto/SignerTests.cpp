@@ -390,4 +390,232 @@ namespace catapult { namespace crypto {
 			EXPECT_EQ(properSignature, result);
 		}
 	}
+
+	// region SecureRandomFill
+
+	TEST(TEST_CLASS, SecureRandomFillFillsAllBytes) {
+		// Arrange: use a size that is not a multiple of the generator result size
+		for (auto size : { 1u, 7u, 64u, 1001u }) {
+			std::vector<uint8_t> buffer1(size + 2, 0);
+			std::vector<uint8_t> buffer2(size + 2, 0);
+
+			// Act:
+			SecureRandomFill(buffer1.data() + 1, size);
+			SecureRandomFill(buffer2.data() + 1, size);
+
+			// Assert: bytes outside of the requested range are untouched
+			EXPECT_EQ(0u, buffer1.front()) << size;
+			EXPECT_EQ(0u, buffer1.back()) << size;
+			EXPECT_EQ(0u, buffer2.front()) << size;
+			EXPECT_EQ(0u, buffer2.back()) << size;
+
+			// - buffers are (most likely) different when large enough
+			if (size >= 64)
+				EXPECT_NE(buffer1, buffer2) << size;
+		}
+	}
+
+	// endregion
+
+	// region VerifyMulti / VerifyMultiAll
+
+	namespace {
+		struct BatchTestContext {
+		public:
+			explicit BatchTestContext(size_t count) {
+				for (auto i = 0u; i < count; ++i) {
+					auto keyPair = KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte));
+					PublicKeys.push_back(keyPair.publicKey());
+					Payloads.push_back(test::GenerateRandomVector(100 + i));
+					Signatures.push_back(SignPayload(keyPair, Payloads.back()));
+				}
+			}
+
+		public:
+			std::vector<SignatureInput> createInputs() const {
+				std::vector<SignatureInput> inputs;
+				for (auto i = 0u; i < PublicKeys.size(); ++i)
+					inputs.push_back({ PublicKeys[i], Payloads[i], Signatures[i] });
+
+				return inputs;
+			}
+
+		public:
+			std::vector<Key> PublicKeys;
+			std::vector<std::vector<uint8_t>> Payloads;
+			std::vector<Signature> Signatures;
+		};
+
+		void RandomFill(uint8_t* pData, size_t size) {
+			test::FillWithRandomData({ pData, size });
+		}
+
+		std::vector<size_t> GetBatchTestCounts() {
+			// large counts are verified using a different multi scalar multiplication algorithm
+			return { 1, 3, 4, 5, 16, 63, 100, 300 };
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsForEmptyInput) {
+		// Act:
+		auto isVerified = VerifyMulti(RandomFill, nullptr, 0);
+
+		// Assert:
+		EXPECT_TRUE(isVerified);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		for (auto count : GetBatchTestCounts()) {
+			// Arrange:
+			BatchTestContext context(count);
+			auto inputs = context.createInputs();
+
+			// Act:
+			auto isVerified = VerifyMulti(RandomFill, inputs.data(), inputs.size());
+
+			// Assert:
+			EXPECT_TRUE(isVerified) << "count " << count;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnySignatureIsInvalid) {
+		for (auto count : GetBatchTestCounts()) {
+			for (auto index : { static_cast<size_t>(0), count / 2, count - 1 }) {
+				// Arrange: corrupt a single signature
+				BatchTestContext context(count);
+				context.Signatures[index][10] ^= 0xFF;
+				auto inputs = context.createInputs();
+
+				// Act:
+				auto isVerified = VerifyMulti(RandomFill, inputs.data(), inputs.size());
+
+				// Assert:
+				EXPECT_FALSE(isVerified) << "count " << count << ", index " << index;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnyPayloadIsModified) {
+		// Arrange:
+		BatchTestContext context(16);
+		context.Payloads[7][0] ^= 0xFF;
+		auto inputs = context.createInputs();
+
+		// Act:
+		auto isVerified = VerifyMulti(RandomFill, inputs.data(), inputs.size());
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnySignatureIsNonCanonical) {
+		// Arrange:
+		BatchTestContext context(16);
+		ScalarAddGroupOrder(context.Signatures[5].data() + Signature_Size / 2);
+		auto inputs = context.createInputs();
+
+		// Act:
+		auto isVerified = VerifyMulti(RandomFill, inputs.data(), inputs.size());
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnyPublicKeyIsZero) {
+		// Arrange:
+		BatchTestContext context(16);
+		context.PublicKeys[9] = Key();
+		auto inputs = context.createInputs();
+
+		// Act:
+		auto isVerified = VerifyMulti(RandomFill, inputs.data(), inputs.size());
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiUsesRandomFillerForBatchCoefficients) {
+		// Arrange:
+		BatchTestContext context(16);
+		auto inputs = context.createInputs();
+		auto numCalls = 0u;
+		auto numBytes = 0u;
+		auto randomFiller = [&numCalls, &numBytes](auto* pData, auto size) {
+			++numCalls;
+			numBytes += static_cast<uint32_t>(size);
+			RandomFill(pData, size);
+		};
+
+		// Act:
+		auto isVerified = VerifyMulti(randomFiller, inputs.data(), inputs.size());
+
+		// Assert: one 128-bit coefficient is requested per signature
+		EXPECT_TRUE(isVerified);
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(16u * 16, numBytes);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiAllReturnsEmptyResultsForEmptyInput) {
+		// Act:
+		auto results = VerifyMultiAll(RandomFill, nullptr, 0);
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiAllMarksAllSignaturesValidWhenAllSignaturesAreValid) {
+		for (auto count : GetBatchTestCounts()) {
+			// Arrange:
+			BatchTestContext context(count);
+			auto inputs = context.createInputs();
+
+			// Act:
+			auto results = VerifyMultiAll(RandomFill, inputs.data(), inputs.size());
+
+			// Assert:
+			EXPECT_EQ(std::vector<bool>(count, true), results) << "count " << count;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiAllIdentifiesInvalidSignatures) {
+		// Arrange: corrupt a signature, a payload, an S part and a public key
+		BatchTestContext context(100);
+		context.Signatures[0][3] ^= 0xFF;
+		context.Payloads[17][0] ^= 0xFF;
+		ScalarAddGroupOrder(context.Signatures[50].data() + Signature_Size / 2);
+		context.PublicKeys[99] = Key();
+		auto inputs = context.createInputs();
+
+		// Act:
+		auto results = VerifyMultiAll(RandomFill, inputs.data(), inputs.size());
+
+		// Assert:
+		std::vector<bool> expectedResults(100, true);
+		for (auto index : { 0u, 17u, 50u, 99u })
+			expectedResults[index] = false;
+
+		EXPECT_EQ(expectedResults, results);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiAllMatchesVerify) {
+		// Arrange: corrupt every third signature
+		BatchTestContext context(30);
+		for (auto i = 0u; i < context.Signatures.size(); i += 3)
+			context.Signatures[i][Signature_Size / 2 - 1] ^= 0x01;
+
+		auto inputs = context.createInputs();
+
+		// Act:
+		auto results = VerifyMultiAll(RandomFill, inputs.data(), inputs.size());
+
+		// Assert:
+		ASSERT_EQ(30u, results.size());
+		for (auto i = 0u; i < results.size(); ++i) {
+			auto isVerified = Verify(context.PublicKeys[i], context.Payloads[i], context.Signatures[i]);
+			EXPECT_EQ(isVerified, results[i]) << "signature at " << i;
+			EXPECT_EQ(0 != i % 3, results[i]) << "signature at " << i;
+		}
+	}
+
+	// endregion
 }}
@@ -206,6 +206,230 @@ namespace catapult { namespace test {
 		}
 
 		// endregion
+
+		// region undo journal
+
+	private:
+		static auto CreateJournaledBaseSet() {
+			auto pBaseSet = TTraits::CreateWithElements(3);
+			pBaseSet->enableUndoJournal();
+
+			auto pDelta = pBaseSet->rebase();
+			pDelta->emplace("MyTestElement", static_cast<unsigned int>(123));
+			pDelta->remove(TTraits::CreateKey("TestElement", 0));
+			TTraits::Commit(*pBaseSet);
+
+			pDelta->emplace("MyTestElement", static_cast<unsigned int>(234));
+			pDelta->remove(TTraits::CreateKey("TestElement", 2));
+			TTraits::Commit(*pBaseSet);
+			return pBaseSet;
+		}
+
+		static auto CreateElementsAfterFirstCommit() {
+			return typename TTraits::ElementVector{
+				TTraits::CreateElement("TestElement", 1),
+				TTraits::CreateElement("TestElement", 2),
+				TTraits::CreateElement("MyTestElement", 123)
+			};
+		}
+
+		static auto CreateElementsAfterSecondCommit() {
+			return typename TTraits::ElementVector{
+				TTraits::CreateElement("TestElement", 1),
+				TTraits::CreateElement("MyTestElement", 123),
+				TTraits::CreateElement("MyTestElement", 234)
+			};
+		}
+
+	public:
+		static void AssertCommitIsNotJournaledByDefault() {
+			// Arrange:
+			auto pBaseSet = TTraits::CreateWithElements(3);
+			auto pDelta = pBaseSet->rebase();
+
+			// Act:
+			TTraits::Commit(*pBaseSet);
+
+			// Assert:
+			EXPECT_EQ(0u, pBaseSet->undoJournalSize());
+			EXPECT_THROW(pBaseSet->undo(1), catapult_runtime_error);
+		}
+
+		static void AssertCommitIsJournaledWhenUndoJournalIsEnabled() {
+			// Act:
+			auto pBaseSet = CreateJournaledBaseSet();
+
+			// Assert:
+			EXPECT_EQ(2u, pBaseSet->undoJournalSize());
+			TTraits::AssertContents(*pBaseSet, CreateElementsAfterSecondCommit());
+		}
+
+		static void AssertCannotUndoWhenThereAreNoPendingAttachedDeltas() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			auto pDetachedDelta = pBaseSet->rebaseDetached();
+
+			// Act + Assert:
+			EXPECT_THROW(pBaseSet->undo(1), catapult_runtime_error);
+		}
+
+		static void AssertCannotUndoMoreCommitsThanJournaled() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			auto pDelta = pBaseSet->rebase();
+			pBaseSet->undo(1);
+
+			// Act + Assert:
+			EXPECT_THROW(pBaseSet->undo(2), catapult_invalid_argument);
+		}
+
+		static void AssertUndoRevertsChangesOfSingleCommitInDelta() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			auto pDelta = pBaseSet->rebase();
+
+			// Act:
+			pBaseSet->undo(1);
+
+			// Assert:
+			TTraits::AssertContents(*pDelta, CreateElementsAfterFirstCommit());
+			TTraits::AssertContents(*pBaseSet, CreateElementsAfterSecondCommit());
+			EXPECT_EQ(1u, pBaseSet->undoJournalSize());
+		}
+
+		static void AssertUndoRevertsChangesOfMultipleCommitsInDelta() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			auto pDelta = pBaseSet->rebase();
+
+			// Act:
+			pBaseSet->undo(2);
+
+			// Assert:
+			TTraits::AssertContents(*pDelta, TTraits::CreateElements(3));
+			TTraits::AssertContents(*pBaseSet, CreateElementsAfterSecondCommit());
+			EXPECT_EQ(0u, pBaseSet->undoJournalSize());
+		}
+
+		static void AssertUndoCanBeCalledMultipleTimes() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			auto pDelta = pBaseSet->rebase();
+
+			// Act:
+			pBaseSet->undo(1);
+			pBaseSet->undo(1);
+
+			// Assert:
+			TTraits::AssertContents(*pDelta, TTraits::CreateElements(3));
+			EXPECT_EQ(0u, pBaseSet->undoJournalSize());
+		}
+
+		static void AssertCommitAfterUndoReplacesUndoneCommits() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			auto pDelta = pBaseSet->rebase();
+			pBaseSet->undo(1);
+			pDelta->emplace("MyTestElement", static_cast<unsigned int>(345));
+
+			// Act:
+			TTraits::Commit(*pBaseSet);
+
+			// Assert: the undone commit was replaced
+			auto expectedElements = CreateElementsAfterFirstCommit();
+			expectedElements.push_back(TTraits::CreateElement("MyTestElement", 345));
+			TTraits::AssertContents(*pBaseSet, expectedElements);
+			EXPECT_EQ(2u, pBaseSet->undoJournalSize());
+
+			// - the replacement commit can be undone
+			pBaseSet->undo(1);
+			TTraits::AssertContents(*pDelta, CreateElementsAfterFirstCommit());
+
+			// - the preceding commit can still be undone
+			pBaseSet->undo(1);
+			TTraits::AssertContents(*pDelta, TTraits::CreateElements(3));
+		}
+
+		static void AssertCommitAfterUndoOfMultipleCommitsReplacesUndoneCommits() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			auto pDelta = pBaseSet->rebase();
+			pBaseSet->undo(2);
+			pDelta->emplace("MyTestElement", static_cast<unsigned int>(234));
+
+			// Act:
+			TTraits::Commit(*pBaseSet);
+
+			// Assert:
+			auto expectedElements = TTraits::CreateElements(3);
+			expectedElements.push_back(TTraits::CreateElement("MyTestElement", 234));
+			TTraits::AssertContents(*pBaseSet, expectedElements);
+			EXPECT_EQ(1u, pBaseSet->undoJournalSize());
+
+			// - the replacement commit can be undone
+			pBaseSet->undo(1);
+			TTraits::AssertContents(*pDelta, TTraits::CreateElements(3));
+		}
+
+		static void AssertRebaseDiscardsUndoneCommits() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			{
+				auto pDelta = pBaseSet->rebase();
+				pBaseSet->undo(2);
+			}
+
+			// Act:
+			auto pDelta = pBaseSet->rebase();
+			TTraits::Commit(*pBaseSet);
+
+			// Assert:
+			TTraits::AssertContents(*pBaseSet, CreateElementsAfterSecondCommit());
+			EXPECT_EQ(3u, pBaseSet->undoJournalSize());
+		}
+
+		static void AssertPruneUndoJournalRetainsMostRecentCommits() {
+			// Arrange:
+			auto pBaseSet = CreateJournaledBaseSet();
+			auto pDelta = pBaseSet->rebase();
+
+			// Act:
+			pBaseSet->pruneUndoJournal(1);
+
+			// Assert:
+			EXPECT_EQ(1u, pBaseSet->undoJournalSize());
+
+			pBaseSet->undo(1);
+			TTraits::AssertContents(*pDelta, CreateElementsAfterFirstCommit());
+			EXPECT_THROW(pBaseSet->undo(1), catapult_invalid_argument);
+		}
+
+		static void AssertUndoRevertsModificationsOfElements() {
+			// Arrange:
+			auto pBaseSet = TTraits::CreateWithElements(3);
+			pBaseSet->enableUndoJournal();
+
+			auto pDelta = pBaseSet->rebase();
+			pDelta->find(TTraits::CreateKey("TestElement", 1))->Dummy = 123;
+			TTraits::Commit(*pBaseSet);
+
+			// Act:
+			pBaseSet->undo(1);
+			auto pElement = pDelta->find(TTraits::CreateKey("TestElement", 1));
+
+			// Assert: the delta contains a copy of the original element
+			EXPECT_EQ(0u, pElement->Dummy);
+			EXPECT_EQ(123u, pBaseSet->find(TTraits::CreateKey("TestElement", 1))->Dummy);
+
+			// Act: modify the copy and commit
+			pElement->Dummy = 234;
+			TTraits::Commit(*pBaseSet);
+
+			// Assert:
+			EXPECT_EQ(234u, pBaseSet->find(TTraits::CreateKey("TestElement", 1))->Dummy);
+		}
+
+		// endregion
 	};
 
 #define MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, TEST_NAME) \
@@ -226,12 +450,25 @@ namespace catapult { namespace test {
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CannotCommitWhenThereAreNoPendingAttachedDeltas) \
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitThrowsIfOnlyDetachedDeltasAreOutstanding) \
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitCommitsToOriginalElements) \
-	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitIsIdempotent)
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitIsIdempotent) \
+	\
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitIsNotJournaledByDefault) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitIsJournaledWhenUndoJournalIsEnabled) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CannotUndoWhenThereAreNoPendingAttachedDeltas) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CannotUndoMoreCommitsThanJournaled) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, UndoRevertsChangesOfSingleCommitInDelta) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, UndoRevertsChangesOfMultipleCommitsInDelta) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, UndoCanBeCalledMultipleTimes) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitAfterUndoReplacesUndoneCommits) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitAfterUndoOfMultipleCommitsReplacesUndoneCommits) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, RebaseDiscardsUndoneCommits) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, PruneUndoJournalRetainsMostRecentCommits)
 
 #define DEFINE_MUTABLE_BASE_SET_TESTS(TEST_CLASS, TRAITS) \
 	DEFINE_BASE_SET_TESTS(TEST_CLASS, TRAITS) \
 	\
-	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitReflectsChangesOnOriginalElements)
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, CommitReflectsChangesOnOriginalElements) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, UndoRevertsModificationsOfElements)
 
 #define DEFINE_IMMUTABLE_BASE_SET_TESTS DEFINE_BASE_SET_TESTS
 
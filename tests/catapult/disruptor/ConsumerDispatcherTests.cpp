@@ -332,6 +332,116 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region processElements
+
+	namespace {
+		auto ToConsumerInputs(std::vector<model::BlockRange>&& ranges) {
+			std::vector<ConsumerInput> inputs;
+			for (auto& range : ranges)
+				inputs.emplace_back(std::move(range));
+
+			return inputs;
+		}
+	}
+
+	TEST(TEST_CLASS, ProcessElementsReturnsContiguousElementIds) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer() });
+		dispatcher.processElement(ConsumerInput(test::CreateBlockEntityRange(1)));
+
+		// Act:
+		auto ids = dispatcher.processElements(ToConsumerInputs(test::PrepareRanges(4)));
+
+		// Assert:
+		EXPECT_EQ(5u, dispatcher.numAddedElements());
+		EXPECT_EQ(std::vector<DisruptorElementId>({ 2, 3, 4, 5 }), ids);
+	}
+
+	TEST(TEST_CLASS, ProcessElementsIgnoresEmptyInputs) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer() });
+		auto ranges = test::PrepareRanges(3);
+		ranges.insert(ranges.begin() + 1, model::BlockRange());
+		ranges.push_back(model::BlockRange());
+
+		// Act:
+		auto ids = dispatcher.processElements(ToConsumerInputs(std::move(ranges)));
+
+		// Assert:
+		EXPECT_EQ(3u, dispatcher.numAddedElements());
+		EXPECT_EQ(std::vector<DisruptorElementId>({ 1, 0, 2, 3, 0 }), ids);
+	}
+
+	TEST(TEST_CLASS, ProcessElementsHasNoEffectWhenAllInputsAreEmpty) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer() });
+		std::vector<model::BlockRange> ranges(2);
+		auto numHandlerCalls = 0u;
+
+		// Act:
+		auto ids = dispatcher.processElements(ToConsumerInputs(std::move(ranges)), [&numHandlerCalls](auto, const auto&) {
+			++numHandlerCalls;
+		});
+
+		// Assert:
+		AssertHasProcessedNoElements(dispatcher);
+		EXPECT_EQ(std::vector<DisruptorElementId>({ 0, 0 }), ids);
+		EXPECT_EQ(0u, numHandlerCalls);
+	}
+
+	TEST(TEST_CLASS, ProcessElementsCallsCompletionHandlerForAllInputs) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(4);
+		auto expectedHeights = GetExpectedHeights(ranges);
+
+		std::vector<Heights> collectedHeights;
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateConsumer(collectedHeights) });
+		std::vector<DisruptorElementId> capturedElementIds;
+		std::atomic<size_t> numCapturedElements(0);
+
+		// Act:
+		dispatcher.processElements(ToConsumerInputs(std::move(ranges)), [&capturedElementIds, &numCapturedElements](auto id, const auto&) {
+			capturedElementIds.push_back(id);
+			++numCapturedElements;
+		});
+		WAIT_FOR_VALUE(4u, numCapturedElements);
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: all elements were processed in order
+		EXPECT_EQ(std::vector<DisruptorElementId>({ 1, 2, 3, 4 }), capturedElementIds);
+		EXPECT_EQ(expectedHeights, collectedHeights);
+	}
+
+	TEST(TEST_CLASS, ProcessElementsThrowsWhenInputsDoNotFitAndShouldThrowIfFullIsSet) {
+		// Arrange:
+		auto options = Test_Dispatcher_Options;
+		options.DisruptorSize = 4;
+		ConsumerDispatcher dispatcher(options, { CreateNoOpConsumer() });
+
+		// Act + Assert: no elements are added when all inputs cannot fit
+		EXPECT_THROW(dispatcher.processElements(ToConsumerInputs(test::PrepareRanges(4))), catapult_runtime_error);
+		EXPECT_EQ(0u, dispatcher.numAddedElements());
+		EXPECT_EQ(0u, dispatcher.numActiveElements());
+	}
+
+	TEST(TEST_CLASS, ProcessElementsRejectsAllInputsWhenInputsDoNotFitAndShouldThrowIfFullIsNotSet) {
+		// Arrange:
+		auto options = Test_Dispatcher_Options;
+		options.DisruptorSize = 4;
+		options.ShouldThrowIfFull = false;
+		ConsumerDispatcher dispatcher(options, { CreateNoOpConsumer() });
+
+		// Act:
+		auto ids = dispatcher.processElements(ToConsumerInputs(test::PrepareRanges(4)));
+
+		// Assert:
+		EXPECT_EQ(std::vector<DisruptorElementId>(4, 0), ids);
+		EXPECT_EQ(0u, dispatcher.numAddedElements());
+		EXPECT_EQ(0u, dispatcher.numActiveElements());
+	}
+
+	// endregion
+
 	// region inspect + consume
 
 	TEST(TEST_CLASS, CanInspectSingleElement) {
@@ -430,6 +540,55 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
 	}
 
+	namespace {
+		void AssertCanConsumeAndInspectAllElementsWithMultipleConsumers(ConsumerWaitStrategy waitStrategy) {
+			// Arrange:
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+
+			auto ranges = test::PrepareRanges(5);
+			auto expectedHeights = GetExpectedHeights(ranges);
+			std::vector<Heights> collectedHeights[2];
+			std::vector<Heights> inspectedHeights;
+			std::vector<CompletionStatus> inspectedStatuses;
+
+			// Act:
+			ConsumerDispatcher dispatcher(
+					options,
+					{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+					CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+			// - push multiple elements
+			ProcessAll(dispatcher, std::move(ranges));
+			WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+			// Assert:
+			EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+			EXPECT_EQ(expectedHeights, collectedHeights[0]);
+			EXPECT_EQ(expectedHeights, collectedHeights[1]);
+			EXPECT_EQ(expectedHeights, inspectedHeights);
+
+			// Act: dispatcher can be shutdown while consumers are waiting
+			dispatcher.shutdown();
+
+			// Assert:
+			EXPECT_FALSE(dispatcher.isRunning());
+		}
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithMultipleConsumers_BusySpin) {
+		AssertCanConsumeAndInspectAllElementsWithMultipleConsumers(ConsumerWaitStrategy::Busy_Spin);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithMultipleConsumers_SpinThenYield) {
+		AssertCanConsumeAndInspectAllElementsWithMultipleConsumers(ConsumerWaitStrategy::Spin_Then_Yield);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithMultipleConsumers_Blocking) {
+		AssertCanConsumeAndInspectAllElementsWithMultipleConsumers(ConsumerWaitStrategy::Blocking);
+	}
+
 	// endregion
 
 	// region element marking
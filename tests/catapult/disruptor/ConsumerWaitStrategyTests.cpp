@@ -0,0 +1,138 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/disruptor/ConsumerWaitStrategy.h"
+#include "tests/test/nodeps/ConfigurationTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+#include <atomic>
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS ConsumerWaitStrategyTests
+
+	// region parsing
+
+	TEST(TEST_CLASS, CanParseValidConsumerWaitStrategies) {
+		// Assert:
+		test::AssertParse("Sleep", ConsumerWaitStrategy::Sleep, TryParseValue);
+		test::AssertParse("Busy_Spin", ConsumerWaitStrategy::Busy_Spin, TryParseValue);
+		test::AssertParse("Spin_Then_Yield", ConsumerWaitStrategy::Spin_Then_Yield, TryParseValue);
+		test::AssertParse("Blocking", ConsumerWaitStrategy::Blocking, TryParseValue);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidConsumerWaitStrategy) {
+		// Assert:
+		test::AssertEnumParseFailure("Blocking", ConsumerWaitStrategy::Sleep, TryParseValue);
+	}
+
+	// endregion
+
+	// region waiter
+
+	TEST(TEST_CLASS, CannotCreateWaiterForUnknownStrategy) {
+		// Act + Assert:
+		EXPECT_THROW(CreateConsumerWaiter(static_cast<ConsumerWaitStrategy>(0xFF)), catapult_invalid_argument);
+	}
+
+	namespace {
+		struct SleepTraits {
+			static constexpr auto Strategy = ConsumerWaitStrategy::Sleep;
+		};
+
+		struct BusySpinTraits {
+			static constexpr auto Strategy = ConsumerWaitStrategy::Busy_Spin;
+		};
+
+		struct SpinThenYieldTraits {
+			static constexpr auto Strategy = ConsumerWaitStrategy::Spin_Then_Yield;
+		};
+
+		struct BlockingTraits {
+			static constexpr auto Strategy = ConsumerWaitStrategy::Blocking;
+		};
+	}
+
+#define STRATEGY_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sleep) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SleepTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BusySpin) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BusySpinTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_SpinThenYield) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SpinThenYieldTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Blocking) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BlockingTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	STRATEGY_TRAITS_BASED_TEST(WaitReturnsImmediatelyWhenPredicateIsSatisfied) {
+		// Arrange:
+		auto pWaiter = CreateConsumerWaiter(TTraits::Strategy);
+		auto numPredicateCalls = 0u;
+
+		// Act:
+		pWaiter->wait([&numPredicateCalls]() {
+			++numPredicateCalls;
+			return true;
+		});
+
+		// Assert:
+		EXPECT_EQ(1u, numPredicateCalls);
+	}
+
+	STRATEGY_TRAITS_BASED_TEST(WaitReturnsWhenPredicateIsSatisfiedAfterSignal) {
+		// Arrange:
+		auto pWaiter = CreateConsumerWaiter(TTraits::Strategy);
+		std::atomic<uint32_t> numPredicateCalls(0);
+		std::atomic_bool isReady(false);
+		std::atomic_bool isWaitComplete(false);
+
+		boost::thread thread([&]() {
+			pWaiter->wait([&]() {
+				++numPredicateCalls;
+				return isReady.load();
+			});
+			isWaitComplete = true;
+		});
+
+		// - wait for the predicate to be checked at least once
+		WAIT_FOR_EXPR(0 < numPredicateCalls);
+
+		// Sanity:
+		EXPECT_FALSE(isWaitComplete);
+
+		// Act:
+		isReady = true;
+		pWaiter->signal();
+		thread.join();
+
+		// Assert:
+		EXPECT_TRUE(isWaitComplete);
+	}
+
+	STRATEGY_TRAITS_BASED_TEST(SignalIsNoOpWhenThereAreNoWaiters) {
+		// Arrange:
+		auto pWaiter = CreateConsumerWaiter(TTraits::Strategy);
+
+		// Act + Assert: no exception
+		pWaiter->signal();
+		pWaiter->signal();
+	}
+
+	// endregion
+}}
@@ -45,4 +45,16 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	TEST(TEST_CLASS, CanAdvanceBarrierByMultiplePositions) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		barrier.advance(5);
+
+		// Assert:
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(6u, barrier.position());
+	}
 }}
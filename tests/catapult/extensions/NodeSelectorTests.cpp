@@ -46,6 +46,14 @@ namespace catapult { namespace extensions {
 			return connectionState;
 		}
 
+		ionet::ConnectionState CreateConnectionStateFromPerformance(uint32_t roundTripMillis, uint64_t bytesPerSecond) {
+			auto connectionState = CreateConnectionStateFromAttempts(5, 0);
+			connectionState.NumMeasuredInteractions = 1;
+			connectionState.RoundTripMillis = roundTripMillis;
+			connectionState.BytesPerSecond = bytesPerSecond;
+			return connectionState;
+		}
+
 		std::vector<ionet::Node> SeedNodes(
 				ionet::NodeContainer& container,
 				size_t numNodes,
@@ -128,6 +136,159 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(1u, CalculateWeightFromAttempts(100, 9'999'900)); // 1 (> 100 / 10'000'000 * 10'000) is the weight lower bound
 	}
 
+	namespace {
+		uint32_t CalculateWeightFromPerformance(uint32_t roundTripMillis, uint64_t bytesPerSecond) {
+			return CalculateWeight(CreateConnectionStateFromPerformance(roundTripMillis, bytesPerSecond));
+		}
+	}
+
+	TEST(TEST_CLASS, ConnectionStateWithoutMeasurementsIsNotScaledByPerformance) {
+		// Arrange:
+		auto connectionState = CreateConnectionStateFromPerformance(5'000, 1);
+		connectionState.NumMeasuredInteractions = 0;
+
+		// Act + Assert: measurements are ignored when there are no measured interactions
+		EXPECT_EQ(10'000u, CalculateWeight(connectionState));
+	}
+
+	TEST(TEST_CLASS, ConnectionStateWithoutThroughputMeasurementsIsScaledByRoundTripTimeAlone) {
+		// Act + Assert:
+		EXPECT_EQ(40'000u, CalculateWeightFromPerformance(0, 0)); // fast
+		EXPECT_EQ(40'000u, CalculateWeightFromPerformance(100, 0)); // fast
+		EXPECT_EQ(10'000u, CalculateWeightFromPerformance(300, 0)); // medium
+		EXPECT_EQ(2'500u, CalculateWeightFromPerformance(501, 0)); // slow
+	}
+
+	TEST(TEST_CLASS, ConnectionStateWithAverageMeasurementsIsNotScaledByPerformance) {
+		// Act + Assert:
+		EXPECT_EQ(10'000u, CalculateWeightFromPerformance(50, 10 * 1024)); // fast, low
+		EXPECT_EQ(10'000u, CalculateWeightFromPerformance(300, 100 * 1024)); // medium, medium
+		EXPECT_EQ(10'000u, CalculateWeightFromPerformance(1'000, 2 * 1024 * 1024)); // slow, high
+	}
+
+	TEST(TEST_CLASS, ConnectionStateWithGoodMeasurementsIsGivenIncreasedWeight) {
+		// Act + Assert:
+		EXPECT_EQ(20'000u, CalculateWeightFromPerformance(300, 2 * 1024 * 1024)); // medium, high
+		EXPECT_EQ(20'000u, CalculateWeightFromPerformance(100, 64 * 1024)); // fast, medium
+		EXPECT_EQ(40'000u, CalculateWeightFromPerformance(100, 1024 * 1024)); // fast, high
+	}
+
+	TEST(TEST_CLASS, ConnectionStateWithPoorMeasurementsIsGivenDecreasedWeight) {
+		// Act + Assert:
+		EXPECT_EQ(5'000u, CalculateWeightFromPerformance(500, 10 * 1024)); // medium, low
+		EXPECT_EQ(5'000u, CalculateWeightFromPerformance(501, 64 * 1024)); // slow, medium
+		EXPECT_EQ(2'500u, CalculateWeightFromPerformance(1'000, 1)); // slow, low
+	}
+
+	TEST(TEST_CLASS, ConnectionStateWithPoorMeasurementsAndAllFailuresIsGivenMinWeight) {
+		// Arrange:
+		auto connectionState = CreateConnectionStateFromAttempts(0, 10'000);
+		connectionState.NumMeasuredInteractions = 1;
+		connectionState.RoundTripMillis = 1'000;
+		connectionState.BytesPerSecond = 1;
+
+		// Act + Assert:
+		EXPECT_EQ(1u, CalculateWeight(connectionState));
+	}
+
+	// endregion
+
+	// region UpdateInteractionMetrics
+
+	namespace {
+		ionet::PacketIoMetrics CreateMetrics(
+				uint32_t numRoundTrips,
+				uint64_t totalRoundTripMillis,
+				uint64_t numBytesRead,
+				uint64_t elapsedMillis) {
+			return { numRoundTrips, totalRoundTripMillis, numBytesRead, elapsedMillis };
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateInteractionMetricsIgnoresMetricsWithoutRoundTrips) {
+		// Arrange:
+		auto connectionState = CreateConnectionStateFromPerformance(200, 1'000);
+
+		// Act:
+		UpdateInteractionMetrics(connectionState, CreateMetrics(0, 0, 500'000, 100));
+
+		// Assert:
+		EXPECT_EQ(1u, connectionState.NumMeasuredInteractions);
+		EXPECT_EQ(200u, connectionState.RoundTripMillis);
+		EXPECT_EQ(1'000u, connectionState.BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, UpdateInteractionMetricsUsesFirstMeasurementAsIs) {
+		// Arrange:
+		ionet::ConnectionState connectionState;
+
+		// Act: 3 round trips with average of 40ms and 500'000 bytes read in 250ms
+		UpdateInteractionMetrics(connectionState, CreateMetrics(3, 120, 500'000, 250));
+
+		// Assert:
+		EXPECT_EQ(1u, connectionState.NumMeasuredInteractions);
+		EXPECT_EQ(40u, connectionState.RoundTripMillis);
+		EXPECT_EQ(2'000'000u, connectionState.BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, UpdateInteractionMetricsSmoothsSubsequentMeasurements) {
+		// Arrange:
+		auto connectionState = CreateConnectionStateFromPerformance(200, 1'000);
+
+		// Act: 2 round trips with average of 600ms and 300'000 bytes read in 1000ms
+		UpdateInteractionMetrics(connectionState, CreateMetrics(2, 1'200, 300'000, 1'000));
+
+		// Assert:
+		EXPECT_EQ(2u, connectionState.NumMeasuredInteractions);
+		EXPECT_EQ(300u, connectionState.RoundTripMillis); // (3 * 200 + 600) / 4
+		EXPECT_EQ(75'750u, connectionState.BytesPerSecond); // (3 * 1000 + 300'000) / 4
+	}
+
+	TEST(TEST_CLASS, UpdateInteractionMetricsDoesNotSampleThroughputOfSmallInteractions) {
+		// Arrange:
+		ionet::ConnectionState connectionState1;
+		auto connectionState2 = CreateConnectionStateFromPerformance(200, 1'000);
+
+		// Act: 1 round trip of 600ms and 65'535 bytes read in 10ms
+		UpdateInteractionMetrics(connectionState1, CreateMetrics(1, 600, 64 * 1024 - 1, 10));
+		UpdateInteractionMetrics(connectionState2, CreateMetrics(1, 600, 64 * 1024 - 1, 10));
+
+		// Assert: round trip times are updated but throughputs are not
+		EXPECT_EQ(1u, connectionState1.NumMeasuredInteractions);
+		EXPECT_EQ(600u, connectionState1.RoundTripMillis);
+		EXPECT_EQ(0u, connectionState1.BytesPerSecond);
+
+		EXPECT_EQ(2u, connectionState2.NumMeasuredInteractions);
+		EXPECT_EQ(300u, connectionState2.RoundTripMillis); // (3 * 200 + 600) / 4
+		EXPECT_EQ(1'000u, connectionState2.BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, UpdateInteractionMetricsHandlesZeroElapsedTime) {
+		// Arrange:
+		ionet::ConnectionState connectionState;
+
+		// Act:
+		UpdateInteractionMetrics(connectionState, CreateMetrics(1, 0, 64 * 1024, 0));
+
+		// Assert: elapsed time is at least 1ms
+		EXPECT_EQ(1u, connectionState.NumMeasuredInteractions);
+		EXPECT_EQ(0u, connectionState.RoundTripMillis);
+		EXPECT_EQ(64 * 1024 * 1000u, connectionState.BytesPerSecond);
+	}
+
+	TEST(TEST_CLASS, UpdateInteractionMetricsDoesNotOverflowNumMeasuredInteractions) {
+		// Arrange:
+		auto connectionState = CreateConnectionStateFromPerformance(200, 1'000);
+		connectionState.NumMeasuredInteractions = std::numeric_limits<uint32_t>::max();
+
+		// Act:
+		UpdateInteractionMetrics(connectionState, CreateMetrics(1, 600, 0, 10));
+
+		// Assert:
+		EXPECT_EQ(std::numeric_limits<uint32_t>::max(), connectionState.NumMeasuredInteractions);
+		EXPECT_EQ(300u, connectionState.RoundTripMillis); // (3 * 200 + 600) / 4
+	}
+
 	// endregion
 
 	// region SelectCandidatesBasedOnWeight
@@ -576,6 +737,39 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	TEST(TEST_CLASS, FastNodeHasHigherPriorityThanSlowNode) {
+		// Arrange: weights 40'000 / 2'500
+		auto connectionState1 = CreateConnectionStateFromPerformance(20, 2 * 1024 * 1024);
+		auto connectionState2 = CreateConnectionStateFromPerformance(2'000, 1024);
+
+		// Assert:
+		RunNonDeterministicPairwiseSelectionTest(NodeInfos(connectionState1, connectionState2), [](const auto& counts) {
+			return counts.first > 5 * counts.second;
+		});
+	}
+
+	TEST(TEST_CLASS, FastNodeWithoutThroughputMeasurementsHasHigherPriorityThanUnmeasuredNode) {
+		// Arrange: weights 40'000 / 10'000
+		auto connectionState1 = CreateConnectionStateFromPerformance(20, 0);
+		auto connectionState2 = CreateConnectionStateFromAttempts(5, 0);
+
+		// Assert:
+		RunNonDeterministicPairwiseSelectionTest(NodeInfos(connectionState1, connectionState2), [](const auto& counts) {
+			return counts.first > counts.second;
+		});
+	}
+
+	TEST(TEST_CLASS, UnmeasuredNodeHasHigherPriorityThanSlowNode) {
+		// Arrange: weights 10'000 / 2'500
+		auto connectionState1 = CreateConnectionStateFromAttempts(5, 0);
+		auto connectionState2 = CreateConnectionStateFromPerformance(2'000, 1024);
+
+		// Assert:
+		RunNonDeterministicPairwiseSelectionTest(NodeInfos(connectionState1, connectionState2), [](const auto& counts) {
+			return counts.first > counts.second;
+		});
+	}
+
 	TEST(TEST_CLASS, DynamicNodeWithLargeWeightHasHigherPriorityThanStaticNodeWithSmallWeight) {
 		// Arrange: weights 4000 / 9500
 		auto connectionState1 = CreateConnectionStateFromAttempts(1, 4);
@@ -19,8 +19,10 @@
 **/
 
 #include "catapult/extensions/SynchronizerTaskCallbacks.h"
+#include "tests/test/core/PacketTestUtils.h"
 #include "tests/test/core/mocks/MockPacketIo.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
+#include "tests/test/net/NodeTestUtils.h"
 #include "tests/test/net/mocks/MockPacketWriters.h"
 #include "tests/TestHarness.h"
 
@@ -31,6 +33,7 @@ namespace catapult { namespace extensions {
 	namespace {
 		constexpr auto Default_Action_Api_Id = 7;
 		constexpr auto Default_Timeout_Seconds = 3u;
+		constexpr auto Service_Id = ionet::ServiceIdentifier(0x54455354);
 
 		struct TaskCallbackParamsCapture {
 			size_t NumChainSyncedCalls = 0;
@@ -69,6 +72,7 @@ namespace catapult { namespace extensions {
 					return std::make_unique<int>(Default_Action_Api_Id);
 				},
 				packetIoPicker,
+				Service_Id,
 				testState.state(),
 				"test");
 		}
@@ -138,9 +142,10 @@ namespace catapult { namespace extensions {
 			ASSERT_EQ(1u, writers.numPickOneCalls());
 			EXPECT_EQ(Default_Timeout_Seconds, writers.pickOneDurations()[0].seconds());
 
-			// - factory was called
+			// - factory was called with a metered decorator around the picked io
 			EXPECT_EQ(1u, capture.NumFactoryCalls);
-			EXPECT_EQ(pPacketIo.get(), capture.pFactoryPacketIo);
+			EXPECT_NE(pPacketIo.get(), capture.pFactoryPacketIo);
+			EXPECT_TRUE(!!dynamic_cast<const ionet::MeteredPacketIo*>(capture.pFactoryPacketIo));
 			EXPECT_EQ(&testState.state().pluginManager().transactionRegistry(), capture.pFactoryTransactionRegistry);
 
 			// - action was called
@@ -198,4 +203,107 @@ namespace catapult { namespace extensions {
 		// Assert:
 		AssertCallbackCallsAction<ChainSyncAwareCallbackTraits>(true);
 	}
+
+	// region interaction metrics
+
+	namespace {
+		template<typename TTraits>
+		thread::TaskCallback CreatePacketIoTask(
+				test::ServiceTestState& testState,
+				mocks::PickOneAwareMockPacketWriters& packetIoPicker,
+				mocks::MockPacketIo& mockPacketIo,
+				const utils::TimeSpan& readDelay) {
+			testState.state().hooks().setChainSyncedPredicate([]() { return true; });
+
+			// write a request and read a response (only delay the read so that the write completes immediately)
+			return TTraits::CreateTask(
+				chain::RemoteNodeSynchronizer<ionet::PacketIo*>([&mockPacketIo, readDelay](auto* pPacketIo) {
+					auto pPromise = std::make_shared<thread::promise<chain::NodeInteractionResult>>();
+					pPacketIo->write(ionet::PacketPayload(ionet::PacketType::Undefined), [](auto) {});
+					mockPacketIo.setDelay(readDelay);
+					pPacketIo->read([pPromise](auto, const auto*) {
+						pPromise->set_value(chain::NodeInteractionResult::Success);
+					});
+					return pPromise->get_future();
+				}),
+				[](auto& packetIo, const auto&) {
+					return std::make_unique<ionet::PacketIo*>(&packetIo);
+				},
+				packetIoPicker,
+				Service_Id,
+				testState.state(),
+				"test");
+		}
+
+		template<typename TTraits>
+		void AssertInteractionMetricsAreStored(const utils::TimeSpan& readDelay) {
+			// Arrange: add the node to the container
+			test::ServiceTestState testState;
+			auto node = test::CreateNamedNode(test::GenerateRandomData<Key_Size>(), "alice");
+			testState.state().nodes().modifier().add(node, ionet::NodeSource::Dynamic);
+
+			// - prepare an io that responds with a packet
+			auto pPacket = test::CreateRandomPacket(100, ionet::PacketType::Undefined);
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+			mocks::PickOneAwareMockPacketWriters writers;
+			writers.setPacketIo(pPacketIo);
+			writers.setNode(node);
+
+			// Act:
+			auto result = CreatePacketIoTask<TTraits>(testState, writers, *pPacketIo, readDelay)().get();
+
+			// Assert:
+			EXPECT_EQ(thread::TaskResult::Continue, result);
+
+			const auto& nodeInfo = testState.state().nodes().view().getNodeInfo(node.identityKey());
+			const auto* pConnectionState = nodeInfo.getConnectionState(Service_Id);
+			ASSERT_TRUE(!!pConnectionState);
+			EXPECT_EQ(1u, pConnectionState->NumMeasuredInteractions);
+			EXPECT_LE(readDelay.millis(), pConnectionState->RoundTripMillis);
+
+			// - response is too small to sample throughput
+			EXPECT_EQ(0u, pConnectionState->BytesPerSecond);
+		}
+	}
+
+	TEST(TEST_CLASS, DefaultCallback_InteractionMetricsAreStoredInConnectionState) {
+		// Assert:
+		AssertInteractionMetricsAreStored<DefaultCallbackTraits>(utils::TimeSpan());
+	}
+
+	TEST(TEST_CLASS, DefaultCallback_InteractionMetricsIncludeResponseDelay) {
+		// Assert:
+		AssertInteractionMetricsAreStored<DefaultCallbackTraits>(utils::TimeSpan::FromMilliseconds(50));
+	}
+
+	TEST(TEST_CLASS, ChainSyncedCallback_InteractionMetricsAreStoredInConnectionState) {
+		// Assert:
+		AssertInteractionMetricsAreStored<ChainSyncAwareCallbackTraits>(utils::TimeSpan());
+	}
+
+	TEST(TEST_CLASS, InteractionMetricsAreNotStoredForUnknownNode) {
+		// Arrange: do not add the node to the container
+		test::ServiceTestState testState;
+		auto pPacket = test::CreateRandomPacket(100, ionet::PacketType::Undefined);
+		auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+		pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+		pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+		mocks::PickOneAwareMockPacketWriters writers;
+		writers.setPacketIo(pPacketIo);
+		writers.setNode(test::CreateNamedNode(test::GenerateRandomData<Key_Size>(), "alice"));
+
+		// Act:
+		auto result = CreatePacketIoTask<DefaultCallbackTraits>(testState, writers, *pPacketIo, utils::TimeSpan())().get();
+
+		// Assert:
+		EXPECT_EQ(thread::TaskResult::Continue, result);
+		EXPECT_EQ(1u, pPacketIo->numReads());
+		EXPECT_EQ(0u, testState.state().nodes().view().size());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/BufferStreamAdapters.h"
+#include "tests/catapult/io/test/StreamTests.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS BufferStreamAdaptersTests
+
+	namespace {
+		class BufferStreamContext {
+		public:
+			explicit BufferStreamContext(const char*)
+			{}
+
+			auto outputStream() {
+				return std::make_unique<BufferOutputStreamAdapter>(m_buffer);
+			}
+
+			auto inputStream() {
+				return std::make_unique<BufferInputStreamAdapter>(m_buffer);
+			}
+
+		private:
+			std::vector<uint8_t> m_buffer;
+		};
+	}
+
+	DEFINE_STREAM_TESTS(BufferStreamContext)
+
+	TEST(TEST_CLASS, WriteAppendsToBuffer) {
+		// Arrange:
+		std::vector<uint8_t> buffer{ 1, 2, 3 };
+		BufferOutputStreamAdapter output(buffer);
+
+		// Act:
+		output.write(std::vector<uint8_t>{ 4, 5 });
+		output.flush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>({ 1, 2, 3, 4, 5 }), buffer);
+	}
+
+	TEST(TEST_CLASS, ReadAdvancesPosition) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(10);
+		BufferInputStreamAdapter input(buffer);
+		std::vector<uint8_t> result(4);
+
+		// Act:
+		input.read(result);
+
+		// Assert:
+		EXPECT_EQ(4u, input.position());
+		EXPECT_FALSE(input.eof());
+		EXPECT_EQ(std::vector<uint8_t>(buffer.cbegin(), buffer.cbegin() + 4), result);
+	}
+
+	TEST(TEST_CLASS, EofIsSetWhenAllDataHasBeenRead) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(10);
+		BufferInputStreamAdapter input(buffer);
+		std::vector<uint8_t> result(10);
+
+		// Act:
+		input.read(result);
+
+		// Assert:
+		EXPECT_EQ(10u, input.position());
+		EXPECT_TRUE(input.eof());
+		EXPECT_EQ(buffer, result);
+	}
+}}
@@ -0,0 +1,196 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/io/FileBasedStorage.h"
+#include "tests/catapult/io/test/BlockStorageTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+using catapult::test::TempDirectoryGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileBasedStorageTests
+
+	namespace {
+		struct MemoryMappedFileBasedTraits {
+			using Guard = TempDirectoryGuard;
+			using StorageType = FileBasedStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(destination, BlockReadMode::Memory_Mapped);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				test::PrepareStorage(destination);
+				if (Height() != height)
+					test::FakeHeight(destination, height.unwrap());
+				return OpenStorage(destination);
+			}
+		};
+
+		// note: for test purposes, hardcoded 00000 dir is ok
+		std::string GetPath(const std::string& baseDirectory, uint64_t height) {
+			std::stringstream pathBuilder;
+			pathBuilder
+					<< baseDirectory
+					<< "/00000/"
+					<< std::setw(5) << std::setfill('0') << height
+					<< ".dat";
+
+			return pathBuilder.str();
+		}
+
+		struct SavedBlockElement {
+		public:
+			explicit SavedBlockElement(std::unique_ptr<model::Block>&& pBlockParam)
+					: pBlock(std::move(pBlockParam))
+					, Element(test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>()))
+			{}
+
+		public:
+			std::unique_ptr<model::Block> pBlock;
+			model::BlockElement Element;
+		};
+
+		std::shared_ptr<const model::BlockElement> SaveBlockAtHeight(FileBasedStorage& storage, Height height) {
+			auto pSavedBlockElement = std::make_shared<SavedBlockElement>(test::GenerateBlockWithTransactionsAtHeight(height));
+			storage.saveBlock(pSavedBlockElement->Element);
+			return std::shared_ptr<const model::BlockElement>(pSavedBlockElement, &pSavedBlockElement->Element);
+		}
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS(MemoryMappedFileBasedTraits)
+
+	// region mapped views
+
+	TEST(TEST_CLASS, CanReadBlocksSavedByBufferedStorage) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>());
+		FileBasedStorage(tempDir.name()).saveBlock(element);
+
+		// Act:
+		FileBasedStorage storage(tempDir.name(), BlockReadMode::Memory_Mapped);
+		auto pBlockElement = storage.loadBlockElement(Height(2));
+		auto pLoadedBlock = storage.loadBlock(Height(2));
+
+		// Assert:
+		test::AssertEqual(element, *pBlockElement);
+		EXPECT_EQ(*pBlock, *pLoadedBlock);
+	}
+
+	TEST(TEST_CLASS, LoadedBlocksOutliveStorage) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+		auto pStorage = MemoryMappedFileBasedTraits::OpenStorage(tempDir.name());
+		auto pExpectedElement = SaveBlockAtHeight(*pStorage, Height(2));
+
+		// Act:
+		auto pBlock = pStorage->loadBlock(Height(2));
+		auto pBlockElement = pStorage->loadBlockElement(Height(2));
+		pStorage.reset();
+
+		// Assert:
+		EXPECT_EQ(pExpectedElement->Block, *pBlock);
+		test::AssertEqual(*pExpectedElement, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, LoadedBlocksAreUnchangedWhenBlockFileIsOverwritten) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileBasedTraits::PrepareStorage(tempDir.name());
+		auto pExpectedElement = SaveBlockAtHeight(*pStorage, Height(2));
+		auto pBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act: overwrite the (mapped) block file with a different block
+		pStorage->dropBlocksAfter(Height(1));
+		auto pNewElement = SaveBlockAtHeight(*pStorage, Height(2));
+
+		// Assert: the original view is unchanged but new loads see the new block
+		test::AssertEqual(*pExpectedElement, *pBlockElement);
+		test::AssertEqual(*pNewElement, *pStorage->loadBlockElement(Height(2)));
+	}
+
+	TEST(TEST_CLASS, LoadedBlocksAreUnchangedWhenBlockFileIsPruned) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileBasedTraits::PrepareStorage(tempDir.name());
+		auto pExpectedElement = SaveBlockAtHeight(*pStorage, Height(2));
+		SaveBlockAtHeight(*pStorage, Height(3));
+		auto pBlockElement = pStorage->loadBlockElement(Height(2));
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(3));
+
+		// Assert:
+		EXPECT_FALSE(boost::filesystem::exists(GetPath(tempDir.name(), 2)));
+		test::AssertEqual(*pExpectedElement, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, CanLoadBlocksSequentially) {
+		// Arrange: sequential loads trigger prefetching of the next block file
+		TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileBasedTraits::PrepareStorage(tempDir.name());
+		std::vector<std::shared_ptr<const model::BlockElement>> expectedElements;
+		for (auto height = 2u; height <= 10; ++height)
+			expectedElements.push_back(SaveBlockAtHeight(*pStorage, Height(height)));
+
+		// Act + Assert:
+		for (auto height = 2u; height <= 10; ++height) {
+			auto pBlockElement = pStorage->loadBlockElement(Height(height));
+			test::AssertEqual(*expectedElements[height - 2], *pBlockElement);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotLoadTruncatedBlockFile) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileBasedTraits::PrepareStorage(tempDir.name());
+		SaveBlockAtHeight(*pStorage, Height(2));
+
+		// - truncate the block file so that the transaction hashes are missing
+		auto blockPath = GetPath(tempDir.name(), 2);
+		boost::filesystem::resize_file(blockPath, boost::filesystem::file_size(blockPath) - 1);
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->loadBlockElement(Height(2)), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotLoadMissingBlockFile) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = MemoryMappedFileBasedTraits::PrepareStorage(tempDir.name());
+		SaveBlockAtHeight(*pStorage, Height(2));
+		boost::filesystem::remove(GetPath(tempDir.name(), 2));
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->loadBlock(Height(2)), catapult_file_io_error);
+		EXPECT_THROW(pStorage->loadBlockElement(Height(2)), catapult_file_io_error);
+	}
+
+	// endregion
+}}
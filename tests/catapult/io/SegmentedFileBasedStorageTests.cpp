@@ -0,0 +1,379 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/io/SegmentedFileBasedStorage.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "tests/catapult/io/test/BlockStorageTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+using catapult::test::TempDirectoryGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS SegmentedFileBasedStorageTests
+
+	namespace {
+		constexpr uint64_t Blocks_Per_Segment = 65536;
+
+		struct SegmentedFileBasedTraits {
+			using Guard = TempDirectoryGuard;
+			using StorageType = SegmentedFileBasedStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(destination);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				test::PrepareStorage(destination);
+				SegmentedFileBasedStorage::MigrateBlockFiles(destination, true);
+				if (Height() != height)
+					test::FakeHeight(destination, height.unwrap());
+				return OpenStorage(destination);
+			}
+		};
+
+		// note: for test purposes, hardcoded directory names are ok
+		std::string GetPath(const std::string& baseDirectory, const std::string& directory, const std::string& filename) {
+			return baseDirectory + "/" + directory + "/" + filename;
+		}
+
+		std::string GetBlockFilePath(const std::string& baseDirectory, uint64_t height) {
+			std::stringstream filename;
+			filename << std::setw(5) << std::setfill('0') << height << ".dat";
+			return GetPath(baseDirectory, "00000", filename.str());
+		}
+
+		struct SavedBlockElement {
+		public:
+			explicit SavedBlockElement(std::unique_ptr<model::Block>&& pBlockParam)
+					: pBlock(std::move(pBlockParam))
+					, Element(test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>()))
+			{}
+
+		public:
+			std::unique_ptr<model::Block> pBlock;
+			model::BlockElement Element;
+		};
+
+		template<typename TStorage>
+		std::shared_ptr<const model::BlockElement> SaveBlockAtHeight(TStorage& storage, Height height) {
+			auto pSavedBlockElement = std::make_shared<SavedBlockElement>(test::GenerateBlockWithTransactionsAtHeight(height));
+			storage.saveBlock(pSavedBlockElement->Element);
+			return std::shared_ptr<const model::BlockElement>(pSavedBlockElement, &pSavedBlockElement->Element);
+		}
+
+		template<typename TStorage>
+		std::vector<std::shared_ptr<const model::BlockElement>> SaveBlocks(TStorage& storage, Height startHeight, Height endHeight) {
+			std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1))
+				blockElements.push_back(SaveBlockAtHeight(storage, height));
+
+			return blockElements;
+		}
+
+		void AssertBlockElements(
+				const SegmentedFileBasedStorage& storage,
+				Height startHeight,
+				const std::vector<std::shared_ptr<const model::BlockElement>>& expectedBlockElements) {
+			auto height = startHeight;
+			for (const auto& pExpectedBlockElement : expectedBlockElements) {
+				test::AssertEqual(*pExpectedBlockElement, *storage.loadBlockElement(height));
+				EXPECT_EQ(pExpectedBlockElement->Block, *storage.loadBlock(height)) << "at height " << height;
+				height = height + Height(1);
+			}
+		}
+	}
+
+	// storage seed contains block files, so it needs to be migrated before it can be opened
+	DEFINE_BLOCK_STORAGE_TESTS_WITHOUT_SEED(SegmentedFileBasedTraits)
+
+	// region layout
+
+	TEST(TEST_CLASS, MigratedStorageSeedContainsNemesisBlock) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+		auto pExpectedBlockElement = FileBasedStorage(tempDir.name()).loadBlockElement(Height(1));
+
+		// Act:
+		SegmentedFileBasedStorage::MigrateBlockFiles(tempDir.name(), true);
+		SegmentedFileBasedStorage storage(tempDir.name());
+		auto pBlockElement = storage.loadBlockElement(Height(1));
+
+		// Assert:
+		EXPECT_EQ(Height(1), storage.chainHeight());
+		test::AssertEqual(*pExpectedBlockElement, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, BlocksAreStoredInSingleSegmentFile) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedFileBasedTraits::PrepareStorage(tempDir.name());
+
+		// Act:
+		SaveBlocks(*pStorage, Height(2), Height(10));
+
+		// Assert:
+		EXPECT_TRUE(boost::filesystem::exists(GetPath(tempDir.name(), "00000", "blocks.dat")));
+		EXPECT_TRUE(boost::filesystem::exists(GetPath(tempDir.name(), "00000", "offsets.dat")));
+		EXPECT_TRUE(boost::filesystem::exists(GetPath(tempDir.name(), "00000", "hashes.dat")));
+		for (auto height = 1u; height <= 10; ++height)
+			EXPECT_FALSE(boost::filesystem::exists(GetBlockFilePath(tempDir.name(), height))) << "block at height " << height;
+
+		// - one entry (offset and size) per height, including (unused) height zero
+		EXPECT_EQ(11u * 2 * sizeof(uint64_t), boost::filesystem::file_size(GetPath(tempDir.name(), "00000", "offsets.dat")));
+	}
+
+	TEST(TEST_CLASS, CanReadSavedBlocksAcrossDifferentStorageInstances) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		std::vector<std::shared_ptr<const model::BlockElement>> expectedBlockElements;
+		{
+			auto pStorage = SegmentedFileBasedTraits::PrepareStorage(tempDir.name());
+			expectedBlockElements = SaveBlocks(*pStorage, Height(2), Height(10));
+		}
+
+		// Act + Assert:
+		SegmentedFileBasedStorage storage(tempDir.name());
+		AssertBlockElements(storage, Height(2), expectedBlockElements);
+	}
+
+	TEST(TEST_CLASS, CanReadBlocksSavedAfterLoadingBlocks) {
+		// Arrange: load a block so that the segment files are cached by the storage
+		TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedFileBasedTraits::PrepareStorage(tempDir.name());
+		auto pBlockElement2 = SaveBlockAtHeight(*pStorage, Height(2));
+		pStorage->loadBlockElement(Height(2));
+
+		// Act: grow the (cached) segment files
+		auto expectedBlockElements = SaveBlocks(*pStorage, Height(3), Height(5));
+
+		// Assert:
+		AssertBlockElements(*pStorage, Height(2), { pBlockElement2 });
+		AssertBlockElements(*pStorage, Height(3), expectedBlockElements);
+	}
+
+	TEST(TEST_CLASS, CanOverwriteBlocksInMiddleOfSegment) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedFileBasedTraits::PrepareStorage(tempDir.name());
+		auto expectedBlockElements = SaveBlocks(*pStorage, Height(2), Height(10));
+		pStorage->loadBlockElement(Height(7));
+
+		// Act: drop blocks and save different blocks at the same heights
+		pStorage->dropBlocksAfter(Height(5));
+		auto newBlockElements = SaveBlocks(*pStorage, Height(6), Height(8));
+
+		// Assert:
+		EXPECT_EQ(Height(8), pStorage->chainHeight());
+		AssertBlockElements(*pStorage, Height(2), { expectedBlockElements.cbegin(), expectedBlockElements.cbegin() + 4 });
+		AssertBlockElements(*pStorage, Height(6), newBlockElements);
+	}
+
+	TEST(TEST_CLASS, CanSaveBlocksAcrossSegmentBoundary) {
+		// Arrange: fake the chain height so that the next block is the last block of the first segment
+		TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedFileBasedTraits::PrepareStorage(tempDir.name(), Height(Blocks_Per_Segment - 1));
+
+		// Act:
+		auto expectedBlockElements = SaveBlocks(*pStorage, Height(Blocks_Per_Segment - 1), Height(Blocks_Per_Segment + 2));
+
+		// Assert:
+		EXPECT_TRUE(boost::filesystem::exists(GetPath(tempDir.name(), "00001", "blocks.dat")));
+		EXPECT_TRUE(boost::filesystem::exists(GetPath(tempDir.name(), "00001", "offsets.dat")));
+		AssertBlockElements(*pStorage, Height(Blocks_Per_Segment - 1), expectedBlockElements);
+		EXPECT_EQ(Height(1), pStorage->loadBlock(Height(1))->Height);
+	}
+
+	TEST(TEST_CLASS, CannotLoadBlockWithoutSegmentEntry) {
+		// Arrange: fake the chain height so that blocks 2-10 have hashes but no segment entries
+		TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedFileBasedTraits::PrepareStorage(tempDir.name(), Height(11));
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->loadBlock(Height(5)), catapult_file_io_error);
+		EXPECT_THROW(pStorage->loadBlockElement(Height(5)), catapult_file_io_error);
+	}
+
+	// endregion
+
+	// region pruneBlocksBefore
+
+	namespace {
+		auto PrepareStorageWithTwoSegments(const std::string& directory) {
+			auto pStorage = SegmentedFileBasedTraits::PrepareStorage(directory, Height(2 * Blocks_Per_Segment));
+			SaveBlocks(*pStorage, Height(2 * Blocks_Per_Segment), Height(2 * Blocks_Per_Segment + 1));
+			return pStorage;
+		}
+
+		bool SegmentExists(const std::string& directory, const std::string& segmentDirectory) {
+			return boost::filesystem::exists(GetPath(directory, segmentDirectory, "blocks.dat"))
+					&& boost::filesystem::exists(GetPath(directory, segmentDirectory, "offsets.dat"));
+		}
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_DoesNotPruneFirstSegment) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedFileBasedTraits::PrepareStorage(tempDir.name());
+		SaveBlocks(*pStorage, Height(2), Height(10));
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(10));
+
+		// Assert:
+		EXPECT_TRUE(SegmentExists(tempDir.name(), "00000"));
+		EXPECT_EQ(Height(10), pStorage->chainHeight());
+		EXPECT_EQ(Height(5), pStorage->loadBlock(Height(5))->Height);
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_PrunesSegmentsBeforeHeight) {
+		// Arrange: create (empty) segment files for the second segment
+		TempDirectoryGuard tempDir;
+		auto pStorage = PrepareStorageWithTwoSegments(tempDir.name());
+		boost::filesystem::create_directory(tempDir.name() + "/00001");
+		{
+			RawFile(GetPath(tempDir.name(), "00001", "blocks.dat"), OpenMode::Read_Write);
+			RawFile(GetPath(tempDir.name(), "00001", "offsets.dat"), OpenMode::Read_Write);
+		}
+
+		// Act:
+		pStorage->pruneBlocksBefore(Height(2 * Blocks_Per_Segment + 1));
+
+		// Assert: first segment and segment containing prune height are kept
+		EXPECT_TRUE(SegmentExists(tempDir.name(), "00000"));
+		EXPECT_FALSE(SegmentExists(tempDir.name(), "00001"));
+		EXPECT_TRUE(SegmentExists(tempDir.name(), "00002"));
+		EXPECT_EQ(Height(2 * Blocks_Per_Segment + 1), pStorage->loadBlock(Height(2 * Blocks_Per_Segment + 1))->Height);
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_ThrowsAtHeightAfterChainHeight) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedFileBasedTraits::PrepareStorage(tempDir.name());
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->pruneBlocksBefore(Height(10)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region MigrateBlockFiles
+
+	namespace {
+		auto PrepareBlockFiles(const std::string& directory, Height chainHeight) {
+			test::PrepareStorage(directory);
+			FileBasedStorage storage(directory);
+			return SaveBlocks(storage, Height(2), chainHeight);
+		}
+	}
+
+	TEST(TEST_CLASS, MigrateBlockFiles_CopiesAllBlocks) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto expectedBlockElements = PrepareBlockFiles(tempDir.name(), Height(10));
+
+		// Act:
+		auto numBlocks = SegmentedFileBasedStorage::MigrateBlockFiles(tempDir.name(), false);
+
+		// Assert:
+		EXPECT_EQ(10u, numBlocks);
+
+		SegmentedFileBasedStorage storage(tempDir.name());
+		EXPECT_EQ(Height(10), storage.chainHeight());
+		AssertBlockElements(storage, Height(2), expectedBlockElements);
+		EXPECT_EQ(2u, storage.loadHashesFrom(Height(9), 10).size());
+	}
+
+	TEST(TEST_CLASS, MigrateBlockFiles_CanKeepBlockFiles) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto expectedBlockElements = PrepareBlockFiles(tempDir.name(), Height(10));
+
+		// Act:
+		SegmentedFileBasedStorage::MigrateBlockFiles(tempDir.name(), false);
+
+		// Assert:
+		for (auto height = 1u; height <= 10; ++height)
+			EXPECT_TRUE(boost::filesystem::exists(GetBlockFilePath(tempDir.name(), height))) << "block at height " << height;
+
+		AssertBlockElements(SegmentedFileBasedStorage(tempDir.name()), Height(2), expectedBlockElements);
+	}
+
+	TEST(TEST_CLASS, MigrateBlockFiles_CanDeleteBlockFiles) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto expectedBlockElements = PrepareBlockFiles(tempDir.name(), Height(10));
+
+		// Act:
+		SegmentedFileBasedStorage::MigrateBlockFiles(tempDir.name(), true);
+
+		// Assert:
+		for (auto height = 1u; height <= 10; ++height)
+			EXPECT_FALSE(boost::filesystem::exists(GetBlockFilePath(tempDir.name(), height))) << "block at height " << height;
+
+		AssertBlockElements(SegmentedFileBasedStorage(tempDir.name()), Height(2), expectedBlockElements);
+	}
+
+	TEST(TEST_CLASS, MigrateBlockFiles_SkipsPrunedBlocks) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto expectedBlockElements = PrepareBlockFiles(tempDir.name(), Height(10));
+		FileBasedStorage(tempDir.name()).pruneBlocksBefore(Height(6));
+
+		// Act:
+		auto numBlocks = SegmentedFileBasedStorage::MigrateBlockFiles(tempDir.name(), true);
+
+		// Assert: nemesis and blocks 6-10 were copied
+		EXPECT_EQ(6u, numBlocks);
+
+		SegmentedFileBasedStorage storage(tempDir.name());
+		EXPECT_EQ(Height(1), storage.loadBlock(Height(1))->Height);
+		for (auto height = 2u; height < 6; ++height)
+			EXPECT_THROW(storage.loadBlock(Height(height)), catapult_file_io_error) << "block at height " << height;
+
+		AssertBlockElements(storage, Height(6), { expectedBlockElements.cbegin() + 4, expectedBlockElements.cend() });
+
+		// - new blocks can be saved after the migrated blocks
+		auto pBlockElement = SaveBlockAtHeight(storage, Height(11));
+		AssertBlockElements(storage, Height(10), { expectedBlockElements.back(), pBlockElement });
+	}
+
+	TEST(TEST_CLASS, MigrateBlockFiles_CanBeRepeated) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto expectedBlockElements = PrepareBlockFiles(tempDir.name(), Height(10));
+		SegmentedFileBasedStorage::MigrateBlockFiles(tempDir.name(), false);
+
+		// Act:
+		auto numBlocks = SegmentedFileBasedStorage::MigrateBlockFiles(tempDir.name(), true);
+
+		// Assert:
+		EXPECT_EQ(10u, numBlocks);
+		EXPECT_EQ(11u * 2 * sizeof(uint64_t), boost::filesystem::file_size(GetPath(tempDir.name(), "00000", "offsets.dat")));
+		AssertBlockElements(SegmentedFileBasedStorage(tempDir.name()), Height(2), expectedBlockElements);
+	}
+
+	// endregion
+}}
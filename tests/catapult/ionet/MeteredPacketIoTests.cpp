@@ -0,0 +1,234 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/MeteredPacketIo.h"
+#include "catapult/ionet/PacketPayloadFactory.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS MeteredPacketIoTests
+
+	namespace {
+		struct TestContext {
+		public:
+			TestContext()
+					: pMockPacketIo(std::make_shared<mocks::MockPacketIo>())
+					, pMeteredIo(std::make_shared<MeteredPacketIo>(pMockPacketIo))
+			{}
+
+		public:
+			void write() {
+				pMockPacketIo->queueWrite(SocketOperationCode::Success);
+				pMeteredIo->write(PacketPayload(test::CreateRandomPacket(12, PacketType::Undefined)), [](auto) {});
+			}
+
+			void queueRead(uint32_t payloadSize) {
+				auto pPacket = test::CreateRandomPacket(payloadSize, PacketType::Undefined);
+				pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+			}
+
+			void read() {
+				pMeteredIo->read([](auto, const auto*) {});
+			}
+
+		public:
+			std::shared_ptr<mocks::MockPacketIo> pMockPacketIo;
+			std::shared_ptr<MeteredPacketIo> pMeteredIo;
+		};
+
+		void AssertMetrics(const PacketIoMetrics& metrics, uint32_t expectedNumRoundTrips, uint64_t expectedNumBytesRead) {
+			EXPECT_EQ(expectedNumRoundTrips, metrics.NumRoundTrips);
+			EXPECT_EQ(expectedNumBytesRead, metrics.NumBytesRead);
+		}
+	}
+
+	// region forwarding
+
+	TEST(TEST_CLASS, WriteIsForwardedToDecoratedIo) {
+		// Arrange:
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Closed);
+		auto pPacket = test::CreateRandomPacket(12, PacketType::Push_Transactions);
+
+		// Act:
+		SocketOperationCode writeCode;
+		context.pMeteredIo->write(PacketPayload(pPacket), [&writeCode](auto code) {
+			writeCode = code;
+		});
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Closed, writeCode);
+		ASSERT_EQ(1u, context.pMockPacketIo->numWrites());
+
+		const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+		ASSERT_EQ(pPacket->Size, writtenPacket.Size);
+		EXPECT_EQ(PacketType::Push_Transactions, writtenPacket.Type);
+		EXPECT_TRUE(0 == std::memcmp(pPacket->Data(), writtenPacket.Data(), pPacket->Size - sizeof(PacketHeader)));
+	}
+
+	TEST(TEST_CLASS, ReadIsForwardedToDecoratedIo) {
+		// Arrange:
+		TestContext context;
+		auto pPacket = test::CreateRandomPacket(12, PacketType::Push_Transactions);
+		context.pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+		// Act:
+		SocketOperationCode readCode;
+		const Packet* pReadPacket = nullptr;
+		context.pMeteredIo->read([&readCode, &pReadPacket](auto code, const auto* pPacketFromIo) {
+			readCode = code;
+			pReadPacket = pPacketFromIo;
+		});
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Success, readCode);
+		EXPECT_EQ(1u, context.pMockPacketIo->numReads());
+		EXPECT_EQ(pPacket.get(), pReadPacket);
+	}
+
+	// endregion
+
+	// region metrics
+
+	TEST(TEST_CLASS, MetricsAreInitiallyZero) {
+		// Act:
+		TestContext context;
+		auto metrics = context.pMeteredIo->metrics();
+
+		// Assert:
+		AssertMetrics(metrics, 0, 0);
+		EXPECT_EQ(0u, metrics.TotalRoundTripMillis);
+		EXPECT_EQ(0u, metrics.ElapsedMillis);
+	}
+
+	TEST(TEST_CLASS, WriteWithoutReadDoesNotCompleteRoundTrip) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.write();
+		auto metrics = context.pMeteredIo->metrics();
+
+		// Assert:
+		AssertMetrics(metrics, 0, 0);
+	}
+
+	TEST(TEST_CLASS, ReadWithoutWriteCountsBytesButDoesNotCompleteRoundTrip) {
+		// Arrange:
+		TestContext context;
+		context.queueRead(100);
+
+		// Act:
+		context.read();
+		auto metrics = context.pMeteredIo->metrics();
+
+		// Assert:
+		AssertMetrics(metrics, 0, sizeof(PacketHeader) + 100);
+	}
+
+	TEST(TEST_CLASS, WriteFollowedByReadCompletesRoundTrip) {
+		// Arrange:
+		TestContext context;
+		context.queueRead(100);
+
+		// Act:
+		context.write();
+		context.read();
+		auto metrics = context.pMeteredIo->metrics();
+
+		// Assert:
+		AssertMetrics(metrics, 1, sizeof(PacketHeader) + 100);
+	}
+
+	TEST(TEST_CLASS, MultipleWritesAndReadsOfSingleRequestCompleteSingleRoundTrip) {
+		// Arrange:
+		TestContext context;
+		context.queueRead(100);
+		context.queueRead(50);
+
+		// Act:
+		context.write();
+		context.write();
+		context.read();
+		context.read();
+		auto metrics = context.pMeteredIo->metrics();
+
+		// Assert:
+		AssertMetrics(metrics, 1, 2 * sizeof(PacketHeader) + 150);
+	}
+
+	TEST(TEST_CLASS, AlternatingWritesAndReadsCompleteMultipleRoundTrips) {
+		// Arrange:
+		TestContext context;
+		context.queueRead(100);
+		context.queueRead(50);
+		context.queueRead(25);
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			context.write();
+			context.read();
+		}
+
+		auto metrics = context.pMeteredIo->metrics();
+
+		// Assert:
+		AssertMetrics(metrics, 3, 3 * sizeof(PacketHeader) + 175);
+	}
+
+	TEST(TEST_CLASS, FailedReadDoesNotCompleteRoundTrip) {
+		// Arrange:
+		TestContext context;
+		context.pMockPacketIo->queueRead(SocketOperationCode::Read_Error);
+
+		// Act:
+		context.write();
+		context.read();
+		auto metrics = context.pMeteredIo->metrics();
+
+		// Assert:
+		AssertMetrics(metrics, 0, 0);
+	}
+
+	TEST(TEST_CLASS, RoundTripTimeIncludesDecoratedIoDelay) {
+		// Arrange:
+		TestContext context;
+		context.queueRead(100);
+
+		// Act: only delay the read so that the (undelayed) write completes immediately
+		std::atomic<uint32_t> numReads(0);
+		context.write();
+		context.pMockPacketIo->setDelay(utils::TimeSpan::FromMilliseconds(50));
+		context.pMeteredIo->read([&numReads](auto, const auto*) { ++numReads; });
+		WAIT_FOR_ONE(numReads);
+
+		auto metrics = context.pMeteredIo->metrics();
+
+		// Assert:
+		AssertMetrics(metrics, 1, sizeof(PacketHeader) + 100);
+		EXPECT_LE(50u, metrics.TotalRoundTripMillis);
+		EXPECT_LE(metrics.TotalRoundTripMillis, metrics.ElapsedMillis);
+	}
+
+	// endregion
+}}
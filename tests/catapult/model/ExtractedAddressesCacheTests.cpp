@@ -0,0 +1,265 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/ExtractedAddressesCache.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS ExtractedAddressesCacheTests
+
+	namespace {
+		class CountingNotificationPublisher : public NotificationPublisher {
+		public:
+			CountingNotificationPublisher() : m_numPublishes(0)
+			{}
+
+		public:
+			size_t numPublishes() const {
+				return m_numPublishes;
+			}
+
+		public:
+			void publish(const WeakEntityInfo& entityInfo, NotificationSubscriber& sub) const override {
+				++m_numPublishes;
+
+				const auto& transaction = entityInfo.cast<mocks::MockTransaction>().entity();
+				sub.notify(AccountPublicKeyNotification(transaction.Signer));
+			}
+
+		private:
+			mutable size_t m_numPublishes;
+		};
+
+		struct TransactionWithHash {
+			std::unique_ptr<mocks::MockTransaction> pTransaction;
+			Hash256 Hash;
+		};
+
+		TransactionWithHash CreateTransactionWithHash() {
+			auto pTransaction = mocks::CreateMockTransactionWithSignerAndRecipient(
+					test::GenerateRandomData<Key_Size>(),
+					test::GenerateRandomData<Key_Size>());
+			return { std::move(pTransaction), test::GenerateRandomData<Hash256_Size>() };
+		}
+
+		std::vector<TransactionWithHash> CreateTransactionsWithHashes(size_t count) {
+			std::vector<TransactionWithHash> transactions;
+			for (auto i = 0u; i < count; ++i)
+				transactions.push_back(CreateTransactionWithHash());
+
+			return transactions;
+		}
+
+		void AssertSignerAddress(const AddressSet& addresses, const mocks::MockTransaction& transaction) {
+			EXPECT_EQ(1u, addresses.size());
+			EXPECT_TRUE(addresses.cend() != addresses.find(PublicKeyToAddress(transaction.Signer, transaction.Network())));
+		}
+
+		void AssertStatistics(const ExtractedAddressesCache& cache, uint64_t expectedNumHits, uint64_t expectedNumMisses) {
+			EXPECT_EQ(expectedNumHits, cache.statistics().NumHits);
+			EXPECT_EQ(expectedNumMisses, cache.statistics().NumMisses);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 10);
+
+		// Assert:
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(cache, 0, 0);
+		EXPECT_EQ(0u, cache.statistics().ExtractionMicros);
+	}
+
+	// endregion
+
+	// region extract
+
+	TEST(TEST_CLASS, ExtractExtractsAndCachesAddressesOfUnknownTransaction) {
+		// Arrange:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 10);
+		auto transaction = CreateTransactionWithHash();
+
+		// Act:
+		auto pAddresses = cache.extract(*transaction.pTransaction, transaction.Hash);
+
+		// Assert:
+		ASSERT_TRUE(!!pAddresses);
+		AssertSignerAddress(*pAddresses, *transaction.pTransaction);
+
+		EXPECT_EQ(1u, publisher.numPublishes());
+		EXPECT_EQ(1u, cache.size());
+		AssertStatistics(cache, 0, 1);
+	}
+
+	TEST(TEST_CLASS, ExtractReturnsCachedAddressesOfKnownTransaction) {
+		// Arrange:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 10);
+		auto transaction = CreateTransactionWithHash();
+		auto pAddresses1 = cache.extract(*transaction.pTransaction, transaction.Hash);
+
+		// Act:
+		auto pAddresses2 = cache.extract(*transaction.pTransaction, transaction.Hash);
+
+		// Assert: the addresses were only extracted once
+		EXPECT_EQ(pAddresses1, pAddresses2);
+
+		EXPECT_EQ(1u, publisher.numPublishes());
+		EXPECT_EQ(1u, cache.size());
+		AssertStatistics(cache, 1, 1);
+	}
+
+	// endregion
+
+	// region extractAndRemove
+
+	TEST(TEST_CLASS, ExtractAndRemoveExtractsAddressesOfUnknownTransactionWithoutCachingThem) {
+		// Arrange:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 10);
+		auto transaction = CreateTransactionWithHash();
+
+		// Act:
+		auto pAddresses = cache.extractAndRemove(*transaction.pTransaction, transaction.Hash);
+
+		// Assert:
+		ASSERT_TRUE(!!pAddresses);
+		AssertSignerAddress(*pAddresses, *transaction.pTransaction);
+
+		EXPECT_EQ(1u, publisher.numPublishes());
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(cache, 0, 1);
+	}
+
+	TEST(TEST_CLASS, ExtractAndRemoveReturnsAndRemovesCachedAddressesOfKnownTransaction) {
+		// Arrange:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 10);
+		auto transaction = CreateTransactionWithHash();
+		auto pAddresses1 = cache.extract(*transaction.pTransaction, transaction.Hash);
+
+		// Act:
+		auto pAddresses2 = cache.extractAndRemove(*transaction.pTransaction, transaction.Hash);
+
+		// Assert:
+		EXPECT_EQ(pAddresses1, pAddresses2);
+
+		EXPECT_EQ(1u, publisher.numPublishes());
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(cache, 1, 1);
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, CacheIsDisabledWhenMaxSizeIsZero) {
+		// Arrange:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 0);
+		auto transaction = CreateTransactionWithHash();
+
+		// Act:
+		cache.extract(*transaction.pTransaction, transaction.Hash);
+		cache.extract(*transaction.pTransaction, transaction.Hash);
+
+		// Assert:
+		EXPECT_EQ(2u, publisher.numPublishes());
+		EXPECT_EQ(0u, cache.size());
+		AssertStatistics(cache, 0, 2);
+	}
+
+	TEST(TEST_CLASS, CacheEvictsOldestAddressesWhenFull) {
+		// Arrange:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 3);
+		auto transactions = CreateTransactionsWithHashes(5);
+
+		// Act:
+		for (const auto& transaction : transactions)
+			cache.extract(*transaction.pTransaction, transaction.Hash);
+
+		// Assert: only the three most recent transactions are cached
+		EXPECT_EQ(3u, cache.size());
+
+		for (auto i = 2u; i < transactions.size(); ++i)
+			cache.extract(*transactions[i].pTransaction, transactions[i].Hash);
+
+		EXPECT_EQ(5u, publisher.numPublishes());
+		AssertStatistics(cache, 3, 5);
+
+		cache.extractAndRemove(*transactions[0].pTransaction, transactions[0].Hash);
+		EXPECT_EQ(6u, publisher.numPublishes());
+	}
+
+	TEST(TEST_CLASS, CacheEvictionSkipsRemovedAddresses) {
+		// Arrange:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 2);
+		auto transactions = CreateTransactionsWithHashes(3);
+		cache.extract(*transactions[0].pTransaction, transactions[0].Hash);
+		cache.extract(*transactions[1].pTransaction, transactions[1].Hash);
+		cache.extractAndRemove(*transactions[0].pTransaction, transactions[0].Hash);
+
+		// Act:
+		cache.extract(*transactions[2].pTransaction, transactions[2].Hash);
+
+		// Assert: the removed addresses were evicted instead of the addresses of the second transaction
+		EXPECT_EQ(2u, cache.size());
+
+		cache.extract(*transactions[1].pTransaction, transactions[1].Hash);
+		cache.extract(*transactions[2].pTransaction, transactions[2].Hash);
+
+		EXPECT_EQ(3u, publisher.numPublishes());
+		AssertStatistics(cache, 3, 3);
+	}
+
+	TEST(TEST_CLASS, CacheEvictionSkipsReinsertedAddresses) {
+		// Arrange:
+		CountingNotificationPublisher publisher;
+		ExtractedAddressesCache cache(publisher, 2);
+		auto transactions = CreateTransactionsWithHashes(3);
+		cache.extract(*transactions[0].pTransaction, transactions[0].Hash);
+		cache.extractAndRemove(*transactions[0].pTransaction, transactions[0].Hash);
+		cache.extract(*transactions[1].pTransaction, transactions[1].Hash);
+		cache.extract(*transactions[0].pTransaction, transactions[0].Hash);
+
+		// Act: evict the stale insertion of the first transaction
+		cache.extract(*transactions[2].pTransaction, transactions[2].Hash);
+
+		// Assert: the reinserted addresses of the first transaction were not evicted
+		EXPECT_EQ(2u, cache.size());
+
+		cache.extract(*transactions[0].pTransaction, transactions[0].Hash);
+		EXPECT_EQ(4u, publisher.numPublishes());
+	}
+
+	// endregion
+}}
@@ -250,5 +250,55 @@ namespace catapult { namespace observers {
 		});
 	}
 
+	namespace {
+		void AssertDispatchPreservesRegistrationOrder(
+				NotifyMode mode,
+				const model::Notification& notification,
+				const Breadcrumbs& expectedSelectedNames) {
+			// Arrange:
+			Breadcrumbs breadcrumbs;
+			DemuxObserverBuilder builder;
+
+			state::CatapultState state;
+			cache::CatapultCache cache({});
+			auto cacheDelta = cache.createDelta();
+			auto context = test::CreateObserverContext(cacheDelta, state, Height(123), mode);
+
+			builder
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "beta"))
+				.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "gamma"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "delta"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "epsilon"));
+			auto pObserver = builder.build();
+
+			// Act:
+			test::ObserveNotification<model::Notification>(*pObserver, notification, context);
+
+			// Assert:
+			Breadcrumbs expectedNames{ "alpha", "beta", "gamma", "delta", "epsilon" };
+			EXPECT_EQ(expectedNames, pObserver->names());
+			EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+		}
+	}
+
+	TEST(TEST_CLASS, DispatchPreservesRegistrationOrderOfMatchingObservers_Commit) {
+		// Assert:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		AssertDispatchPreservesRegistrationOrder(NotifyMode::Commit, notification, { "alpha", "beta", "delta", "epsilon" });
+	}
+
+	TEST(TEST_CLASS, DispatchPreservesRegistrationOrderOfMatchingObservers_Rollback) {
+		// Assert:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		AssertDispatchPreservesRegistrationOrder(NotifyMode::Rollback, notification, { "epsilon", "delta", "beta", "alpha" });
+	}
+
+	TEST(TEST_CLASS, DispatchOnlyInvokesUntypedObserversForUnregisteredNotificationType) {
+		// Assert:
+		auto notification = model::BalanceTransferNotification(Key(), Address(), MosaicId(), Amount());
+		AssertDispatchPreservesRegistrationOrder(NotifyMode::Commit, notification, { "beta", "epsilon" });
+	}
+
 	// endregion
 }}
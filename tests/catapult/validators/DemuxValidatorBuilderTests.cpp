@@ -260,5 +260,47 @@ namespace catapult { namespace validators {
 		});
 	}
 
+	namespace {
+		void AssertDispatchPreservesRegistrationOrder(const model::Notification& notification, const Breadcrumbs& expectedSelectedNames) {
+			// Arrange:
+			Breadcrumbs breadcrumbs;
+			stateful::DemuxValidatorBuilder builder;
+
+			auto cache = test::CreateEmptyCatapultCache();
+			auto cacheView = cache.createView();
+			auto context = test::CreateValidatorContext(Height(123), cacheView.toReadOnly());
+
+			builder
+				.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+				.add(CreateBreadcrumbValidator(breadcrumbs, "beta"))
+				.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "gamma"))
+				.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "delta"))
+				.add(CreateBreadcrumbValidator(breadcrumbs, "epsilon"));
+			auto pValidator = builder.build([](auto) { return false; });
+
+			// Act:
+			auto result = test::ValidateNotification<model::Notification>(*pValidator, notification, context);
+
+			// Assert:
+			EXPECT_EQ(ValidationResult::Success, result);
+
+			Breadcrumbs expectedNames{ "alpha", "beta", "gamma", "delta", "epsilon" };
+			EXPECT_EQ(expectedNames, pValidator->names());
+			EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+		}
+	}
+
+	TEST(TEST_CLASS, DispatchPreservesRegistrationOrderOfMatchingValidators) {
+		// Assert:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		AssertDispatchPreservesRegistrationOrder(notification, { "alpha", "beta", "delta", "epsilon" });
+	}
+
+	TEST(TEST_CLASS, DispatchOnlyInvokesUntypedValidatorsForUnregisteredNotificationType) {
+		// Assert:
+		auto notification = model::BalanceTransferNotification(Key(), Address(), MosaicId(), Amount());
+		AssertDispatchPreservesRegistrationOrder(notification, { "beta", "epsilon" });
+	}
+
 	// endregion
 }}
@@ -0,0 +1,229 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/extensions/NodeSelector.h"
+#include "catapult/extensions/SynchronizerTaskCallbacks.h"
+#include "catapult/ionet/MeteredPacketIo.h"
+#include "catapult/ionet/NodeContainer.h"
+#include "catapult/ionet/PacketSocket.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/net/NodeTestUtils.h"
+#include "tests/test/net/SocketTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <boost/asio/steady_timer.hpp>
+
+namespace catapult { namespace extensions {
+
+#define TEST_CLASS NodeSelectionLoopbackTests
+
+	namespace {
+		constexpr auto Service_Id = ionet::ServiceIdentifier(0x53594E43);
+		constexpr uint32_t Response_Payload_Size = 128 * 1024;
+		constexpr size_t Num_Sync_Rounds = 40;
+
+		// one fast peer and three slow peers (with medium round trip times and medium throughputs)
+		const std::vector<uint32_t> Peer_Response_Delays_Millis{ 2, 150, 150, 150 };
+
+		// region DelayedPeer
+
+		// loopback peer that accepts a single connection and answers every request with a large packet after a delay
+		class DelayedPeer {
+		public:
+			DelayedPeer(boost::asio::io_service& service, unsigned short port, uint32_t responseDelayMillis)
+					: m_service(service)
+					, m_acceptor(service)
+					, m_responseDelayMillis(responseDelayMillis)
+					, m_pResponsePacket(test::CreateRandomPacket(Response_Payload_Size, ionet::PacketType::Pull_Blocks)) {
+				auto endpoint = test::CreateLocalHostEndpoint(port);
+				m_acceptor.open(endpoint.protocol());
+				m_acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+				m_acceptor.bind(endpoint);
+				m_acceptor.listen();
+
+				ionet::Accept(m_acceptor, test::CreatePacketSocketOptions(), [this](const auto& socketInfo) {
+					m_acceptor.close();
+					if (socketInfo)
+						this->respond(socketInfo.socket());
+				});
+			}
+
+		private:
+			void respond(const std::shared_ptr<ionet::PacketSocket>& pSocket) {
+				pSocket->read([this, pSocket](auto code, const auto*) {
+					if (ionet::SocketOperationCode::Success != code)
+						return;
+
+					auto pTimer = std::make_shared<boost::asio::steady_timer>(m_service);
+					pTimer->expires_from_now(std::chrono::milliseconds(m_responseDelayMillis));
+					pTimer->async_wait([this, pSocket, pTimer](const auto&) {
+						pSocket->write(ionet::PacketPayload(m_pResponsePacket), [this, pSocket](auto writeCode) {
+							if (ionet::SocketOperationCode::Success == writeCode)
+								this->respond(pSocket);
+						});
+					});
+				});
+			}
+
+		private:
+			boost::asio::io_service& m_service;
+			boost::asio::ip::tcp::acceptor m_acceptor;
+			uint32_t m_responseDelayMillis;
+			std::shared_ptr<ionet::Packet> m_pResponsePacket;
+		};
+
+		// endregion
+
+		// region LoopbackNetwork
+
+		// network of loopback peers that are synced with by pulling a large packet from a selected peer in every round
+		class LoopbackNetwork {
+		public:
+			LoopbackNetwork() : m_pPool(test::CreateStartedIoServiceThreadPool()) {
+				for (auto i = 0u; i < Peer_Response_Delays_Millis.size(); ++i) {
+					auto port = static_cast<unsigned short>(test::Local_Host_Port + i);
+					m_peers.push_back(std::make_unique<DelayedPeer>(m_pPool->service(), port, Peer_Response_Delays_Millis[i]));
+
+					m_nodes.push_back(test::CreateLocalHostNode(test::GenerateRandomData<Key_Size>(), port));
+					m_nodeContainer.modifier().add(m_nodes.back(), ionet::NodeSource::Dynamic);
+					m_sockets.push_back(connect(m_nodes.back()));
+				}
+			}
+
+			~LoopbackNetwork() {
+				for (const auto& pSocket : m_sockets)
+					pSocket->close();
+
+				m_pPool->join();
+			}
+
+		public:
+			// syncs with selected peers and returns the number of rounds synced with the fastest peer
+			size_t sync(bool shouldStoreInteractionMetrics) {
+				auto metricsConsumer = CreateInteractionMetricsConsumer(m_nodeContainer, Service_Id);
+				size_t numFastPeerRounds = 0;
+				for (auto i = 0u; i < Num_Sync_Rounds; ++i) {
+					auto peerIndex = selectPeer();
+					auto pMeteredIo = std::make_shared<ionet::MeteredPacketIo>(m_sockets[peerIndex]);
+					if (!pull(*pMeteredIo))
+						CATAPULT_THROW_RUNTIME_ERROR_1("sync with peer failed", peerIndex);
+
+					if (shouldStoreInteractionMetrics)
+						metricsConsumer(m_nodes[peerIndex], pMeteredIo->metrics());
+
+					if (0 == peerIndex)
+						++numFastPeerRounds;
+				}
+
+				return numFastPeerRounds;
+			}
+
+		private:
+			std::shared_ptr<ionet::PacketSocket> connect(const ionet::Node& node) {
+				auto pPromise = std::make_shared<thread::promise<std::shared_ptr<ionet::PacketSocket>>>();
+				auto future = pPromise->get_future();
+				ionet::Connect(m_pPool->service(), test::CreatePacketSocketOptions(), node.endpoint(), [pPromise](
+						auto result,
+						const auto& pSocket) {
+					if (ionet::ConnectResult::Connected != result)
+						pPromise->set_exception(std::make_exception_ptr(catapult_runtime_error("unable to connect to peer")));
+					else
+						pPromise->set_value(std::shared_ptr<ionet::PacketSocket>(pSocket));
+				});
+
+				return future.get();
+			}
+
+			size_t selectPeer() const {
+				WeightedCandidates candidates;
+				uint64_t totalCandidateWeight = 0;
+				auto view = m_nodeContainer.view();
+				for (const auto& node : m_nodes) {
+					const auto* pConnectionState = view.getNodeInfo(node.identityKey()).getConnectionState(Service_Id);
+					auto weight = CalculateWeight(pConnectionState ? *pConnectionState : ionet::ConnectionState());
+					candidates.emplace_back(node, weight);
+					totalCandidateWeight += weight;
+				}
+
+				auto selectedNodes = SelectCandidatesBasedOnWeight(candidates, totalCandidateWeight, 1);
+				const auto& selectedKey = selectedNodes.cbegin()->identityKey();
+				auto iter = std::find_if(m_nodes.cbegin(), m_nodes.cend(), [&selectedKey](const auto& node) {
+					return selectedKey == node.identityKey();
+				});
+				return static_cast<size_t>(std::distance(m_nodes.cbegin(), iter));
+			}
+
+			static bool pull(ionet::PacketIo& io) {
+				auto pPromise = std::make_shared<thread::promise<bool>>();
+				auto future = pPromise->get_future();
+				io.write(ionet::PacketPayload(ionet::PacketType::Pull_Blocks), [&io, pPromise](auto writeCode) {
+					if (ionet::SocketOperationCode::Success != writeCode) {
+						pPromise->set_value(false);
+						return;
+					}
+
+					io.read([pPromise](auto readCode, const auto*) {
+						pPromise->set_value(ionet::SocketOperationCode::Success == readCode);
+					});
+				});
+
+				return future.get();
+			}
+
+		private:
+			std::unique_ptr<thread::IoServiceThreadPool> m_pPool;
+			std::vector<std::unique_ptr<DelayedPeer>> m_peers;
+			std::vector<ionet::Node> m_nodes;
+			ionet::NodeContainer m_nodeContainer;
+			std::vector<std::shared_ptr<ionet::PacketSocket>> m_sockets;
+		};
+
+		// endregion
+
+		uint64_t MeasureSync(const char* name, bool shouldStoreInteractionMetrics) {
+			LoopbackNetwork network;
+
+			utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+			auto numFastPeerRounds = network.sync(shouldStoreInteractionMetrics);
+			auto elapsedMillis = stopwatch.millis();
+
+			CATAPULT_LOG(info)
+					<< name << " synced " << Num_Sync_Rounds << " rounds in " << elapsedMillis << "ms ("
+					<< numFastPeerRounds << " rounds with fastest peer)";
+			return elapsedMillis;
+		}
+	}
+
+	TEST(TEST_CLASS, SyncConvergesFasterWhenNodeSelectionIsWeightedByInteractionMetrics) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert: peers are selected uniformly when no interaction metrics are stored
+		test::RunNonDeterministicTest("weighted node selection", []() {
+			auto unweightedElapsedMillis = MeasureSync("unweighted node selection", false);
+			auto weightedElapsedMillis = MeasureSync("weighted node selection", true);
+			return weightedElapsedMillis < unweightedElapsedMillis;
+		});
+	}
+}}
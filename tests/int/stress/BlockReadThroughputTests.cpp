@@ -0,0 +1,163 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/chain/BlockScorer.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS BlockReadThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Blocks = 20'000;
+		constexpr size_t Num_Passes = 5;
+#else
+		constexpr size_t Num_Blocks = 1'000;
+		constexpr size_t Num_Passes = 2;
+#endif
+
+		// matches the default maximum number of blocks returned by a single pull blocks request (maxBlocksPerSyncAttempt)
+		constexpr uint32_t Max_Blocks_Per_Pull = 400;
+
+		void SeedStorage(const std::string& destination) {
+			utils::StackLogger stopwatch("seed storage", utils::LogLevel::Info);
+			test::PrepareStorage(destination);
+
+			FileBasedStorage storage(destination);
+			for (auto i = 0u; i < Num_Blocks; ++i) {
+				auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(2 + i));
+				storage.saveBlock(test::BlockToBlockElement(*pBlock));
+			}
+		}
+
+		// mirrors the block access pattern of BlockChainLoader::loadAll
+		uint64_t ReplayBlocks(const BlockStorageView& storage) {
+			uint64_t totalScore = 0;
+			auto pParentBlockElement = storage.loadBlockElement(Height(1));
+			auto chainHeight = storage.chainHeight();
+			for (auto height = Height(2); height <= chainHeight; height = height + Height(1)) {
+				auto pBlockElement = storage.loadBlockElement(height);
+				totalScore += chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block);
+
+				for (const auto& transactionInfo : pBlockElement->Transactions)
+					totalScore += transactionInfo.Transaction.Size;
+
+				pParentBlockElement = std::move(pBlockElement);
+			}
+
+			return totalScore;
+		}
+
+		// mirrors the block access pattern of the pull blocks handler
+		size_t PullBlocks(const BlockStorageView& storage) {
+			size_t totalSize = 0;
+			auto chainHeight = storage.chainHeight();
+			for (auto startHeight = Height(2); startHeight <= chainHeight; startHeight = startHeight + Height(Max_Blocks_Per_Pull)) {
+				std::vector<std::shared_ptr<const model::Block>> blocks;
+				for (auto height = startHeight; height <= chainHeight && height < startHeight + Height(Max_Blocks_Per_Pull);) {
+					blocks.push_back(storage.loadBlock(height));
+					height = height + Height(1);
+				}
+
+				auto payload = ionet::PacketPayloadFactory::FromEntities(ionet::PacketType::Pull_Blocks, blocks);
+				totalSize += payload.header().Size;
+			}
+
+			return totalSize;
+		}
+
+		template<typename TAction>
+		uint64_t MeasureMillis(const std::string& operationName, TAction action) {
+			utils::StackLogger stopwatch(operationName.c_str(), utils::LogLevel::Info);
+			for (auto i = 0u; i < Num_Passes; ++i)
+				action();
+
+			return stopwatch.millis();
+		}
+
+		void LogThroughput(const char* operationName, BlockReadMode readMode, uint64_t elapsedMillis) {
+			auto numBlocks = Num_Blocks * Num_Passes;
+			auto blocksPerSecond = 0 == elapsedMillis ? 0 : numBlocks * 1000u / elapsedMillis;
+			CATAPULT_LOG(info)
+					<< operationName << " " << numBlocks << " blocks ("
+					<< (BlockReadMode::Buffered == readMode ? "buffered" : "memory mapped") << ") in "
+					<< elapsedMillis << "ms (" << blocksPerSecond << " blocks/s)";
+		}
+
+		template<typename TAction>
+		auto RunThroughputTest(const char* operationName, TAction action) {
+			// Arrange:
+			test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+			test::TempDirectoryGuard tempDir;
+			SeedStorage(tempDir.name());
+
+			std::vector<decltype(action(std::declval<BlockStorageView>()))> results;
+			for (auto readMode : { BlockReadMode::Buffered, BlockReadMode::Memory_Mapped }) {
+				BlockStorageCache storage(std::make_unique<FileBasedStorage>(tempDir.name(), readMode));
+
+				// - warm up the page cache so that both modes read the same (cached) data
+				action(storage.view());
+
+				// Act:
+				auto elapsedMillis = MeasureMillis(operationName, [&storage, &action, &results]() {
+					results.push_back(action(storage.view()));
+				});
+
+				LogThroughput(operationName, readMode, elapsedMillis);
+			}
+
+			return results;
+		}
+
+		template<typename TResult>
+		void AssertAllEqual(const std::vector<TResult>& results) {
+			// Assert: both modes produced the same results for every pass
+			ASSERT_EQ(2 * Num_Passes, results.size());
+			for (const auto& result : results)
+				EXPECT_EQ(results[0], result);
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ReplayThroughput) {
+		// Act:
+		auto results = RunThroughputTest("replayed", ReplayBlocks);
+
+		// Assert:
+		AssertAllEqual(results);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, PullBlocksThroughput) {
+		// Act:
+		auto results = RunThroughputTest("pulled", PullBlocks);
+
+		// Assert:
+		AssertAllEqual(results);
+	}
+}}
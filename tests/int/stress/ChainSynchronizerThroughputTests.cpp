@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/ChainSynchronizer.h"
+#include "catapult/api/RemoteChainApi.h"
+#include "catapult/model/ChainScore.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/catapult/chain/test/MockChainApi.h"
+#include "tests/test/core/HashTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <sstream>
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS ChainSynchronizerThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr uint32_t Num_Blocks = 20'000;
+#else
+		constexpr uint32_t Num_Blocks = 2'000;
+#endif
+
+		constexpr uint32_t Num_Blocks_Per_Request = 50;
+		constexpr uint32_t Remote_Latency_Millis = 20;
+		constexpr uint32_t Processing_Millis_Per_Range = 5;
+
+		ChainSynchronizerConfiguration CreateConfiguration(uint32_t maxPendingBlockRequests) {
+			auto config = ChainSynchronizerConfiguration();
+			config.MaxBlocksPerSyncAttempt = 4 * Num_Blocks_Per_Request;
+			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromMegabytes(10).bytes32();
+			config.MaxRollbackBlocks = Num_Blocks_Per_Request;
+			config.MaxPendingBlockRequests = maxPendingBlockRequests;
+			return config;
+		}
+
+		void MeasureSyncThroughput(uint32_t maxPendingBlockRequests) {
+			// Arrange: the remote is ahead of the local node and answers every request after a fixed latency
+			auto remoteHashes = test::GenerateRandomHashes(10);
+			auto localHashes = test::GenerateRandomHashesSubset(remoteHashes, 9);
+			auto pLocal = std::make_shared<mocks::MockChainApi>(model::ChainScore(10), Height(20), localHashes);
+			mocks::MockChainApi remote(model::ChainScore(11), Height(20), remoteHashes);
+			remote.setNumBlocksPerBlocksFromRequest({ Num_Blocks_Per_Request });
+			remote.setDelay(utils::TimeSpan::FromMilliseconds(Remote_Latency_Millis));
+
+			// - block ranges are processed in order by a single (simulated) dispatcher thread
+			std::atomic<uint32_t> numConsumedBlocks(0);
+			disruptor::DisruptorElementId nextId = 0;
+			auto pPool = test::CreateStartedIoServiceThreadPool(1);
+			auto blockRangeConsumer = [&numConsumedBlocks, &nextId, &pool = *pPool](auto&& range, const auto& processingComplete) {
+				auto id = ++nextId;
+				numConsumedBlocks += static_cast<uint32_t>(range.size());
+				pool.service().post([id, processingComplete]() {
+					test::Sleep(Processing_Millis_Per_Range);
+
+					disruptor::ConsumerCompletionResult result;
+					result.CompletionStatus = disruptor::CompletionStatus::Normal;
+					processingComplete(id, result);
+				});
+				return id;
+			};
+
+			auto synchronizer = CreateChainSynchronizer(pLocal, CreateConfiguration(maxPendingBlockRequests), blockRangeConsumer);
+
+			// Act:
+			std::ostringstream name;
+			name << "sync with " << maxPendingBlockRequests << " pending block request(s)";
+			uint32_t numSyncRounds = 0;
+			uint64_t elapsedMillis;
+			{
+				utils::StackLogger stopwatch(name.str().c_str(), utils::LogLevel::Info);
+				while (numConsumedBlocks < Num_Blocks) {
+					synchronizer(remote).get();
+					++numSyncRounds;
+				}
+
+				elapsedMillis = stopwatch.millis();
+			}
+
+			pPool->join();
+
+			// Assert:
+			CATAPULT_LOG(info)
+					<< name.str() << " pulled " << numConsumedBlocks << " blocks in " << numSyncRounds << " rounds in "
+					<< elapsedMillis << "ms (" << (numConsumedBlocks * 1000 / std::max<uint64_t>(1, elapsedMillis)) << " blocks/s)";
+			EXPECT_LE(Num_Blocks, numConsumedBlocks);
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, SyncThroughput_SinglePendingBlockRequest) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureSyncThroughput(1);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, SyncThroughput_MultiplePendingBlockRequests) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureSyncThroughput(4);
+	}
+}}
@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS ConsumerDispatcherLatencyTests
+
+	namespace {
+#ifdef STRESS
+		constexpr uint32_t Num_Elements = 10'000;
+#else
+		constexpr uint32_t Num_Elements = 100;
+#endif
+
+		constexpr uint32_t Num_Consumers = 8;
+
+		void RunHandoffLatencyTest(ConsumerWaitStrategy waitStrategy) {
+			// Arrange:
+			test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+			auto ranges = test::PrepareRanges(1);
+
+			ConsumerDispatcherOptions options{ "ConsumerDispatcherLatencyTests", 1024 };
+			options.ElementTraceInterval = Num_Elements;
+			options.WaitStrategy = waitStrategy;
+
+			std::atomic<uint32_t> numConsumerCalls(0);
+			std::vector<DisruptorConsumer> consumers(Num_Consumers, [&numConsumerCalls](const auto&) {
+				++numConsumerCalls;
+				return ConsumerResult::Continue();
+			});
+			ConsumerDispatcher dispatcher(options, consumers);
+
+			// Act: push one element at a time and wait for it to pass all stages so that only handoff latency is measured
+			std::atomic<uint32_t> numCompletedElements(0);
+			auto start = std::chrono::steady_clock::now();
+			for (auto i = 0u; i < Num_Elements; ++i) {
+				dispatcher.processElement(ConsumerInput(model::BlockRange::CopyRange(ranges[0])), [&numCompletedElements](auto, const auto&) {
+					++numCompletedElements;
+				});
+
+				while (i + 1 != numCompletedElements)
+					std::this_thread::yield();
+			}
+
+			auto elapsedDuration = std::chrono::steady_clock::now() - start;
+			auto elapsedMicros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedDuration).count());
+
+			// Assert:
+			EXPECT_EQ(Num_Elements * Num_Consumers, numConsumerCalls);
+
+			auto numHandoffs = static_cast<uint64_t>(Num_Elements) * Num_Consumers;
+			CATAPULT_LOG(info)
+					<< waitStrategy << ": " << Num_Elements << " elements through " << Num_Consumers << " consumers in "
+					<< (elapsedMicros / 1000) << "ms (" << (elapsedMicros / numHandoffs) << "us per stage handoff)";
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, HandoffLatency_Sleep) {
+		// Act + Assert:
+		RunHandoffLatencyTest(ConsumerWaitStrategy::Sleep);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, HandoffLatency_BusySpin) {
+		// Act + Assert:
+		RunHandoffLatencyTest(ConsumerWaitStrategy::Busy_Spin);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, HandoffLatency_SpinThenYield) {
+		// Act + Assert:
+		RunHandoffLatencyTest(ConsumerWaitStrategy::Spin_Then_Yield);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, HandoffLatency_Blocking) {
+		// Act + Assert:
+		RunHandoffLatencyTest(ConsumerWaitStrategy::Blocking);
+	}
+}}
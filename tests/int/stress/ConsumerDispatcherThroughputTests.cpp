@@ -0,0 +1,119 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+#include <atomic>
+#include <chrono>
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS ConsumerDispatcherThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr uint32_t Num_Elements_Per_Producer = 16 * 1024;
+#else
+		constexpr uint32_t Num_Elements_Per_Producer = 2 * 1024;
+#endif
+
+		constexpr uint32_t Batch_Size = 16;
+
+		template<typename TPublish>
+		void RunThroughputTest(const char* mode, uint32_t numProducers, TPublish publish) {
+			// Arrange: make the disruptor large enough to hold all elements so that producers are never rejected
+			test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+			auto ranges = test::PrepareRanges(1);
+
+			auto numElements = Num_Elements_Per_Producer * numProducers;
+			ConsumerDispatcherOptions options{ "ConsumerDispatcherThroughputTests", numElements + 2 };
+			options.ElementTraceInterval = numElements;
+			options.WaitStrategy = ConsumerWaitStrategy::Blocking;
+
+			std::atomic<uint32_t> numInspectedElements(0);
+			ConsumerDispatcher dispatcher(
+					options,
+					{ [](const auto&) { return ConsumerResult::Continue(); } },
+					[&numInspectedElements](const auto&, const auto&) { ++numInspectedElements; });
+
+			// Act:
+			auto start = std::chrono::steady_clock::now();
+			boost::thread_group threads;
+			for (auto i = 0u; i < numProducers; ++i) {
+				threads.create_thread([&dispatcher, &range = ranges[0], publish] {
+					publish(dispatcher, range);
+				});
+			}
+
+			threads.join_all();
+			WAIT_FOR_VALUE(numElements, numInspectedElements);
+
+			auto elapsedDuration = std::chrono::steady_clock::now() - start;
+			auto elapsedMicros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedDuration).count());
+
+			// Assert:
+			EXPECT_EQ(numElements, dispatcher.numAddedElements());
+
+			auto elementsPerSecond = 0 == elapsedMicros ? 0 : numElements * 1'000'000ull / elapsedMicros;
+			CATAPULT_LOG(info)
+					<< mode << " publication with " << numProducers << " producer(s): " << numElements << " elements in "
+					<< (elapsedMicros / 1000) << "ms (" << elementsPerSecond << " elements/s)";
+		}
+
+		void RunSingleThroughputTest(uint32_t numProducers) {
+			RunThroughputTest("single", numProducers, [](auto& dispatcher, const auto& range) {
+				for (auto i = 0u; i < Num_Elements_Per_Producer; ++i)
+					dispatcher.processElement(ConsumerInput(model::BlockRange::CopyRange(range)));
+			});
+		}
+
+		void RunBatchedThroughputTest(uint32_t numProducers) {
+			RunThroughputTest("batched", numProducers, [](auto& dispatcher, const auto& range) {
+				for (auto i = 0u; i < Num_Elements_Per_Producer / Batch_Size; ++i) {
+					std::vector<ConsumerInput> inputs;
+					for (auto j = 0u; j < Batch_Size; ++j)
+						inputs.emplace_back(model::BlockRange::CopyRange(range));
+
+					dispatcher.processElements(std::move(inputs));
+				}
+			});
+		}
+	}
+
+#define THROUGHPUT_TEST(NUM_PRODUCERS) \
+	NO_STRESS_TEST(TEST_CLASS, SingleThroughput_##NUM_PRODUCERS##_Producers) { \
+		RunSingleThroughputTest(NUM_PRODUCERS); \
+	} \
+	\
+	NO_STRESS_TEST(TEST_CLASS, BatchedThroughput_##NUM_PRODUCERS##_Producers) { \
+		RunBatchedThroughputTest(NUM_PRODUCERS); \
+	}
+
+	THROUGHPUT_TEST(1)
+	THROUGHPUT_TEST(2)
+	THROUGHPUT_TEST(4)
+	THROUGHPUT_TEST(8)
+
+#undef THROUGHPUT_TEST
+}}
@@ -0,0 +1,161 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/constants.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/local/LocalTestUtils.h"
+#include "tests/test/nemesis/NemesisCompatibleConfiguration.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/test/plugins/ValidatorTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace plugins {
+
+#define TEST_CLASS NotificationDemuxThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Transactions = 1'000'000;
+#else
+		constexpr size_t Num_Transactions = 100'000;
+#endif
+
+		model::BlockChainConfiguration CreateBlockChainConfiguration() {
+			auto config = test::CreateLocalNodeBlockChainConfiguration();
+			test::AddNemesisPluginExtensions(config);
+			config.Plugins.emplace("catapult.plugins.aggregate", utils::ConfigurationBag({ { "", {
+				{ "maxTransactionsPerAggregate", "1'000" },
+				{ "maxCosignaturesPerAggregate", "15" },
+				{ "enableStrictCosignatureCheck", "false" },
+				{ "enableBondedAggregateSupport", "true" }
+			} } }));
+			config.Plugins.emplace("catapult.plugins.lock", utils::ConfigurationBag({ { "", {
+				{ "lockedFundsPerAggregate", "10'000'000" },
+				{ "maxHashLockDuration", "2d" },
+				{ "maxSecretLockDuration", "30d" },
+				{ "minProofSize", "10" },
+				{ "maxProofSize", "1000" }
+			} } }));
+			config.Plugins.emplace("catapult.plugins.multisig", utils::ConfigurationBag({ { "", {
+				{ "maxMultisigDepth", "3" },
+				{ "maxCosignersPerAccount", "10" },
+				{ "maxCosignedAccountsPerAccount", "5" }
+			} } }));
+			return config;
+		}
+
+		// mix of core notifications resembling the notifications published by a simple transfer transaction
+		// (signature notifications are excluded because signature verification would dominate the measurement)
+		class NotificationMix {
+		public:
+			NotificationMix()
+					: m_signer(test::GenerateRandomData<Key_Size>())
+					, m_recipient(test::GenerateRandomData<Address_Decoded_Size>())
+					, m_entityNotification(model::NetworkIdentifier::Mijin_Test)
+					, m_transactionNotification(m_signer, Hash256(), model::EntityType(), Timestamp())
+					, m_accountPublicKeyNotification(m_signer)
+					, m_accountAddressNotification(m_recipient)
+					, m_feeNotification(m_signer, Xem_Id, Amount(100))
+					, m_transferNotification(m_signer, m_recipient, Xem_Id, Amount(1'000))
+			{}
+
+		public:
+			std::vector<const model::Notification*> notifications() const {
+				return {
+					&m_entityNotification,
+					&m_transactionNotification,
+					&m_accountPublicKeyNotification,
+					&m_accountAddressNotification,
+					&m_feeNotification,
+					&m_transferNotification
+				};
+			}
+
+		private:
+			Key m_signer;
+			Address m_recipient;
+			model::EntityNotification m_entityNotification;
+			model::TransactionNotification m_transactionNotification;
+			model::AccountPublicKeyNotification m_accountPublicKeyNotification;
+			model::AccountAddressNotification m_accountAddressNotification;
+			model::BalanceReserveNotification m_feeNotification;
+			model::BalanceTransferNotification m_transferNotification;
+		};
+
+		template<typename TValidate>
+		void MeasureThroughput(const char* name, const std::vector<const model::Notification*>& notifications, TValidate validate) {
+			utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+			for (auto i = 0u; i < Num_Transactions; ++i) {
+				for (const auto* pNotification : notifications)
+					validate(*pNotification);
+			}
+
+			auto elapsedMillis = stopwatch.millis();
+			CATAPULT_LOG(info)
+					<< name << " processed " << Num_Transactions * notifications.size() << " notifications in "
+					<< elapsedMillis << "ms";
+		}
+
+		bool IsAnyFailureSuppressed(validators::ValidationResult) {
+			// suppress all failures so that every matching validator is always invoked
+			return true;
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, StatelessValidatorThroughput) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		auto pPluginManager = test::CreateDefaultPluginManager(CreateBlockChainConfiguration());
+		auto pValidator = pPluginManager->createStatelessValidator(IsAnyFailureSuppressed);
+		CATAPULT_LOG(info) << "stateless validators: " << pValidator->names().size();
+
+		NotificationMix notificationMix;
+
+		// Act:
+		const auto& validator = *pValidator;
+		MeasureThroughput("stateless demux", notificationMix.notifications(), [&validator](const auto& notification) {
+			EXPECT_EQ(validators::ValidationResult::Success, validator.validate(notification));
+		});
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, StatefulValidatorThroughput) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		auto pPluginManager = test::CreateDefaultPluginManager(CreateBlockChainConfiguration());
+		auto pValidator = pPluginManager->createStatefulValidator(IsAnyFailureSuppressed);
+		CATAPULT_LOG(info) << "stateful validators: " << pValidator->names().size();
+
+		auto cache = pPluginManager->createCache();
+		auto cacheView = cache.createView();
+		auto readOnlyCache = cacheView.toReadOnly();
+		auto context = test::CreateValidatorContext(Height(123), pPluginManager->config().Network, readOnlyCache);
+
+		NotificationMix notificationMix;
+
+		// Act:
+		const auto& validator = *pValidator;
+		MeasureThroughput("stateful demux", notificationMix.notifications(), [&validator, &context](const auto& notification) {
+			EXPECT_EQ(validators::ValidationResult::Success, validator.validate(notification, context));
+		});
+	}
+}}
@@ -0,0 +1,208 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/chain/ProcessingNotificationSubscriber.h"
+#include "catapult/constants.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/test/plugins/ValidatorTestUtils.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	// count all heap allocations made by this process so that undo log allocations can be reported
+	std::atomic<uint64_t> g_numAllocations(0);
+}
+
+void* operator new(size_t size) {
+	++g_numAllocations;
+	if (auto* pMemory = std::malloc(0 == size ? 1 : size))
+		return pMemory;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pMemory) noexcept {
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept {
+	std::free(pMemory);
+}
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS NotificationUndoLogThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Transactions = 2'000'000;
+#else
+		constexpr size_t Num_Transactions = 200'000;
+#endif
+
+		// every fourth transaction is undone, which is typical of a flood of (partially) invalid transactions
+		constexpr size_t Undo_Frequency = 4;
+
+		class NoOpValidator : public validators::stateful::NotificationValidator {
+		public:
+			NoOpValidator() : m_name("NoOpValidator")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			validators::ValidationResult validate(const model::Notification&, const validators::ValidatorContext&) const override {
+				return validators::ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+		};
+
+		class NoOpObserver : public observers::NotificationObserver {
+		public:
+			NoOpObserver() : m_name("NoOpObserver")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			void notify(const model::Notification&, const observers::ObserverContext&) const override
+			{}
+
+		private:
+			std::string m_name;
+		};
+
+		// mix of notifications resembling the notifications published by a simple transfer transaction
+		class NotificationMix {
+		public:
+			NotificationMix()
+					: m_signer(test::GenerateRandomData<Key_Size>())
+					, m_recipient(test::GenerateRandomData<Address_Decoded_Size>())
+					, m_accountPublicKeyNotification(m_signer)
+					, m_entityNotification(model::NetworkIdentifier::Mijin_Test)
+					, m_transactionNotification(m_signer, Hash256(), model::EntityType(), Timestamp())
+					, m_accountAddressNotification(m_recipient)
+					, m_feeNotification(m_signer, Xem_Id, Amount(100))
+					, m_transferNotification(m_signer, m_recipient, Xem_Id, Amount(1'000))
+			{}
+
+		public:
+			void publish(model::NotificationSubscriber& sub) const {
+				sub.notify(m_accountPublicKeyNotification);
+				sub.notify(m_entityNotification);
+				sub.notify(m_transactionNotification);
+				sub.notify(m_accountAddressNotification);
+				sub.notify(m_feeNotification);
+				sub.notify(m_transferNotification);
+			}
+
+		private:
+			Key m_signer;
+			Address m_recipient;
+			model::AccountPublicKeyNotification m_accountPublicKeyNotification;
+			model::EntityNotification m_entityNotification;
+			model::TransactionNotification m_transactionNotification;
+			model::AccountAddressNotification m_accountAddressNotification;
+			model::BalanceReserveNotification m_feeNotification;
+			model::BalanceTransferNotification m_transferNotification;
+		};
+
+		class FloodContext {
+		public:
+			FloodContext()
+					: m_cache({})
+					, m_cacheDelta(m_cache.createDelta())
+					, m_readOnlyCache(m_cacheDelta.toReadOnly())
+					, m_validatorContext(test::CreateValidatorContext(Height(123), m_readOnlyCache))
+					, m_observerContext(m_cacheDelta, m_state, Height(123), observers::NotifyMode::Commit)
+			{}
+
+		public:
+			template<typename TEnableUndo>
+			void measure(const char* name, TEnableUndo enableUndo) {
+				auto numStartAllocations = g_numAllocations.load();
+				utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+				for (auto i = 0u; i < Num_Transactions; ++i) {
+					ProcessingNotificationSubscriber sub(m_validator, m_validatorContext, m_observer, m_observerContext);
+					enableUndo(sub);
+					m_notificationMix.publish(sub);
+
+					if (0 == i % Undo_Frequency)
+						sub.undo();
+				}
+
+				auto elapsedMillis = stopwatch.millis();
+				auto numAllocations = g_numAllocations.load() - numStartAllocations;
+				CATAPULT_LOG(info)
+						<< name << " processed " << Num_Transactions << " transactions in " << elapsedMillis << "ms"
+						<< " with " << numAllocations << " allocations";
+			}
+
+		private:
+			NoOpValidator m_validator;
+			NoOpObserver m_observer;
+			NotificationMix m_notificationMix;
+
+			cache::CatapultCache m_cache;
+			cache::CatapultCacheDelta m_cacheDelta;
+			cache::ReadOnlyCatapultCache m_readOnlyCache;
+			state::CatapultState m_state;
+
+			validators::ValidatorContext m_validatorContext;
+			observers::ObserverContext m_observerContext;
+		};
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, UtFloodThroughput_PerTransactionUndoLog) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		FloodContext context;
+
+		// Act:
+		context.measure("per transaction undo log", [](auto& sub) {
+			sub.enableUndo();
+		});
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, UtFloodThroughput_SharedUndoLog) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		FloodContext context;
+		NotificationUndoLog undoLog;
+
+		// Act: mirror UtUpdater, which clears the shared log after each applied transaction
+		context.measure("shared undo log", [&undoLog](auto& sub) {
+			undoLog.clear();
+			sub.enableUndo(undoLog);
+		});
+	}
+}}
@@ -0,0 +1,128 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/MemoryUtCache.h"
+#include "catapult/chain/UtUpdater.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/utils/StackLogger.h"
+#include "tests/test/cache/UtTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/local/EntityFactory.h"
+#include "tests/test/local/LocalTestUtils.h"
+#include "tests/test/nemesis/NemesisCompatibleConfiguration.h"
+#include "tests/test/nodeps/Logging.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS UtUpdaterThroughputTests
+
+	namespace {
+#ifdef STRESS
+		constexpr size_t Num_Transactions = 250'000;
+#else
+		constexpr size_t Num_Transactions = 50'000;
+#endif
+
+		constexpr auto Current_Time = Timestamp(1'000'000'000);
+
+		model::BlockChainConfiguration CreateBlockChainConfiguration() {
+			auto config = test::CreateLocalNodeBlockChainConfiguration();
+			test::AddNemesisPluginExtensions(config);
+			return config;
+		}
+
+		std::vector<model::TransactionInfo> CreateTransactionInfos() {
+			// every other transaction has expired so that the updater needs to drop it
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < Num_Transactions; ++i) {
+				auto recipient = test::GenerateRandomData<Address_Decoded_Size>();
+				auto pTransaction = test::CreateUnsignedTransferTransaction(test::GenerateRandomData<Key_Size>(), recipient, Amount(0));
+				pTransaction->Fee = Amount(0);
+				pTransaction->Deadline = 0 == i % 2 ? Current_Time + Timestamp(60'000) : Timestamp(1);
+
+				auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+				test::FillWithRandomData(transactionInfo.EntityHash);
+				transactionInfos.push_back(std::move(transactionInfo));
+			}
+
+			return transactionInfos;
+		}
+
+		void MeasureReapply(const char* name, const std::shared_ptr<thread::IoServiceThreadPool>& pPool) {
+			// Arrange:
+			auto pPluginManager = test::CreateDefaultPluginManager(CreateBlockChainConfiguration());
+			auto cache = pPluginManager->createCache();
+
+			ExecutionConfiguration executionConfig;
+			executionConfig.Network = pPluginManager->config().Network;
+			executionConfig.pObserver = pPluginManager->createObserver();
+			executionConfig.pValidator = pPluginManager->createStatefulValidator();
+			executionConfig.pNotificationPublisher = pPluginManager->createNotificationPublisher();
+
+			cache::MemoryUtCache transactionsCache(cache::MemoryCacheOptions(1'000'000, Num_Transactions));
+			test::AddAll(transactionsCache, CreateTransactionInfos());
+
+			UtUpdater updater(
+					transactionsCache,
+					cache,
+					executionConfig,
+					[]() { return Current_Time; },
+					[](const auto&, const auto&, auto) {},
+					[](const auto&, const auto&) { return false; },
+					pPool);
+
+			// Act: re-apply all pending transactions
+			uint64_t elapsedMillis;
+			{
+				utils::StackLogger stopwatch(name, utils::LogLevel::Info);
+				updater.update({}, {});
+				elapsedMillis = stopwatch.millis();
+			}
+
+			// Assert: all expired transactions were dropped
+			auto numRemaining = transactionsCache.view().size();
+			CATAPULT_LOG(info)
+					<< name << " re-applied " << Num_Transactions << " transactions in " << elapsedMillis << "ms"
+					<< " (" << numRemaining << " remaining)";
+			EXPECT_GE(Num_Transactions / 2, numRemaining);
+		}
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ReapplyThroughput_Sequential) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+
+		// Act + Assert:
+		MeasureReapply("sequential re-apply", nullptr);
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ReapplyThroughput_Prevalidated) {
+		// Arrange:
+		test::GlobalLogFilter testLogFilter(utils::LogLevel::Info);
+		auto pPool = std::shared_ptr<thread::IoServiceThreadPool>(test::CreateStartedIoServiceThreadPool());
+
+		// Act + Assert:
+		MeasureReapply("prevalidated re-apply", pPool);
+	}
+}}
@@ -23,6 +23,7 @@
 #include "catapult/cache/ReadOnlySimpleCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/cache/SynchronizedCache.h"
+#include "catapult/cache/ValueUndoJournal.h"
 #include "catapult/io/PodIoUtils.h"
 #include "catapult/io/Stream.h"
 #include "tests/test/nodeps/Atomics.h"
@@ -233,6 +234,9 @@ namespace catapult { namespace test {
 
 		/// Returns a locked cache delta based on this cache.
 		CacheDeltaType createDelta() {
+			if (m_pUndoJournal)
+				m_pUndoJournal->reset();
+
 			return CacheDeltaType(m_id);
 		}
 
@@ -249,13 +253,38 @@ namespace catapult { namespace test {
 				m_pFlag->wait();
 			}
 
+			if (m_pUndoJournal)
+				m_pUndoJournal->record(m_id);
+
 			m_id = delta.id();
 		}
 
+	public:
+		/// Enables journaling of all subsequent commits.
+		void enableUndoJournal() {
+			if (!m_pUndoJournal)
+				m_pUndoJournal = std::make_unique<cache::ValueUndoJournal<size_t>>();
+		}
+
+		/// Discards all but the \a numRetainedCommits most recent journaled commits.
+		void pruneUndoJournal(size_t numRetainedCommits) {
+			if (m_pUndoJournal)
+				m_pUndoJournal->prune(numRetainedCommits);
+		}
+
+		/// Reverts the \a numCommits most recent journaled commits in \a delta.
+		void undo(CacheDeltaType& delta, size_t numCommits) {
+			if (!m_pUndoJournal)
+				CATAPULT_THROW_RUNTIME_ERROR("undo journal is not enabled");
+
+			delta.insert(m_pUndoJournal->undo(numCommits));
+		}
+
 	private:
 		std::shared_ptr<const test::AutoSetFlag::State> m_pFlag;
 		SimpleCacheViewMode m_mode;
 		size_t m_id;
+		std::unique_ptr<cache::ValueUndoJournal<size_t>> m_pUndoJournal;
 	};
 
 	/// Synchronized cache composed of simple data.
@@ -42,6 +42,7 @@ namespace catapult { namespace test {
 
 			config.MaxBlocksPerSyncAttempt = 4 * 100;
 			config.MaxChainBytesPerSyncAttempt = utils::FileSize::FromKilobytes(8 * 512);
+			config.MaxPendingBlockRequests = 1;
 
 			config.ShortLivedCacheMaxSize = 10;
 
@@ -53,7 +54,9 @@ namespace catapult { namespace test {
 			config.MaxPacketDataSize = utils::FileSize::FromMegabytes(100);
 
 			config.BlockDisruptorSize = 4 * 1024;
+			config.BlockDisruptorWaitStrategy = disruptor::ConsumerWaitStrategy::Blocking;
 			config.TransactionDisruptorSize = 16 * 1024;
+			config.TransactionDisruptorWaitStrategy = disruptor::ConsumerWaitStrategy::Blocking;
 
 			config.OutgoingSecurityMode = ionet::ConnectionSecurityMode::None;
 			config.IncomingSecurityModes = ionet::ConnectionSecurityMode::None;
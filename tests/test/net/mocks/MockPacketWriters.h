@@ -144,6 +144,11 @@ namespace catapult { namespace mocks {
 			m_pPacketIo = pPacketIo;
 		}
 
+		/// Sets the node returned by pickOne to \a node.
+		void setNode(const ionet::Node& node) {
+			m_node = node;
+		}
+
 	public:
 		/// Gets the number of pickOne calls.
 		size_t numPickOneCalls() const {
@@ -158,7 +163,7 @@ namespace catapult { namespace mocks {
 	public:
 		ionet::NodePacketIoPair pickOne(const utils::TimeSpan& ioDuration) override {
 			m_ioDurations.push_back(ioDuration);
-			auto pair = ionet::NodePacketIoPair(ionet::Node(), m_pPacketIo);
+			auto pair = ionet::NodePacketIoPair(m_node, m_pPacketIo);
 
 			// if the io should only be used once, destroy the reference in writers before returning
 			if (SetPacketIoBehavior::Use_Once == m_setPacketIoBehavior)
@@ -171,6 +176,7 @@ namespace catapult { namespace mocks {
 		SetPacketIoBehavior m_setPacketIoBehavior;
 		std::vector<utils::TimeSpan> m_ioDurations;
 		std::shared_ptr<ionet::PacketIo> m_pPacketIo;
+		ionet::Node m_node;
 	};
 
 	/// Mock packet writers that has a broadcast implementation.
@@ -35,6 +35,11 @@ namespace catapult { namespace tools { namespace benchmark {
 			bool IsVerified = false;
 		};
 
+		struct BenchmarkBatch {
+			std::vector<crypto::SignatureInput> Inputs;
+			bool IsVerified = false;
+		};
+
 		class BenchmarkTool : public Tool {
 		public:
 			std::string name() const override {
@@ -54,6 +59,9 @@ namespace catapult { namespace tools { namespace benchmark {
 				optionsBuilder("data size,s",
 						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
 						"the size of the data to generate");
+				optionsBuilder("batch size,b",
+						OptionsValue<uint32_t>(m_batchSize)->default_value(64),
+						"the number of signatures to verify per batch (0 to skip batch verification)");
 			}
 
 			int run(const Options&) override {
@@ -64,7 +72,8 @@ namespace catapult { namespace tools { namespace benchmark {
 						<< "num threads (" << m_numThreads
 						<< "), num partitions (" << m_numPartitions
 						<< "), ops / partition (" << m_opsPerPartition
-						<< "), data size (" << m_dataSize << ")";
+						<< "), data size (" << m_dataSize
+						<< "), batch size (" << m_batchSize << ")";
 
 				auto keyPair = GenerateRandomKeyPair();
 				auto entries = std::vector<BenchmarkEntry>(m_numPartitions * m_opsPerPartition);
@@ -87,6 +96,19 @@ namespace catapult { namespace tools { namespace benchmark {
 						CATAPULT_LOG(warning) << "could not verify data!";
 				});
 
+				if (0 == m_batchSize)
+					return 0;
+
+				auto batches = std::vector<BenchmarkBatch>((entries.size() + m_batchSize - 1) / m_batchSize);
+				for (auto i = 0u; i < entries.size(); ++i)
+					batches[i / m_batchSize].Inputs.push_back({ keyPair.publicKey(), entries[i].Data, entries[i].Signature });
+
+				RunParallel("Batch Verify", *pPool, batches, entries.size(), [](auto& batch) {
+					batch.IsVerified = crypto::VerifyMulti(crypto::SecureRandomFill, batch.Inputs.data(), batch.Inputs.size());
+					if (!batch.IsVerified)
+						CATAPULT_LOG(warning) << "could not verify batch!";
+				});
+
 				return 0;
 			}
 
@@ -97,15 +119,25 @@ namespace catapult { namespace tools { namespace benchmark {
 					thread::IoServiceThreadPool& pool,
 					std::vector<BenchmarkEntry>& entries,
 					TAction action) const {
+				return RunParallel(testName, pool, entries, entries.size(), action);
+			}
+
+			template<typename TItem, typename TAction>
+			uint64_t RunParallel(
+					const char* testName,
+					thread::IoServiceThreadPool& pool,
+					std::vector<TItem>& items,
+					size_t numOperations,
+					TAction action) const {
 				utils::StackLogger stopwatch(testName, utils::LogLevel::Info);
-				thread::ParallelFor(pool.service(), entries, m_numPartitions, [action](auto& entry, auto) {
-					action(entry);
+				thread::ParallelFor(pool.service(), items, m_numPartitions, [action](auto& item, auto) {
+					action(item);
 					return true;
 				}).get();
 
 				auto elapsedMillis = stopwatch.millis();
-				auto elapsedMicrosPerOp = elapsedMillis * 1000u / entries.size();
-				auto opsPerSecond = 0 == elapsedMillis ? 0 : entries.size() * 1000u / elapsedMillis;
+				auto elapsedMicrosPerOp = elapsedMillis * 1000u / numOperations;
+				auto opsPerSecond = 0 == elapsedMillis ? 0 : numOperations * 1000u / elapsedMillis;
 				CATAPULT_LOG(info)
 						<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
 						<< "(elapsed time " << elapsedMillis << "ms, " << elapsedMicrosPerOp << "us/op)";
@@ -117,6 +149,7 @@ namespace catapult { namespace tools { namespace benchmark {
 			uint32_t m_numPartitions;
 			uint32_t m_opsPerPartition;
 			uint32_t m_dataSize;
+			uint32_t m_batchSize;
 		};
 	}
 }}}
@@ -0,0 +1,73 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "tools/ToolMain.h"
+#include "catapult/io/SegmentedFileBasedStorage.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/StackLogger.h"
+#include <boost/filesystem.hpp>
+#include <string>
+
+namespace catapult { namespace tools { namespace blockmigrate {
+
+	namespace {
+		class BlockMigrationTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Block Migration Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("data,d",
+						OptionsValue<std::string>(m_dataDirectory)->required(),
+						"data directory containing blocks stored in per-block files");
+				optionsBuilder("delete,x",
+						OptionsSwitch(),
+						"delete per-block files after all blocks have been copied into segment files");
+			}
+
+			int run(const Options& options) override {
+				if (!boost::filesystem::is_directory(m_dataDirectory)) {
+					CATAPULT_LOG(error) << "data directory " << m_dataDirectory << " does not exist";
+					return -1;
+				}
+
+				auto shouldDeleteBlockFiles = options["delete"].as<bool>();
+				CATAPULT_LOG(info)
+						<< "migrating blocks in " << m_dataDirectory << " into segment files"
+						<< (shouldDeleteBlockFiles ? " (block files will be deleted)" : "");
+
+				utils::StackLogger stopwatch("migrate blocks", utils::LogLevel::Info);
+				auto numBlocks = io::SegmentedFileBasedStorage::MigrateBlockFiles(m_dataDirectory, shouldDeleteBlockFiles);
+				CATAPULT_LOG(info) << "migrated " << numBlocks << " blocks";
+				return 0;
+			}
+
+		private:
+			std::string m_dataDirectory;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::blockmigrate::BlockMigrationTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}